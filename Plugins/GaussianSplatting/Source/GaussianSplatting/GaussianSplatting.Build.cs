@@ -39,6 +39,12 @@ public class GaussianSplatting : ModuleRules
 			}
 		);
 
+		// Import streams are cached in the derived data cache
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("DerivedDataCache");
+		}
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -3,8 +3,741 @@
 #include "GaussianSplatAsset.h"
 #include "Engine/Texture2D.h"
 #include "TextureResource.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#if WITH_EDITOR
+#include "DerivedDataCacheInterface.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#endif
+
+// Change to invalidate the cached import streams when the encoding changes without an asset version bump
+#define GAUSSIAN_SPLAT_DERIVEDDATA_VER TEXT("C4E82B1F6D3A4E9B8F0A2D5C7E1B3F94")
+
+namespace GaussianSplatAssetPrivate
+{
+	/** Source of GetRenderDataId values, never reused so a stale id cannot match new data */
+	std::atomic<uint32> NextRenderDataId{1};
+
+	/**
+	 * Pad a GPU byte-address payload so the unaligned 2-byte loads in GaussianSplatting.ush,
+	 * which fetch whole 4-byte words, never read past the end of the buffer
+	 */
+	int64 GetPaddedBufferSize(int64 NumBytes)
+	{
+		return Align(NumBytes, 16);
+	}
+
+	/** Write a vector in the given format. Quantized formats expect components already normalized to [0,1] */
+	void WriteVector(uint8* Dest, const FVector3f& Value, EGaussianPositionFormat Format)
+	{
+		switch (Format)
+		{
+		case EGaussianPositionFormat::Float32:
+			FMemory::Memcpy(Dest, &Value, sizeof(FVector3f));
+			break;
+		case EGaussianPositionFormat::Norm16:
+		{
+			uint16 Packed[3];
+			GaussianSplattingUtils::EncodeFloat3ToNorm16(Value, Packed);
+			FMemory::Memcpy(Dest, Packed, sizeof(Packed));
+			break;
+		}
+		case EGaussianPositionFormat::Norm11:
+		{
+			const uint32 Packed = GaussianSplattingUtils::EncodeFloat3ToNorm11(Value);
+			FMemory::Memcpy(Dest, &Packed, sizeof(Packed));
+			break;
+		}
+		case EGaussianPositionFormat::Norm6:
+		{
+			const uint16 Packed = GaussianSplattingUtils::EncodeFloat3ToNorm655(Value);
+			FMemory::Memcpy(Dest, &Packed, sizeof(Packed));
+			break;
+		}
+		}
+	}
+
+	/** Read a vector written by WriteVector. Quantized formats return normalized [0,1] components */
+	FVector3f ReadVector(const uint8* Src, EGaussianPositionFormat Format)
+	{
+		switch (Format)
+		{
+		case EGaussianPositionFormat::Norm16:
+		{
+			uint16 Packed[3];
+			FMemory::Memcpy(Packed, Src, sizeof(Packed));
+			return FVector3f(Packed[0] / 65535.0f, Packed[1] / 65535.0f, Packed[2] / 65535.0f);
+		}
+		case EGaussianPositionFormat::Norm11:
+		{
+			uint32 Packed;
+			FMemory::Memcpy(&Packed, Src, sizeof(Packed));
+			return FVector3f((Packed & 2047) / 2047.0f, ((Packed >> 11) & 1023) / 1023.0f, ((Packed >> 21) & 2047) / 2047.0f);
+		}
+		case EGaussianPositionFormat::Norm6:
+		{
+			uint16 Packed;
+			FMemory::Memcpy(&Packed, Src, sizeof(Packed));
+			return FVector3f((Packed & 63) / 63.0f, ((Packed >> 6) & 31) / 31.0f, ((Packed >> 11) & 31) / 31.0f);
+		}
+		default:
+		{
+			FVector3f Value;
+			FMemory::Memcpy(&Value, Src, sizeof(FVector3f));
+			return Value;
+		}
+		}
+	}
+
+	/** Normalize a value against a [Min, Max] range, collapsing degenerate ranges to 0 */
+	float NormalizeToRange(float Value, float Min, float Max)
+	{
+		const float Range = Max - Min;
+		return Range > UE_SMALL_NUMBER ? FMath::Clamp((Value - Min) / Range, 0.0f, 1.0f) : 0.0f;
+	}
+
+	/** Replace a bulk payload with the given bytes */
+	void SetBulkData(FByteBulkData& BulkData, const TArray<uint8>& Data)
+	{
+		BulkData.Lock(LOCK_READ_WRITE);
+		void* DataPtr = BulkData.Realloc(Data.Num());
+		FMemory::Memcpy(DataPtr, Data.GetData(), Data.Num());
+		BulkData.Unlock();
+		BulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	}
+
+	/** Bytes of the color texture in the given format, block-compressed formats store 4x4 texel blocks */
+	int64 GetColorTextureBytes(EGaussianColorFormat Format, int32 Width, int32 Height)
+	{
+		const int64 NumTexels = static_cast<int64>(Width) * Height;
+		switch (Format)
+		{
+		case EGaussianColorFormat::Float32x4: return NumTexels * sizeof(FLinearColor);
+		case EGaussianColorFormat::Norm8x4:   return NumTexels * 4;
+		case EGaussianColorFormat::BC7:       return NumTexels;  // 16 bytes per 4x4 block
+		case EGaussianColorFormat::Float16x4:
+		default:                              return NumTexels * sizeof(FFloat16Color);
+		}
+	}
+
+	/** Pixel format of the color texture */
+	EPixelFormat GetColorPixelFormat(EGaussianColorFormat Format)
+	{
+		switch (Format)
+		{
+		case EGaussianColorFormat::Float32x4: return PF_A32B32G32R32F;
+		case EGaussianColorFormat::Norm8x4:   return PF_R8G8B8A8;
+		case EGaussianColorFormat::BC7:       return PF_BC7;
+		case EGaussianColorFormat::Float16x4:
+		default:                              return PF_FloatRGBA;
+		}
+	}
+
+	/**
+	 * Write one color texel. Float formats keep HDR values (SH can produce colors outside [0,1]),
+	 * Norm8x4 clamps; opacity is always [0,1]
+	 */
+	void WriteColorTexel(uint8* Texels, int64 TexelIndex, EGaussianColorFormat Format, const FVector3f& Color, float Opacity)
+	{
+		const float Alpha = FMath::Clamp(Opacity, 0.0f, 1.0f);
+		switch (Format)
+		{
+		case EGaussianColorFormat::Float32x4:
+			reinterpret_cast<FLinearColor*>(Texels)[TexelIndex] = FLinearColor(Color.X, Color.Y, Color.Z, Alpha);
+			break;
+		case EGaussianColorFormat::Norm8x4:
+		case EGaussianColorFormat::BC7:
+		{
+			uint8* Texel = Texels + TexelIndex * 4;
+			Texel[0] = static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Color.X, 0.0f, 1.0f) * 255.0f));
+			Texel[1] = static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Color.Y, 0.0f, 1.0f) * 255.0f));
+			Texel[2] = static_cast<uint8>(FMath::RoundToInt(FMath::Clamp(Color.Z, 0.0f, 1.0f) * 255.0f));
+			Texel[3] = static_cast<uint8>(FMath::RoundToInt(Alpha * 255.0f));
+			break;
+		}
+		case EGaussianColorFormat::Float16x4:
+		default:
+		{
+			FFloat16Color& Texel = reinterpret_cast<FFloat16Color*>(Texels)[TexelIndex];
+			Texel.R = FFloat16(Color.X);
+			Texel.G = FFloat16(Color.Y);
+			Texel.B = FFloat16(Color.Z);
+			Texel.A = FFloat16(Alpha);
+			break;
+		}
+		}
+	}
+
+	/** BC7 4-bit index interpolation weights, out of 64 */
+	constexpr int32 BC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	/** Interpolate two 8-bit BC7 endpoints */
+	int32 BC7Interpolate(int32 E0, int32 E1, int32 Index)
+	{
+		return ((64 - BC7Weights4[Index]) * E0 + BC7Weights4[Index] * E1 + 32) >> 6;
+	}
+
+	/**
+	 * Encode a 4x4 RGBA8 block as BC7 mode 6: one subset, 7.7.7.7 endpoints with a p-bit each, 4-bit indices.
+	 * Endpoints are fitted along the principal axis of the block's colors; the Morton swizzle puts 16 consecutive
+	 * (spatially neighbouring) splats in every block, so that axis captures most of the variation.
+	 */
+	void EncodeBC7Block(const uint8 (&Texels)[16][4], uint8 (&OutBlock)[16])
+	{
+		float Mean[4] = {};
+		for (int32 p = 0; p < 16; p++)
+		{
+			for (int32 c = 0; c < 4; c++)
+			{
+				Mean[c] += Texels[p][c] / 16.0f;
+			}
+		}
+
+		float Covariance[4][4] = {};
+		for (int32 p = 0; p < 16; p++)
+		{
+			for (int32 i = 0; i < 4; i++)
+			{
+				for (int32 j = 0; j < 4; j++)
+				{
+					Covariance[i][j] += (Texels[p][i] - Mean[i]) * (Texels[p][j] - Mean[j]);
+				}
+			}
+		}
+
+		// Principal axis by power iteration, a flat block keeps a zero axis and collapses to its mean
+		float Axis[4] = { Covariance[0][0], Covariance[1][1], Covariance[2][2], Covariance[3][3] };
+		for (int32 Iteration = 0; Iteration < 8; Iteration++)
+		{
+			float Next[4] = {};
+			float LengthSquared = 0.0f;
+			for (int32 i = 0; i < 4; i++)
+			{
+				for (int32 j = 0; j < 4; j++)
+				{
+					Next[i] += Covariance[i][j] * Axis[j];
+				}
+				LengthSquared += Next[i] * Next[i];
+			}
+			const float InvLength = LengthSquared > UE_SMALL_NUMBER ? FMath::InvSqrt(LengthSquared) : 0.0f;
+			for (int32 i = 0; i < 4; i++)
+			{
+				Axis[i] = Next[i] * InvLength;
+			}
+		}
+
+		float MinT = 0.0f;
+		float MaxT = 0.0f;
+		for (int32 p = 0; p < 16; p++)
+		{
+			float T = 0.0f;
+			for (int32 c = 0; c < 4; c++)
+			{
+				T += (Texels[p][c] - Mean[c]) * Axis[c];
+			}
+			MinT = FMath::Min(MinT, T);
+			MaxT = FMath::Max(MaxT, T);
+		}
+
+		// Quantize each endpoint to 7 bits per channel plus the p-bit that fits it best
+		int32 Quantized[2][4];
+		int32 PBits[2];
+		int32 Endpoints[2][4];
+		for (int32 e = 0; e < 2; e++)
+		{
+			float Target[4];
+			for (int32 c = 0; c < 4; c++)
+			{
+				Target[c] = FMath::Clamp(Mean[c] + (e == 0 ? MinT : MaxT) * Axis[c], 0.0f, 255.0f);
+			}
+
+			float BestError = UE_MAX_FLT;
+			for (int32 PBit = 0; PBit < 2; PBit++)
+			{
+				int32 Candidate[4];
+				float Error = 0.0f;
+				for (int32 c = 0; c < 4; c++)
+				{
+					Candidate[c] = FMath::Clamp(FMath::RoundToInt((Target[c] - PBit) * 0.5f), 0, 127);
+					Error += FMath::Square((Candidate[c] << 1 | PBit) - Target[c]);
+				}
+				if (Error < BestError)
+				{
+					BestError = Error;
+					PBits[e] = PBit;
+					FMemory::Memcpy(Quantized[e], Candidate, sizeof(Candidate));
+				}
+			}
+
+			for (int32 c = 0; c < 4; c++)
+			{
+				Endpoints[e][c] = Quantized[e][c] << 1 | PBits[e];
+			}
+		}
+
+		// Nearest palette entry per texel
+		int32 Indices[16];
+		for (int32 p = 0; p < 16; p++)
+		{
+			int32 BestError = MAX_int32;
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				int32 Error = 0;
+				for (int32 c = 0; c < 4; c++)
+				{
+					Error += FMath::Square(BC7Interpolate(Endpoints[0][c], Endpoints[1][c], Index) - Texels[p][c]);
+				}
+				if (Error < BestError)
+				{
+					BestError = Error;
+					Indices[p] = Index;
+				}
+			}
+		}
+
+		// The anchor index is stored without its top bit, swapping the endpoints mirrors the (symmetric) palette
+		if (Indices[0] & 8)
+		{
+			Swap(Quantized[0], Quantized[1]);
+			Swap(PBits[0], PBits[1]);
+			for (int32& Index : Indices)
+			{
+				Index = 15 - Index;
+			}
+		}
+
+		FMemory::Memzero(OutBlock);
+		int32 BitOffset = 0;
+		auto WriteBits = [&OutBlock, &BitOffset](uint32 Value, int32 NumBits)
+		{
+			for (int32 Bit = 0; Bit < NumBits; Bit++, BitOffset++)
+			{
+				OutBlock[BitOffset >> 3] |= static_cast<uint8>(((Value >> Bit) & 1) << (BitOffset & 7));
+			}
+		};
+
+		WriteBits(1 << 6, 7);  // Mode 6
+		for (int32 c = 0; c < 4; c++)
+		{
+			WriteBits(Quantized[0][c], 7);
+			WriteBits(Quantized[1][c], 7);
+		}
+		WriteBits(PBits[0], 1);
+		WriteBits(PBits[1], 1);
+		WriteBits(Indices[0], 3);
+		for (int32 p = 1; p < 16; p++)
+		{
+			WriteBits(Indices[p], 4);
+		}
+	}
+
+	/** Decode a block written by EncodeBC7Block, for RHIs without BC7 support */
+	void DecodeBC7Block(const uint8* Block, uint8 (&OutTexels)[16][4])
+	{
+		int32 BitOffset = 0;
+		auto ReadBits = [Block, &BitOffset](int32 NumBits)
+		{
+			uint32 Value = 0;
+			for (int32 Bit = 0; Bit < NumBits; Bit++, BitOffset++)
+			{
+				Value |= ((Block[BitOffset >> 3] >> (BitOffset & 7)) & 1u) << Bit;
+			}
+			return Value;
+		};
+
+		if (ReadBits(7) != 1 << 6)
+		{
+			FMemory::Memzero(OutTexels);
+			return;
+		}
+
+		int32 Endpoints[2][4];
+		for (int32 c = 0; c < 4; c++)
+		{
+			Endpoints[0][c] = ReadBits(7) << 1;
+			Endpoints[1][c] = ReadBits(7) << 1;
+		}
+		const uint32 PBit0 = ReadBits(1);
+		const uint32 PBit1 = ReadBits(1);
+		for (int32 c = 0; c < 4; c++)
+		{
+			Endpoints[0][c] |= PBit0;
+			Endpoints[1][c] |= PBit1;
+		}
+
+		for (int32 p = 0; p < 16; p++)
+		{
+			const int32 Index = ReadBits(p == 0 ? 3 : 4);
+			for (int32 c = 0; c < 4; c++)
+			{
+				OutTexels[p][c] = static_cast<uint8>(BC7Interpolate(Endpoints[0][c], Endpoints[1][c], Index));
+			}
+		}
+	}
+
+	/** Natural log of a scale, clamped so degenerate (zero) scales stay finite */
+	FVector3f LogScale(const FVector3f& Scale)
+	{
+		return FVector3f(
+			FMath::Loge(FMath::Max(Scale.X, 1e-12f)),
+			FMath::Loge(FMath::Max(Scale.Y, 1e-12f)),
+			FMath::Loge(FMath::Max(Scale.Z, 1e-12f)));
+	}
+
+	/**
+	 * Write a splat's 3D covariance R * diag(scale^2) * R^T as 6 halfs (xx, xy, xz, yy, yz, zz)
+	 * Matches CalcCovariance3D in the shaders; InvScale brings the values into half range.
+	 */
+	void WriteCovariance(uint8* Dest, const FGaussianSplatData& Splat, float InvScale)
+	{
+		const FQuat4f Rotation = GaussianSplattingUtils::NormalizeQuat(Splat.Rotation);
+		const FVector3f Axes[3] = {
+			Rotation.RotateVector(FVector3f::XAxisVector),
+			Rotation.RotateVector(FVector3f::YAxisVector),
+			Rotation.RotateVector(FVector3f::ZAxisVector) };
+		const FVector3f Variance = Splat.Scale * Splat.Scale * InvScale;
+
+		auto Entry = [&](int32 Row, int32 Col)
+		{
+			return Axes[0][Row] * Axes[0][Col] * Variance.X + Axes[1][Row] * Axes[1][Col] * Variance.Y + Axes[2][Row] * Axes[2][Col] * Variance.Z;
+		};
+		const FFloat16 Half[6] = { FFloat16(Entry(0, 0)), FFloat16(Entry(0, 1)), FFloat16(Entry(0, 2)),
+			FFloat16(Entry(1, 1)), FFloat16(Entry(1, 2)), FFloat16(Entry(2, 2)) };
+		FMemory::Memcpy(Dest, Half, sizeof(Half));
+	}
+
+	/** Number of SH coefficients (per channel) stored for a band count */
+	int32 GetNumSHCoeffsForBands(int32 Bands)
+	{
+		return Bands <= 0 ? 0 : FMath::Min(Bands * Bands + 2 * Bands, GaussianSplattingConstants::NumSHCoefficients);
+	}
+
+	/** Squared distance between two SH vectors, giving up once it exceeds Limit */
+	float SHDistanceSquared(const float* RESTRICT A, const float* RESTRICT B, int32 Dim, float Limit)
+	{
+		float Dist = 0.0f;
+		for (int32 d = 0; d < Dim; d++)
+		{
+			const float Delta = A[d] - B[d];
+			Dist += Delta * Delta;
+			if (Dist >= Limit)
+			{
+				break;
+			}
+		}
+		return Dist;
+	}
+
+	/** Index of the palette entry closest to Value */
+	int32 FindNearestSHCluster(const float* Value, const TArray<float>& Palette, int32 NumClusters, int32 Dim)
+	{
+		int32 BestIndex = 0;
+		float BestDist = UE_MAX_FLT;
+		for (int32 c = 0; c < NumClusters; c++)
+		{
+			const float Dist = SHDistanceSquared(Value, &Palette[c * Dim], Dim, BestDist);
+			if (Dist < BestDist)
+			{
+				BestDist = Dist;
+				BestIndex = c;
+			}
+		}
+		return BestIndex;
+	}
+
+	/**
+	 * Cluster per-splat SH vectors into a palette with mini-batch k-means
+	 * @param Values SplatCount x Dim SH values
+	 * @param NumClusters Requested palette size (clamped to the splat count)
+	 * @param OutPalette NumClusters x Dim centroids
+	 * @param OutIndices Palette index per splat
+	 */
+	void ClusterSH(const TArray<float>& Values, int32 Dim, int32 NumClusters, TArray<float>& OutPalette, TArray<uint16>& OutIndices)
+	{
+		const int32 NumValues = Values.Num() / Dim;
+		NumClusters = FMath::Min(NumClusters, NumValues);
+
+		// Deterministic seeding so reimports produce identical assets
+		FRandomStream Random(0x5348);
+
+		OutPalette.SetNumUninitialized(NumClusters * Dim);
+		for (int32 c = 0; c < NumClusters; c++)
+		{
+			const int32 Source = NumValues > NumClusters ? Random.RandHelper(NumValues) : c;
+			FMemory::Memcpy(&OutPalette[c * Dim], &Values[Source * Dim], Dim * sizeof(float));
+		}
+
+		// Mini-batch updates (Sculley 2010): assign a random batch in parallel, then move each
+		// centroid towards its batch members with a per-centroid decaying learning rate
+		constexpr int32 NumIterations = 32;
+		const int32 BatchSize = FMath::Min(NumValues, FMath::Max(NumClusters * 4, 64 * 1024));
+		TArray<int32> Batch;
+		TArray<int32> BatchAssignment;
+		TArray<int32> ClusterCounts;
+		Batch.SetNumUninitialized(BatchSize);
+		BatchAssignment.SetNumUninitialized(BatchSize);
+		ClusterCounts.SetNumZeroed(NumClusters);
+
+		for (int32 Iteration = 0; Iteration < NumIterations && NumValues > NumClusters; Iteration++)
+		{
+			for (int32 b = 0; b < BatchSize; b++)
+			{
+				Batch[b] = Random.RandHelper(NumValues);
+			}
+
+			ParallelFor(BatchSize, [&](int32 b)
+			{
+				BatchAssignment[b] = FindNearestSHCluster(&Values[Batch[b] * Dim], OutPalette, NumClusters, Dim);
+			});
+
+			for (int32 b = 0; b < BatchSize; b++)
+			{
+				const int32 Cluster = BatchAssignment[b];
+				const float Rate = 1.0f / ++ClusterCounts[Cluster];
+				float* Centroid = &OutPalette[Cluster * Dim];
+				const float* Value = &Values[Batch[b] * Dim];
+				for (int32 d = 0; d < Dim; d++)
+				{
+					Centroid[d] += (Value[d] - Centroid[d]) * Rate;
+				}
+			}
+		}
+
+		OutIndices.SetNumUninitialized(NumValues);
+		ParallelFor(NumValues, [&](int32 i)
+		{
+			OutIndices[i] = static_cast<uint16>(FindNearestSHCluster(&Values[i * Dim], OutPalette, NumClusters, Dim));
+		});
+	}
+
+	/**
+	 * Eigen decomposition of a symmetric 3x3 matrix with cyclic Jacobi rotations
+	 * @param OutVectors Column k is the unit eigenvector of OutValues[k]
+	 */
+	void EigenSymmetric3x3(const double InMatrix[3][3], double OutValues[3], double OutVectors[3][3])
+	{
+		double A[3][3];
+		FMemory::Memcpy(A, InMatrix, sizeof(A));
+		for (int32 i = 0; i < 3; i++)
+		{
+			for (int32 j = 0; j < 3; j++)
+			{
+				OutVectors[i][j] = i == j ? 1.0 : 0.0;
+			}
+		}
+
+		constexpr int32 Pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+		for (int32 Sweep = 0; Sweep < 16; Sweep++)
+		{
+			if (A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2] < 1e-30)
+			{
+				break;
+			}
+
+			for (const int32* Pair : Pairs)
+			{
+				const int32 P = Pair[0];
+				const int32 Q = Pair[1];
+				if (FMath::Abs(A[P][Q]) < 1e-30)
+				{
+					continue;
+				}
+
+				// Rotation that zeroes A[P][Q]
+				const double Theta = (A[Q][Q] - A[P][P]) / (2.0 * A[P][Q]);
+				const double T = (Theta >= 0.0 ? 1.0 : -1.0) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1.0));
+				const double C = 1.0 / FMath::Sqrt(T * T + 1.0);
+				const double S = T * C;
+
+				for (int32 k = 0; k < 3; k++)
+				{
+					const double AkP = A[k][P];
+					const double AkQ = A[k][Q];
+					A[k][P] = C * AkP - S * AkQ;
+					A[k][Q] = S * AkP + C * AkQ;
+				}
+				for (int32 k = 0; k < 3; k++)
+				{
+					const double APk = A[P][k];
+					const double AQk = A[Q][k];
+					A[P][k] = C * APk - S * AQk;
+					A[Q][k] = S * APk + C * AQk;
+				}
+				for (int32 k = 0; k < 3; k++)
+				{
+					const double VkP = OutVectors[k][P];
+					const double VkQ = OutVectors[k][Q];
+					OutVectors[k][P] = C * VkP - S * VkQ;
+					OutVectors[k][Q] = S * VkP + C * VkQ;
+				}
+			}
+		}
+
+		for (int32 k = 0; k < 3; k++)
+		{
+			OutValues[k] = A[k][k];
+		}
+	}
+
+	/** Projected footprint of a splat, the product of its two largest axes */
+	float GetSplatArea(const FVector3f& Scale)
+	{
+		const float Min = Scale.GetMin();
+		return Min > 0.0f ? (Scale.X * Scale.Y * Scale.Z) / Min : 0.0f;
+	}
+
+	/**
+	 * Merge splats into one Gaussian that matches their opacity-weighted mean and covariance
+	 * Opacity is chosen so the merged footprint keeps the summed coverage of the inputs.
+	 */
+	FGaussianSplatData MergeSplats(TConstArrayView<FGaussianSplatData> Splats)
+	{
+		double TotalWeight = 0.0;
+		double TotalCoverage = 0.0;
+		FVector3d Mean = FVector3d::ZeroVector;
+		for (const FGaussianSplatData& Splat : Splats)
+		{
+			const double Coverage = (double)Splat.Opacity * GetSplatArea(Splat.Scale);
+			const double Weight = FMath::Max(Coverage, 1e-12);
+			TotalWeight += Weight;
+			TotalCoverage += Coverage;
+			Mean += FVector3d(Splat.Position) * Weight;
+		}
+		Mean /= TotalWeight;
+
+		// Covariance of the mixture: each splat's own covariance plus the spread of the centers
+		double Covariance[3][3] = {};
+		FGaussianSplatData Merged;
+		FMemory::Memzero(Merged.SH, sizeof(Merged.SH));
+		FVector3d SH_DC = FVector3d::ZeroVector;
+		FVector3d SH[GaussianSplattingConstants::NumSHCoefficients];
+		for (FVector3d& Coeff : SH)
+		{
+			Coeff = FVector3d::ZeroVector;
+		}
+
+		for (const FGaussianSplatData& Splat : Splats)
+		{
+			const double Weight = FMath::Max((double)Splat.Opacity * GetSplatArea(Splat.Scale), 1e-12) / TotalWeight;
+			const FQuat4f Rotation = GaussianSplattingUtils::NormalizeQuat(Splat.Rotation);
+			const FVector3d Axes[3] = {
+				FVector3d(Rotation.RotateVector(FVector3f::XAxisVector)),
+				FVector3d(Rotation.RotateVector(FVector3f::YAxisVector)),
+				FVector3d(Rotation.RotateVector(FVector3f::ZAxisVector)) };
+			const FVector3d Variance = FVector3d(Splat.Scale) * FVector3d(Splat.Scale);
+			const FVector3d Offset = FVector3d(Splat.Position) - Mean;
+
+			for (int32 i = 0; i < 3; i++)
+			{
+				for (int32 j = 0; j < 3; j++)
+				{
+					double Value = Offset[i] * Offset[j];
+					for (int32 k = 0; k < 3; k++)
+					{
+						Value += Axes[k][i] * Axes[k][j] * Variance[k];
+					}
+					Covariance[i][j] += Weight * Value;
+				}
+			}
+
+			SH_DC += FVector3d(Splat.SH_DC) * Weight;
+			for (int32 c = 0; c < GaussianSplattingConstants::NumSHCoefficients; c++)
+			{
+				SH[c] += FVector3d(Splat.SH[c]) * Weight;
+			}
+		}
+
+		double Eigenvalues[3];
+		double Eigenvectors[3][3];
+		EigenSymmetric3x3(Covariance, Eigenvalues, Eigenvectors);
+
+		FVector3f Axes[3];
+		for (int32 k = 0; k < 3; k++)
+		{
+			Axes[k] = FVector3f((float)Eigenvectors[0][k], (float)Eigenvectors[1][k], (float)Eigenvectors[2][k]);
+			Merged.Scale[k] = (float)FMath::Sqrt(FMath::Max(Eigenvalues[k], 1e-18));
+		}
+
+		// Keep the eigenvector basis right-handed so it is a rotation
+		if (FVector3f::DotProduct(FVector3f::CrossProduct(Axes[0], Axes[1]), Axes[2]) < 0.0f)
+		{
+			Axes[2] = -Axes[2];
+		}
+
+		Merged.Position = FVector3f(Mean);
+		Merged.Rotation = GaussianSplattingUtils::NormalizeQuat(FQuat4f(FMatrix44f(Axes[0], Axes[1], Axes[2], FVector3f::ZeroVector)));
+		Merged.Opacity = (float)FMath::Clamp(TotalCoverage / FMath::Max((double)GetSplatArea(Merged.Scale), 1e-12), 0.0, 1.0);
+		Merged.SH_DC = FVector3f(SH_DC);
+		for (int32 c = 0; c < GaussianSplattingConstants::NumSHCoefficients; c++)
+		{
+			Merged.SH[c] = FVector3f(SH[c]);
+		}
+		return Merged;
+	}
+
+	/**
+	 * Encode one SH entry (a splat, or a palette entry) into the band-planar layout
+	 * @param Coeffs Interleaved RGB coefficients of the entry
+	 * @param RangeMin/RangeMax Per-channel bounds Norm11/Norm6 coefficients are normalized against
+	 */
+	void WriteSHEntry(uint8* DataPtr, const uint32 BandOffsets[4], int32 SHBands, EGaussianSHFormat CoeffFormat, int32 Entry,
+		const float* Coeffs, const FVector3f& RangeMin, const FVector3f& RangeMax)
+	{
+		const int32 CoeffBytes = UGaussianSplatAsset::GetSHCoefficientBytes(CoeffFormat);
+
+		for (int32 Band = 1; Band <= SHBands; Band++)
+		{
+			const int32 FirstCoeff = Band * Band - 1;
+			uint8* EntryPtr = DataPtr + BandOffsets[Band - 1] + static_cast<int64>(Entry) * UGaussianSplatAsset::GetSHBandStride(CoeffFormat, Band);
+
+			for (int32 k = 0; k < 2 * Band + 1; k++)
+			{
+				const int32 c = FirstCoeff + k;
+				const FVector3f Value(Coeffs[c * 3 + 0], Coeffs[c * 3 + 1], Coeffs[c * 3 + 2]);
+				uint8* CoeffPtr = EntryPtr + k * CoeffBytes;
+
+				switch (CoeffFormat)
+				{
+				case EGaussianSHFormat::Float32:
+					FMemory::Memcpy(CoeffPtr, &Value, sizeof(FVector3f));
+					break;
+				case EGaussianSHFormat::Norm11:
+				case EGaussianSHFormat::Norm6:
+				{
+					const FVector3f Norm(
+						NormalizeToRange(Value.X, RangeMin.X, RangeMax.X),
+						NormalizeToRange(Value.Y, RangeMin.Y, RangeMax.Y),
+						NormalizeToRange(Value.Z, RangeMin.Z, RangeMax.Z));
+					if (CoeffFormat == EGaussianSHFormat::Norm11)
+					{
+						const uint32 Packed = GaussianSplattingUtils::EncodeFloat3ToNorm11(Norm);
+						FMemory::Memcpy(CoeffPtr, &Packed, sizeof(Packed));
+					}
+					else
+					{
+						const uint16 Packed = GaussianSplattingUtils::EncodeFloat3ToNorm565(Norm);
+						FMemory::Memcpy(CoeffPtr, &Packed, sizeof(Packed));
+					}
+					break;
+				}
+				case EGaussianSHFormat::Float16:
+				default:
+				{
+					const FFloat16 Half[3] = { FFloat16(Value.X), FFloat16(Value.Y), FFloat16(Value.Z) };
+					FMemory::Memcpy(CoeffPtr, Half, sizeof(Half));
+					break;
+				}
+				}
+			}
+		}
+	}
+}
+
+using namespace GaussianSplatAssetPrivate;
 
 UGaussianSplatAsset::UGaussianSplatAsset()
+	: RenderDataId(NextRenderDataId++)
 {
 	BoundingBox.Init();
 }
@@ -48,9 +781,32 @@ void UGaussianSplatAsset::Serialize(FArchive& Ar)
 		Ar << SplatCount;
 		Ar << BoundingBox;
 		Ar << PositionFormat;
+		if (Version >= 3)
+		{
+			Ar << ScaleFormat;
+		}
 		Ar << ColorFormat;
 		Ar << SHFormat;
 		Ar << SHBands;
+		if (Version >= 4)
+		{
+			Ar << SHPaletteSize;
+		}
+		if (Version >= 5)
+		{
+			Ar << LODLevels;
+			Ar << NumLODLevels;
+		}
+		if (Version >= 6)
+		{
+			Ar << bPrecomputedCovariance;
+			Ar << bPrecomputeCovariance;
+		}
+		if (Version >= 7)
+		{
+			Ar << ShadowSplatBudget;
+			Ar << ShadowSplats;
+		}
 		Ar << SourceFilePath;
 		Ar << ImportQuality;
 		Ar << ColorTextureWidth;
@@ -127,81 +883,400 @@ void UGaussianSplatAsset::Serialize(FArchive& Ar)
 			UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset: Converted legacy v1 asset to v2 bulk data format"));
 		}
 	}
+
+	if (Ar.IsLoading())
+	{
+		LoadedAssetVersion = Version;
+
+		if (Version < 3)
+		{
+			// Versions 1-2 stored unquantized Float32 positions and a 28 byte float rotation/scale layout
+			PositionFormat = EGaussianPositionFormat::Float32;
+			ScaleFormat = EGaussianPositionFormat::Float32;
+		}
+		if (Version < 4)
+		{
+			// Versions 1-3 stored Float16 SH interleaved per splat
+			SHFormat = EGaussianSHFormat::Float16;
+			SHPaletteSize = 0;
+		}
+		if (Version < 5)
+		{
+			// Versions 1-4 stored the imported splats only
+			LODLevels.Reset();
+			if (SplatCount > 0)
+			{
+				FGaussianSplatLODLevel& Level = LODLevels.AddDefaulted_GetRef();
+				Level.NumSplats = SplatCount;
+			}
+			NumLODLevels = 1;
+		}
+		if (Version < 6)
+		{
+			// Versions 1-5 always stored rotation and scale
+			bPrecomputedCovariance = false;
+			bPrecomputeCovariance = false;
+		}
+		if (Version < 7)
+		{
+			// Versions 1-6 had no shadow proxy, it is built on reimport
+			ShadowSplats.Reset();
+		}
+	}
+}
+
+void UGaussianSplatAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	if (LoadedAssetVersion < 3)
+	{
+		ConvertLegacyRotationScale();
+	}
+	if (LoadedAssetVersion < 4)
+	{
+		ConvertLegacySH();
+	}
+	LoadedAssetVersion = GAUSSIAN_SPLAT_ASSET_VERSION;
+
+	const int64 ColorDataSize = ColorTextureBulkData.GetBulkDataSize();
+	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset::PostLoad - SplatCount=%d, ColorTextureBulkData.Size=%lld, Width=%d, Height=%d"),
+		SplatCount, ColorDataSize, ColorTextureWidth, ColorTextureHeight);
+
+	// Recreate the ColorTexture from the stored bulk data
+	if (ColorDataSize > 0 && ColorTextureWidth > 0 && ColorTextureHeight > 0)
+	{
+		CreateColorTextureFromData();
+		UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset::PostLoad - ColorTexture recreated successfully"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GaussianSplatAsset::PostLoad - No ColorTextureBulkData to restore (might be old asset format)"));
+	}
+}
+
+#if WITH_EDITOR
+void UGaussianSplatAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+int64 UGaussianSplatAsset::GetMemoryUsage() const
+{
+	int64 TotalBytes = 0;
+
+	TotalBytes += PositionBulkData.GetBulkDataSize();
+	TotalBytes += OtherBulkData.GetBulkDataSize();
+	TotalBytes += SHBulkData.GetBulkDataSize();
+	TotalBytes += ChunkData.Num() * sizeof(FGaussianChunkInfo);
+	TotalBytes += ShadowSplats.Num() * sizeof(FGaussianSplatShadowSplat);
+	TotalBytes += ColorTextureBulkData.GetBulkDataSize();
+
+	if (ColorTexture)
+	{
+		TotalBytes += ColorTexture->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+	}
+
+	return TotalBytes;
+}
+
+int64 UGaussianSplatAsset::GetGPUMemoryUsage() const
+{
+	if (!IsValid())
+	{
+		return 0;
+	}
+
+	// The buffers FGaussianSplatGPUResources creates: splat streams, SH (a dummy without bands), chunk bounds and the quad indices
+	int64 TotalBytes = PositionBulkData.GetBulkDataSize() + OtherBulkData.GetBulkDataSize();
+	TotalBytes += FMath::Max<int64>(SHBulkData.GetBulkDataSize(), 16);
+	TotalBytes += FMath::Max(ChunkData.Num(), 1) * sizeof(FGaussianChunkInfo);
+	TotalBytes += 6 * sizeof(uint16);
+	return TotalBytes;
+}
+
+void UGaussianSplatAsset::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	// Bulk data only counts while loaded, streaming reads it from disk otherwise; the color texture reports itself
+	for (const FByteBulkData* BulkData : { &PositionBulkData, &OtherBulkData, &SHBulkData, &ColorTextureBulkData })
+	{
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(BulkData->IsBulkDataLoaded() ? BulkData->GetBulkDataSize() : 0);
+	}
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ChunkData.GetAllocatedSize() + ShadowSplats.GetAllocatedSize() + LODLevels.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedVideoMemoryBytes(GetGPUMemoryUsage());
+}
+
+void UGaussianSplatAsset::InitializeFromSplatData(const TArray<FGaussianSplatData>& InSourceSplats, EGaussianQualityLevel InQuality)
+{
+	ImportQuality = InQuality;
+	LODLevels.Reset();
+	RenderDataId = NextRenderDataId++;
+
+	if (InSourceSplats.Num() == 0)
+	{
+		SplatCount = 0;
+		return;
+	}
+
+	// Every level is stored in the same buffers, so the compression below covers all of them
+	TArray<FGaussianSplatData> InSplats;
+	BuildLODLevels(InSourceSplats, InSplats);
+	BuildShadowSplats(InSplats);
+	SplatCount = InSplats.Num();
+
+	// Positions and scales are quantized against per-chunk bounds, precision depends on quality
+	GetVectorFormatsForQuality(InQuality, PositionFormat, ScaleFormat);
+	ColorFormat = GetColorFormatForQuality(InQuality);
+	SHFormat = GetSHFormatForQuality(InQuality);
+	bPrecomputedCovariance = bPrecomputeCovariance;
+
+	// Bounds, chunk bounds and every stream in one chunk-parallel sweep over the splats
+	BuildStreams(InSplats);
+	CreateColorTextureFromData();  // Create the runtime texture
+
+	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset: Initialized with %d splats in %d LOD levels (position %d B, rotation+scale %d B, color %d B, SH %d B per splat), memory: %lld bytes"),
+		SplatCount, LODLevels.Num(), GetPositionBytesPerSplat(PositionFormat), GetOtherBytesPerSplat(ScaleFormat, bPrecomputedCovariance),
+		GetColorBytesPerSplat(ColorFormat), GetSHBytesPerSplat(SHFormat, SHBands), GetMemoryUsage());
 }
 
-void UGaussianSplatAsset::PostLoad()
+#if WITH_EDITOR
+bool UGaussianSplatAsset::InitializeFromDerivedDataCache(const FString& InSourceHash, EGaussianQualityLevel InQuality)
 {
-	Super::PostLoad();
+	if (InSourceHash.IsEmpty())
+	{
+		return false;
+	}
 
-	const int64 ColorDataSize = ColorTextureBulkData.GetBulkDataSize();
-	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset::PostLoad - SplatCount=%d, ColorTextureBulkData.Size=%lld, Width=%d, Height=%d"),
-		SplatCount, ColorDataSize, ColorTextureWidth, ColorTextureHeight);
+	TArray<uint8> Payload;
+	if (!GetDerivedDataCacheRef().GetSynchronous(*GetDerivedDataKey(InSourceHash, InQuality), Payload, GetPathName()))
+	{
+		return false;
+	}
 
-	// Recreate the ColorTexture from the stored bulk data
-	if (ColorDataSize > 0 && ColorTextureWidth > 0 && ColorTextureHeight > 0)
+	FMemoryReader Ar(Payload, /*bIsPersistent*/ true);
+	SerializeDerivedData(Ar);
+	if (Ar.IsError() || !IsValid())
 	{
-		CreateColorTextureFromData();
-		UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset::PostLoad - ColorTexture recreated successfully"));
+		UE_LOG(LogTemp, Warning, TEXT("GaussianSplatAsset: Discarding corrupt derived data for %s"), *GetPathName());
+		return false;
 	}
-	else
+
+	ImportQuality = InQuality;
+	SourceFileHash = InSourceHash;
+	RenderDataId = NextRenderDataId++;
+	CreateColorTextureFromData();
+
+	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset: Initialized %d splats from derived data (%d bytes)"), SplatCount, Payload.Num());
+	return true;
+}
+
+void UGaussianSplatAsset::SaveToDerivedDataCache()
+{
+	if (SourceFileHash.IsEmpty() || !IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GaussianSplatAsset::PostLoad - No ColorTextureBulkData to restore (might be old asset format)"));
+		return;
 	}
+
+	TArray<uint8> Payload;
+	FMemoryWriter Ar(Payload, /*bIsPersistent*/ true);
+	SerializeDerivedData(Ar);
+	GetDerivedDataCacheRef().Put(*GetDerivedDataKey(SourceFileHash, ImportQuality), Payload, GetPathName());
 }
 
-#if WITH_EDITOR
-void UGaussianSplatAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+FString UGaussianSplatAsset::GetDerivedDataKey(const FString& InSourceHash, EGaussianQualityLevel InQuality) const
 {
-	Super::PostEditChangeProperty(PropertyChangedEvent);
+	// Everything the encode depends on besides the source: quality, LOD and SH settings and the stored layout
+	const FString KeySuffix = FString::Printf(TEXT("%s_Q%d_L%d_SH%d_C%d_S%d_V%d"),
+		*InSourceHash, static_cast<int32>(InQuality), FMath::Clamp(NumLODLevels, 1, GaussianSplattingConstants::MaxLODLevels),
+		SHBands, bPrecomputeCovariance ? 1 : 0, FMath::Max(ShadowSplatBudget, 0), GAUSSIAN_SPLAT_ASSET_VERSION);
+	return FDerivedDataCacheInterface::BuildCacheKey(TEXT("GAUSSIANSPLAT"), GAUSSIAN_SPLAT_DERIVEDDATA_VER, *KeySuffix);
 }
-#endif
 
-int64 UGaussianSplatAsset::GetMemoryUsage() const
+void UGaussianSplatAsset::SerializeDerivedData(FArchive& Ar)
 {
-	int64 TotalBytes = 0;
+	Ar << SplatCount;
+	Ar << LODLevels;
+	Ar << BoundingBox;
+	Ar << PositionFormat;
+	Ar << ScaleFormat;
+	Ar << bPrecomputedCovariance;
+	Ar << ColorFormat;
+	Ar << SHFormat;
+	Ar << SHPaletteSize;
+	Ar << ColorTextureWidth;
+	Ar << ColorTextureHeight;
+	Ar << ChunkData;
+	Ar << ShadowSplats;
+
+	TArray<uint8> PositionData, OtherData, SHData, ColorData;
+	if (Ar.IsSaving())
+	{
+		GetPositionData(PositionData);
+		GetOtherData(OtherData);
+		GetSHData(SHData);
+		GetColorTextureData(ColorData);
+	}
 
-	TotalBytes += PositionBulkData.GetBulkDataSize();
-	TotalBytes += OtherBulkData.GetBulkDataSize();
-	TotalBytes += SHBulkData.GetBulkDataSize();
-	TotalBytes += ChunkData.Num() * sizeof(FGaussianChunkInfo);
-	TotalBytes += ColorTextureBulkData.GetBulkDataSize();
+	Ar << PositionData;
+	Ar << OtherData;
+	Ar << SHData;
+	Ar << ColorData;
 
-	if (ColorTexture)
+	if (Ar.IsLoading() && !Ar.IsError())
 	{
-		TotalBytes += ColorTexture->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+		SetBulkData(PositionBulkData, PositionData);
+		SetBulkData(OtherBulkData, OtherData);
+		SetBulkData(ColorTextureBulkData, ColorData);
+		if (SHData.Num() > 0)
+		{
+			SetBulkData(SHBulkData, SHData);
+		}
+		else
+		{
+			SHBulkData.RemoveBulkData();
+		}
 	}
-
-	return TotalBytes;
 }
+#endif
 
-void UGaussianSplatAsset::InitializeFromSplatData(const TArray<FGaussianSplatData>& InSplats, EGaussianQualityLevel InQuality)
+void UGaussianSplatAsset::BuildLODLevels(const TArray<FGaussianSplatData>& InSplats, TArray<FGaussianSplatData>& OutSplats)
 {
-	SplatCount = InSplats.Num();
-	ImportQuality = InQuality;
+	constexpr int32 SplatsPerChunk = GaussianSplattingConstants::SplatsPerChunk;
+	constexpr int32 MergeFactor = GaussianSplattingConstants::LODMergeFactor;
+	const int32 MaxLevels = FMath::Clamp(NumLODLevels, 1, GaussianSplattingConstants::MaxLODLevels);
+
+	// Reserve the largest possible set of levels, so appending them never reallocates the full detail copy
+	int32 MaxTotalSplats = InSplats.Num();
+	for (int32 Level = 1, LevelSplats = InSplats.Num(); Level < MaxLevels; Level++)
+	{
+		LevelSplats = FMath::DivideAndRoundUp(LevelSplats, MergeFactor);
+		MaxTotalSplats = Align(MaxTotalSplats, SplatsPerChunk) + LevelSplats;
+	}
+	OutSplats.Reset(MaxTotalSplats);
+	OutSplats.Append(InSplats);
+	LODLevels.Reset();
+	FGaussianSplatLODLevel& FullDetail = LODLevels.AddDefaulted_GetRef();
+	FullDetail.NumSplats = InSplats.Num();
+
+	// Neighbours in the (Morton) order are merged, so each level stays spatially coherent for the next one
+	while (LODLevels.Num() < MaxLevels)
+	{
+		const FGaussianSplatLODLevel Source = LODLevels.Last();
+		const int32 NumMerged = FMath::DivideAndRoundUp(Source.NumSplats, MergeFactor);
+		if (NumMerged < SplatsPerChunk)
+		{
+			break;
+		}
+
+		// Levels start on a chunk boundary; the gap repeats the level's last splat so chunk bounds stay tight
+		const int32 FirstSplat = Align(OutSplats.Num(), SplatsPerChunk);
+		while (OutSplats.Num() < FirstSplat)
+		{
+			OutSplats.Add(OutSplats.Last());
+		}
+
+		OutSplats.SetNum(FirstSplat + NumMerged);
+		ParallelFor(NumMerged, [&](int32 i)
+		{
+			const int32 Begin = Source.FirstSplat + i * MergeFactor;
+			const int32 End = FMath::Min(Begin + MergeFactor, Source.FirstSplat + Source.NumSplats);
+			OutSplats[FirstSplat + i] = MergeSplats(MakeArrayView(OutSplats.GetData() + Begin, End - Begin));
+		});
+		FGaussianSplatLODLevel& Level = LODLevels.AddDefaulted_GetRef();
+		Level.FirstSplat = FirstSplat;
+		Level.NumSplats = NumMerged;
+	}
+}
 
-	if (SplatCount == 0)
+void UGaussianSplatAsset::BuildShadowSplats(const TArray<FGaussianSplatData>& InSplats)
+{
+	constexpr float AlphaThreshold = GaussianSplattingConstants::ShadowAlphaThreshold;
+	ShadowSplats.Reset();
+	const int32 Budget = FMath::Max(ShadowSplatBudget, 0);
+	if (Budget == 0 || LODLevels.Num() == 0)
 	{
 		return;
 	}
 
-	// Simplified format: Always use Float32 for positions (most reliable)
-	// This avoids complex quantization/dequantization that can cause precision issues
-	PositionFormat = EGaussianPositionFormat::Float32;
-	ColorFormat = EGaussianColorFormat::Float16x4;  // Good balance for colors
-	SHFormat = EGaussianSHFormat::Float16;          // Good balance for SH
+	// Finest level within the budget, else the coarsest one thinned out to it along the (Morton) order
+	int32 LevelIndex = LODLevels.Num() - 1;
+	for (int32 Index = 0; Index < LODLevels.Num(); Index++)
+	{
+		if (LODLevels[Index].NumSplats <= Budget)
+		{
+			LevelIndex = Index;
+			break;
+		}
+	}
+	const FGaussianSplatLODLevel& Level = LODLevels[LevelIndex];
+	const int32 Stride = FMath::DivideAndRoundUp(Level.NumSplats, Budget);
+
+	// Kept splats of a thinned level grow to cover the surface their skipped neighbours covered
+	const float StrideScale = FMath::Sqrt((float)Stride);
+
+	ShadowSplats.Reserve(FMath::DivideAndRoundUp(Level.NumSplats, Stride));
+	for (int32 i = Level.FirstSplat; i < Level.FirstSplat + Level.NumSplats; i += Stride)
+	{
+		// Alpha test: Opacity * exp(-d^2 / 2) stays above the threshold out to d standard deviations
+		const FGaussianSplatData& Splat = InSplats[i];
+		if (Splat.Opacity <= AlphaThreshold)
+		{
+			continue;
+		}
+		const float Extent = FMath::Sqrt(2.0f * FMath::Loge(Splat.Opacity / AlphaThreshold)) * StrideScale;
+		const FQuat4f Rotation = GaussianSplattingUtils::NormalizeQuat(Splat.Rotation);
+
+		FGaussianSplatShadowSplat& ShadowSplat = ShadowSplats.AddDefaulted_GetRef();
+		ShadowSplat.Position = Splat.Position;
+		ShadowSplat.Axes[0] = Rotation.RotateVector(FVector3f::XAxisVector) * (Splat.Scale.X * Extent);
+		ShadowSplat.Axes[1] = Rotation.RotateVector(FVector3f::YAxisVector) * (Splat.Scale.Y * Extent);
+		ShadowSplat.Axes[2] = Rotation.RotateVector(FVector3f::ZAxisVector) * (Splat.Scale.Z * Extent);
+	}
 
-	// Calculate bounds (still useful for culling)
-	CalculateBounds(InSplats);
+	// Largest first, so a lower runtime budget (gs.ShadowSplatBudget) drops the smallest splats
+	ShadowSplats.Sort([](const FGaussianSplatShadowSplat& A, const FGaussianSplatShadowSplat& B)
+	{
+		return GetSplatArea(FVector3f(A.Axes[0].Size(), A.Axes[1].Size(), A.Axes[2].Size())) >
+			GetSplatArea(FVector3f(B.Axes[0].Size(), B.Axes[1].Size(), B.Axes[2].Size()));
+	});
+}
 
-	// Store position data (always Float32 now)
-	CompressPositions(InSplats);
-	CompressRotationScale(InSplats);
-	CreateColorTextureData(InSplats);  // Store raw data for serialization
-	CreateColorTextureFromData();       // Create the runtime texture
-	CompressSH(InSplats);
+void UGaussianSplatAsset::GetVectorFormatsForQuality(EGaussianQualityLevel Quality, EGaussianPositionFormat& OutPositionFormat, EGaussianPositionFormat& OutScaleFormat)
+{
+	switch (Quality)
+	{
+	case EGaussianQualityLevel::VeryHigh:
+		OutPositionFormat = EGaussianPositionFormat::Float32;
+		OutScaleFormat = EGaussianPositionFormat::Float32;
+		break;
+	case EGaussianQualityLevel::High:
+		OutPositionFormat = EGaussianPositionFormat::Norm16;
+		OutScaleFormat = EGaussianPositionFormat::Norm16;
+		break;
+	case EGaussianQualityLevel::Medium:
+		OutPositionFormat = EGaussianPositionFormat::Norm11;
+		OutScaleFormat = EGaussianPositionFormat::Norm11;
+		break;
+	case EGaussianQualityLevel::Low:
+	case EGaussianQualityLevel::VeryLow:
+	default:
+		OutPositionFormat = EGaussianPositionFormat::Norm11;
+		OutScaleFormat = EGaussianPositionFormat::Norm6;
+		break;
+	}
+}
 
-	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset: Initialized with %d splats, memory: %lld bytes"),
-		SplatCount, GetMemoryUsage());
+int32 UGaussianSplatAsset::GetOtherBytesPerSplat(EGaussianPositionFormat InScaleFormat, bool bInPrecomputedCovariance)
+{
+	// 6 halfs of upper-triangular covariance, or 4 bytes smallest-three rotation + scale vector
+	if (bInPrecomputedCovariance)
+	{
+		return 6 * sizeof(FFloat16);
+	}
+	return 4 + GetPositionBytesPerSplat(InScaleFormat);
 }
 
 int32 UGaussianSplatAsset::GetPositionBytesPerSplat(EGaussianPositionFormat Format)
@@ -230,38 +1305,90 @@ int32 UGaussianSplatAsset::GetColorBytesPerSplat(EGaussianColorFormat Format)
 
 int32 UGaussianSplatAsset::GetSHBytesPerSplat(EGaussianSHFormat Format, int32 Bands)
 {
-	// Each band adds more coefficients: band0=1, band1=4, band2=9, band3=16 total
-	int32 NumCoeffs = 0;
-	switch (Bands)
+	// Clustered formats only store a palette index per splat
+	if (IsClusteredSHFormat(Format))
+	{
+		return Bands > 0 ? sizeof(uint16) : 0;
+	}
+
+	int32 TotalBytes = 0;
+	for (int32 Band = 1; Band <= FMath::Min(Bands, GaussianSplattingConstants::MaxSHOrder); Band++)
+	{
+		TotalBytes += GetSHBandStride(Format, Band);
+	}
+	return TotalBytes;
+}
+
+EGaussianColorFormat UGaussianSplatAsset::GetColorFormatForQuality(EGaussianQualityLevel Quality)
+{
+	switch (Quality)
+	{
+	case EGaussianQualityLevel::VeryHigh: return EGaussianColorFormat::Float16x4;
+	case EGaussianQualityLevel::High:
+	case EGaussianQualityLevel::Medium:   return EGaussianColorFormat::Norm8x4;
+	case EGaussianQualityLevel::Low:
+	case EGaussianQualityLevel::VeryLow:
+	default:                              return EGaussianColorFormat::BC7;
+	}
+}
+
+EGaussianSHFormat UGaussianSplatAsset::GetSHFormatForQuality(EGaussianQualityLevel Quality)
+{
+	switch (Quality)
 	{
-	case 0: NumCoeffs = 0; break;  // DC only (stored in color)
-	case 1: NumCoeffs = 3; break;  // 3 coeffs
-	case 2: NumCoeffs = 8; break;  // 3 + 5 coeffs
-	case 3: NumCoeffs = 15; break; // 3 + 5 + 7 coeffs
-	default: NumCoeffs = 15; break;
+	case EGaussianQualityLevel::VeryHigh: return EGaussianSHFormat::Float16;
+	case EGaussianQualityLevel::High:     return EGaussianSHFormat::Norm11;
+	case EGaussianQualityLevel::Medium:   return EGaussianSHFormat::Norm6;
+	case EGaussianQualityLevel::Low:      return EGaussianSHFormat::Cluster16k;
+	case EGaussianQualityLevel::VeryLow:
+	default:                              return EGaussianSHFormat::Cluster4k;
 	}
+}
 
-	// Each coefficient has 3 color channels
-	int32 TotalValues = NumCoeffs * 3;
+int32 UGaussianSplatAsset::GetSHPaletteSizeForFormat(EGaussianSHFormat Format)
+{
+	if (!IsClusteredSHFormat(Format))
+	{
+		return 0;
+	}
+	return 4096 << (static_cast<int32>(Format) - static_cast<int32>(EGaussianSHFormat::Cluster4k));
+}
 
+int32 UGaussianSplatAsset::GetSHCoefficientBytes(EGaussianSHFormat Format)
+{
 	switch (Format)
 	{
-	case EGaussianSHFormat::Float32: return TotalValues * 4;
-	case EGaussianSHFormat::Float16: return TotalValues * 2;
-	case EGaussianSHFormat::Norm11:  return (TotalValues * 11 + 7) / 8; // Approximate
-	case EGaussianSHFormat::Norm6:   return (TotalValues * 6 + 7) / 8;  // Approximate
-	default: return TotalValues * 2; // Assume Float16
+	case EGaussianSHFormat::Float32: return 12; // 3 x float
+	case EGaussianSHFormat::Norm11:  return 4;  // 11.10.11
+	case EGaussianSHFormat::Norm6:   return 2;  // 5.6.5
+	case EGaussianSHFormat::Float16:
+	default:                         return 6;  // 3 x half, also used by cluster palettes
 	}
 }
 
-void UGaussianSplatAsset::CalculateBounds(const TArray<FGaussianSplatData>& InSplats)
+int32 UGaussianSplatAsset::GetSHBandStride(EGaussianSHFormat Format, int32 Band)
 {
-	BoundingBox.Init();
+	// Band 1 has 3 coefficients, band 2 has 5, band 3 has 7
+	return Align((2 * Band + 1) * GetSHCoefficientBytes(Format), 4);
+}
+
+void UGaussianSplatAsset::GetSHBandOffsets(uint32 OutBandOffsets[4]) const
+{
+	const bool bClustered = IsClusteredSHFormat(SHFormat);
+	const int32 NumEntries = bClustered ? SHPaletteSize : SplatCount;
+
+	// Clustered formats start with the per-splat palette indices
+	int64 Offset = bClustered ? GetPaddedBufferSize(static_cast<int64>(SplatCount) * sizeof(uint16)) : 0;
 
-	for (const FGaussianSplatData& Splat : InSplats)
+	for (int32 Band = 1; Band <= GaussianSplattingConstants::MaxSHOrder; Band++)
 	{
-		BoundingBox += FVector(Splat.Position);
+		OutBandOffsets[Band - 1] = static_cast<uint32>(Offset);
+		if (Band <= SHBands)
+		{
+			Offset += GetPaddedBufferSize(static_cast<int64>(NumEntries) * GetSHBandStride(SHFormat, Band));
+		}
 	}
+	OutBandOffsets[3] = static_cast<uint32>(Offset);
 }
 
 TArray<FVector> UGaussianSplatAsset::GetDecompressedPositions() const
@@ -278,14 +1405,23 @@ TArray<FVector> UGaussianSplatAsset::GetDecompressedPositions() const
 
 	// Lock bulk data for reading
 	const uint8* DataPtr = static_cast<const uint8*>(PositionBulkData.LockReadOnly());
-
-	// Simplified: Always Float32 format (12 bytes per position)
-	const int32 BytesPerSplat = 12;
+	const int32 BytesPerSplat = GetPositionBytesPerSplat(PositionFormat);
+	const bool bChunkRelative = PositionFormat != EGaussianPositionFormat::Float32;
 
 	for (int32 i = 0; i < SplatCount; i++)
 	{
-		const float* FloatPtr = reinterpret_cast<const float*>(DataPtr + i * BytesPerSplat);
-		Positions[i] = FVector(FloatPtr[0], FloatPtr[1], FloatPtr[2]);
+		FVector3f Pos = ReadVector(DataPtr + static_cast<int64>(i) * BytesPerSplat, PositionFormat);
+
+		const int32 ChunkIdx = i / GaussianSplattingConstants::SplatsPerChunk;
+		if (bChunkRelative && ChunkData.IsValidIndex(ChunkIdx))
+		{
+			const FGaussianChunkInfo& Chunk = ChunkData[ChunkIdx];
+			Pos.X = FMath::Lerp(Chunk.PosMinMaxX.X, Chunk.PosMinMaxX.Y, Pos.X);
+			Pos.Y = FMath::Lerp(Chunk.PosMinMaxY.X, Chunk.PosMinMaxY.Y, Pos.Y);
+			Pos.Z = FMath::Lerp(Chunk.PosMinMaxZ.X, Chunk.PosMinMaxZ.Y, Pos.Z);
+		}
+
+		Positions[i] = FVector(Pos);
 	}
 
 	PositionBulkData.Unlock();
@@ -293,153 +1429,277 @@ TArray<FVector> UGaussianSplatAsset::GetDecompressedPositions() const
 	return Positions;
 }
 
-void UGaussianSplatAsset::CalculateChunkBounds(const TArray<FGaussianSplatData>& InSplats)
+void UGaussianSplatAsset::BuildStreams(const TArray<FGaussianSplatData>& InSplats)
 {
-	const int32 NumChunks = FMath::DivideAndRoundUp(SplatCount, GaussianSplattingConstants::SplatsPerChunk);
+	constexpr int32 SplatsPerChunk = GaussianSplattingConstants::SplatsPerChunk;
+	const int32 NumChunks = FMath::DivideAndRoundUp(SplatCount, SplatsPerChunk);
+	const int32 NumCoeffs = GetNumSHCoeffsForBands(SHBands);
+	const int32 Dim = NumCoeffs * 3;
+	const bool bClusteredSH = SHBands > 0 && IsClusteredSHFormat(SHFormat);
+	const bool bDirectSH = SHBands > 0 && !bClusteredSH;
+	const bool bChunkRelativePositions = PositionFormat != EGaussianPositionFormat::Float32;
+	const bool bChunkRelativeScales = ScaleFormat != EGaussianPositionFormat::Float32;
+	const bool bNormalizedSH = SHFormat == EGaussianSHFormat::Norm11 || SHFormat == EGaussianSHFormat::Norm6;
+
 	ChunkData.SetNum(NumChunks);
+	ColorTextureWidth = GaussianSplattingConstants::ColorTextureWidth;
+	ColorTextureHeight = GaussianSplattingUtils::GetColorTextureHeight(SplatCount, ColorTextureWidth);
+
+	// Every stream is allocated up front and written in place by the sweep below.
+	// Zeroing covers the buffer padding and the texels past the last splat.
+	const int32 PositionBytesPerSplat = GetPositionBytesPerSplat(PositionFormat);
+	const int64 PositionBytes = GetPaddedBufferSize(static_cast<int64>(SplatCount) * PositionBytesPerSplat);
+	PositionBulkData.Lock(LOCK_READ_WRITE);
+	uint8* PositionPtr = static_cast<uint8*>(PositionBulkData.Realloc(PositionBytes));
+	FMemory::Memzero(PositionPtr, PositionBytes);
+
+	// Layout per splat: 10.10.10.2 smallest-three rotation (4 bytes), then the scale vector.
+	// Float32 scales are stored linear; quantized scales store log(scale) normalized to the chunk's log-scale range.
+	// The precomputed layout stores the covariance instead, divided by the square of the chunk's largest scale.
+	const int32 OtherBytesPerSplat = GetOtherBytesPerSplat(ScaleFormat, bPrecomputedCovariance);
+	const int64 OtherBytes = GetPaddedBufferSize(static_cast<int64>(SplatCount) * OtherBytesPerSplat);
+	OtherBulkData.Lock(LOCK_READ_WRITE);
+	uint8* OtherPtr = static_cast<uint8*>(OtherBulkData.Realloc(OtherBytes));
+	FMemory::Memzero(OtherPtr, OtherBytes);
+
+	// Morton swizzled color and opacity; block-compressed formats are encoded from an RGBA8 image after the sweep
+	const bool bBlockCompressedColor = ColorFormat == EGaussianColorFormat::BC7;
+	const int64 ColorBytes = GetColorTextureBytes(ColorFormat, ColorTextureWidth, ColorTextureHeight);
+	ColorTextureBulkData.Lock(LOCK_READ_WRITE);
+	uint8* ColorPtr = static_cast<uint8*>(ColorTextureBulkData.Realloc(ColorBytes));
+	FMemory::Memzero(ColorPtr, ColorBytes);
 
-	for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ChunkIdx++)
+	TArray<uint8> ColorTexels;
+	if (bBlockCompressedColor)
 	{
-		const int32 StartIdx = ChunkIdx * GaussianSplattingConstants::SplatsPerChunk;
-		const int32 EndIdx = FMath::Min(StartIdx + GaussianSplattingConstants::SplatsPerChunk, SplatCount);
+		ColorTexels.SetNumZeroed(GetColorTextureBytes(EGaussianColorFormat::Norm8x4, ColorTextureWidth, ColorTextureHeight));
+	}
+	uint8* TexelPtr = bBlockCompressedColor ? ColorTexels.GetData() : ColorPtr;
 
-		FGaussianChunkInfo& Chunk = ChunkData[ChunkIdx];
+	// Per-splat SH is encoded in the sweep; clustered SH needs every splat first, so it is gathered for CompressClusteredSH
+	uint32 SHBandOffsets[4] = {};
+	uint8* SHPtr = nullptr;
+	TArray<float> ClusterValues;
+	if (bDirectSH)
+	{
+		SHPaletteSize = 0;
+		GetSHBandOffsets(SHBandOffsets);
+		SHBulkData.Lock(LOCK_READ_WRITE);
+		SHPtr = static_cast<uint8*>(SHBulkData.Realloc(SHBandOffsets[3]));
+		FMemory::Memzero(SHPtr, SHBandOffsets[3]);
+	}
+	else if (bClusteredSH)
+	{
+		ClusterValues.SetNumUninitialized(SplatCount * Dim);
+	}
+
+	// One sweep per chunk: its bounds, then every stream, while the chunk's splats are still in cache
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 StartIdx = ChunkIdx * SplatsPerChunk;
+		const int32 EndIdx = FMath::Min(StartIdx + SplatsPerChunk, SplatCount);
+
+		// Scales span several orders of magnitude, so they are bounded (and quantized) in log space.
+		// SH is bounded per color channel across all stored coefficients, for Norm11/Norm6 SH.
+		FVector3f PosMin(UE_MAX_FLT);
+		FVector3f PosMax(-UE_MAX_FLT);
+		FVector3f LogScaleMin(UE_MAX_FLT);
+		FVector3f LogScaleMax(-UE_MAX_FLT);
+		FVector3f SHMin(UE_MAX_FLT);
+		FVector3f SHMax(-UE_MAX_FLT);
+		for (int32 i = StartIdx; i < EndIdx; i++)
+		{
+			const FGaussianSplatData& Splat = InSplats[i];
+			PosMin = FVector3f::Min(PosMin, Splat.Position);
+			PosMax = FVector3f::Max(PosMax, Splat.Position);
+
+			const FVector3f LogS = LogScale(Splat.Scale);
+			LogScaleMin = FVector3f::Min(LogScaleMin, LogS);
+			LogScaleMax = FVector3f::Max(LogScaleMax, LogS);
 
-		// Initialize with first splat values
-		if (StartIdx < InSplats.Num())
+			for (int32 c = 0; c < NumCoeffs; c++)
+			{
+				SHMin = FVector3f::Min(SHMin, Splat.SH[c]);
+				SHMax = FVector3f::Max(SHMax, Splat.SH[c]);
+			}
+		}
+		if (NumCoeffs == 0)
+		{
+			SHMin = SHMax = FVector3f::ZeroVector;
+		}
+
+		FGaussianChunkInfo& Chunk = ChunkData[ChunkIdx];
+		Chunk.PosMinMaxX = FVector2f(PosMin.X, PosMax.X);
+		Chunk.PosMinMaxY = FVector2f(PosMin.Y, PosMax.Y);
+		Chunk.PosMinMaxZ = FVector2f(PosMin.Z, PosMax.Z);
+		Chunk.ScaleMinMaxX = GaussianSplattingUtils::PackHalf2x16(LogScaleMin.X, LogScaleMax.X);
+		Chunk.ScaleMinMaxY = GaussianSplattingUtils::PackHalf2x16(LogScaleMin.Y, LogScaleMax.Y);
+		Chunk.ScaleMinMaxZ = GaussianSplattingUtils::PackHalf2x16(LogScaleMin.Z, LogScaleMax.Z);
+		Chunk.SHMinMaxR = GaussianSplattingUtils::PackHalf2x16(SHMin.X, SHMax.X);
+		Chunk.SHMinMaxG = GaussianSplattingUtils::PackHalf2x16(SHMin.Y, SHMax.Y);
+		Chunk.SHMinMaxB = GaussianSplattingUtils::PackHalf2x16(SHMin.Z, SHMax.Z);
+
+		// Scales and SH are normalized against the half-precision bounds the shader will see
+		FVector3f ScaleRangeMin, ScaleRangeMax;
+		GaussianSplattingUtils::UnpackHalf2x16(Chunk.ScaleMinMaxX, ScaleRangeMin.X, ScaleRangeMax.X);
+		GaussianSplattingUtils::UnpackHalf2x16(Chunk.ScaleMinMaxY, ScaleRangeMin.Y, ScaleRangeMax.Y);
+		GaussianSplattingUtils::UnpackHalf2x16(Chunk.ScaleMinMaxZ, ScaleRangeMin.Z, ScaleRangeMax.Z);
+
+		// Covariances are stored relative to the largest scale the shader can reconstruct, keeping them within half range
+		const float InvCovarianceScale = FMath::Exp(-2.0f * ScaleRangeMax.GetMax());
+
+		FVector3f SHRangeMin = FVector3f::ZeroVector;
+		FVector3f SHRangeMax = FVector3f::ZeroVector;
+		if (bNormalizedSH)
 		{
-			const FGaussianSplatData& First = InSplats[StartIdx];
-			Chunk.PosMinMaxX = FVector2f(First.Position.X, First.Position.X);
-			Chunk.PosMinMaxY = FVector2f(First.Position.Y, First.Position.Y);
-			Chunk.PosMinMaxZ = FVector2f(First.Position.Z, First.Position.Z);
+			GaussianSplattingUtils::UnpackHalf2x16(Chunk.SHMinMaxR, SHRangeMin.X, SHRangeMax.X);
+			GaussianSplattingUtils::UnpackHalf2x16(Chunk.SHMinMaxG, SHRangeMin.Y, SHRangeMax.Y);
+			GaussianSplattingUtils::UnpackHalf2x16(Chunk.SHMinMaxB, SHRangeMin.Z, SHRangeMax.Z);
 		}
 
-		// Find min/max for this chunk
 		for (int32 i = StartIdx; i < EndIdx; i++)
 		{
 			const FGaussianSplatData& Splat = InSplats[i];
 
-			Chunk.PosMinMaxX.X = FMath::Min(Chunk.PosMinMaxX.X, Splat.Position.X);
-			Chunk.PosMinMaxX.Y = FMath::Max(Chunk.PosMinMaxX.Y, Splat.Position.X);
-			Chunk.PosMinMaxY.X = FMath::Min(Chunk.PosMinMaxY.X, Splat.Position.Y);
-			Chunk.PosMinMaxY.Y = FMath::Max(Chunk.PosMinMaxY.Y, Splat.Position.Y);
-			Chunk.PosMinMaxZ.X = FMath::Min(Chunk.PosMinMaxZ.X, Splat.Position.Z);
-			Chunk.PosMinMaxZ.Y = FMath::Max(Chunk.PosMinMaxZ.Y, Splat.Position.Z);
-		}
-	}
-}
+			// Quantized formats store the position normalized to its chunk's bounding box
+			FVector3f Pos = Splat.Position;
+			if (bChunkRelativePositions)
+			{
+				Pos.X = NormalizeToRange(Pos.X, PosMin.X, PosMax.X);
+				Pos.Y = NormalizeToRange(Pos.Y, PosMin.Y, PosMax.Y);
+				Pos.Z = NormalizeToRange(Pos.Z, PosMin.Z, PosMax.Z);
+			}
+			WriteVector(PositionPtr + static_cast<int64>(i) * PositionBytesPerSplat, Pos, PositionFormat);
 
-void UGaussianSplatAsset::CompressPositions(const TArray<FGaussianSplatData>& InSplats)
-{
-	// Simplified: Always use Float32 format (12 bytes per position)
-	const int32 BytesPerSplat = 12;
-	const int32 TotalBytes = SplatCount * BytesPerSplat;
+			uint8* OtherSplatPtr = OtherPtr + static_cast<int64>(i) * OtherBytesPerSplat;
+			if (bPrecomputedCovariance)
+			{
+				WriteCovariance(OtherSplatPtr, Splat, InvCovarianceScale);
+			}
+			else
+			{
+				// Quaternion (normalized), then scale
+				const uint32 PackedRotation = GaussianSplattingUtils::PackSmallest3Rotation(GaussianSplattingUtils::NormalizeQuat(Splat.Rotation));
+				FMemory::Memcpy(OtherSplatPtr, &PackedRotation, sizeof(uint32));
+
+				FVector3f Scale = Splat.Scale;
+				if (bChunkRelativeScales)
+				{
+					const FVector3f LogS = LogScale(Scale);
+					Scale.X = NormalizeToRange(LogS.X, ScaleRangeMin.X, ScaleRangeMax.X);
+					Scale.Y = NormalizeToRange(LogS.Y, ScaleRangeMin.Y, ScaleRangeMax.Y);
+					Scale.Z = NormalizeToRange(LogS.Z, ScaleRangeMin.Z, ScaleRangeMax.Z);
+				}
+				WriteVector(OtherSplatPtr + sizeof(uint32), Scale, ScaleFormat);
+			}
 
-	// Lock bulk data for writing
-	PositionBulkData.Lock(LOCK_READ_WRITE);
-	uint8* DataPtr = static_cast<uint8*>(PositionBulkData.Realloc(TotalBytes));
+			// Color from SH DC
+			int32 TexX, TexY;
+			GaussianSplattingUtils::SplatIndexToTextureCoord(i, ColorTextureWidth, TexX, TexY);
+			if (TexY < ColorTextureHeight)
+			{
+				WriteColorTexel(TexelPtr, static_cast<int64>(TexY) * ColorTextureWidth + TexX, ColorFormat,
+					GaussianSplattingUtils::SHDCToColor(Splat.SH_DC), Splat.Opacity);
+			}
 
-	for (int32 i = 0; i < SplatCount; i++)
+			if (bDirectSH)
+			{
+				WriteSHEntry(SHPtr, SHBandOffsets, SHBands, SHFormat, i, &Splat.SH[0].X, SHRangeMin, SHRangeMax);
+			}
+			else if (bClusteredSH)
+			{
+				FMemory::Memcpy(&ClusterValues[i * Dim], Splat.SH, Dim * sizeof(float));
+			}
+		}
+	});
+
+	// Every 4x4 block holds 16 consecutive splats of a Morton tile, blocks are stored row by row
+	if (bBlockCompressedColor)
 	{
-		const FGaussianSplatData& Splat = InSplats[i];
-		float* FloatPtr = reinterpret_cast<float*>(DataPtr + i * BytesPerSplat);
-		FloatPtr[0] = Splat.Position.X;
-		FloatPtr[1] = Splat.Position.Y;
-		FloatPtr[2] = Splat.Position.Z;
+		const int32 BlocksX = ColorTextureWidth / 4;
+		ParallelFor(ColorTextureHeight / 4, [&](int32 BlockY)
+		{
+			for (int32 BlockX = 0; BlockX < BlocksX; BlockX++)
+			{
+				uint8 BlockTexels[16][4];
+				for (int32 p = 0; p < 16; p++)
+				{
+					const int64 TexelIndex = static_cast<int64>(BlockY * 4 + p / 4) * ColorTextureWidth + BlockX * 4 + p % 4;
+					FMemory::Memcpy(BlockTexels[p], &ColorTexels[TexelIndex * 4], 4);
+				}
+				uint8 (&Block)[16] = *reinterpret_cast<uint8(*)[16]>(ColorPtr + (static_cast<int64>(BlockY) * BlocksX + BlockX) * 16);
+				EncodeBC7Block(BlockTexels, Block);
+			}
+		});
 	}
 
-	PositionBulkData.Unlock();
+	// The asset bounds are the union of the chunk bounds (still useful for culling)
+	BoundingBox.Init();
+	for (const FGaussianChunkInfo& Chunk : ChunkData)
+	{
+		BoundingBox += FVector(Chunk.PosMinMaxX.X, Chunk.PosMinMaxY.X, Chunk.PosMinMaxZ.X);
+		BoundingBox += FVector(Chunk.PosMinMaxX.Y, Chunk.PosMinMaxY.Y, Chunk.PosMinMaxZ.Y);
+	}
 
 	// Set bulk data flags for optimal storage
+	PositionBulkData.Unlock();
 	PositionBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
-}
-
-void UGaussianSplatAsset::CompressRotationScale(const TArray<FGaussianSplatData>& InSplats)
-{
-	// Rotation: 4 floats (quaternion) = 16 bytes or packed to 4 bytes (10.10.10.2)
-	// Scale: 3 floats = 12 bytes or packed
-	// For now, use full precision: 28 bytes per splat
-
-	const int32 BytesPerSplat = 28; // 16 (quat) + 12 (scale)
-	const int32 TotalBytes = SplatCount * BytesPerSplat;
-
-	// Lock bulk data for writing
-	OtherBulkData.Lock(LOCK_READ_WRITE);
-	uint8* DataPtr = static_cast<uint8*>(OtherBulkData.Realloc(TotalBytes));
+	OtherBulkData.Unlock();
+	OtherBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	ColorTextureBulkData.Unlock();
+	ColorTextureBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
 
-	for (int32 i = 0; i < SplatCount; i++)
+	if (bDirectSH)
 	{
-		const FGaussianSplatData& Splat = InSplats[i];
-		float* FloatPtr = reinterpret_cast<float*>(DataPtr + i * BytesPerSplat);
-
-		// Quaternion (normalized)
-		FQuat4f NormQuat = GaussianSplattingUtils::NormalizeQuat(Splat.Rotation);
-		FloatPtr[0] = NormQuat.X;
-		FloatPtr[1] = NormQuat.Y;
-		FloatPtr[2] = NormQuat.Z;
-		FloatPtr[3] = NormQuat.W;
-
-		// Scale
-		FloatPtr[4] = Splat.Scale.X;
-		FloatPtr[5] = Splat.Scale.Y;
-		FloatPtr[6] = Splat.Scale.Z;
+		SHBulkData.Unlock();
+		SHBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	}
+	else if (bClusteredSH)
+	{
+		CompressClusteredSH(ClusterValues);
+	}
+	else
+	{
+		// No additional SH data needed (DC stored in color texture)
+		SHBulkData.RemoveBulkData();
+		SHPaletteSize = 0;
 	}
-
-	OtherBulkData.Unlock();
-
-	// Set bulk data flags for optimal storage
-	OtherBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
 }
 
-void UGaussianSplatAsset::CreateColorTextureData(const TArray<FGaussianSplatData>& InSplats)
+void UGaussianSplatAsset::ConvertLegacyRotationScale()
 {
-	// Store texture dimensions
-	ColorTextureWidth = GaussianSplattingConstants::ColorTextureWidth;
-	ColorTextureHeight = FMath::DivideAndRoundUp(SplatCount, ColorTextureWidth);
-
-	UE_LOG(LogTemp, Log, TEXT("CreateColorTextureData: Creating %dx%d data for %d splats"),
-		ColorTextureWidth, ColorTextureHeight, SplatCount);
+	constexpr int32 LegacyBytesPerSplat = 28; // 16 (float quat) + 12 (float scale)
+	const int64 LegacySize = OtherBulkData.GetBulkDataSize();
+	if (SplatCount <= 0 || LegacySize < static_cast<int64>(SplatCount) * LegacyBytesPerSplat)
+	{
+		return;
+	}
 
-	// Allocate raw pixel data (FFloat16Color = 8 bytes per pixel: R16G16B16A16)
-	const int32 NumBytes = ColorTextureWidth * ColorTextureHeight * sizeof(FFloat16Color);
+	TArray<uint8> LegacyData;
+	GetOtherData(LegacyData);
 
-	// Lock bulk data for writing
-	ColorTextureBulkData.Lock(LOCK_READ_WRITE);
-	FFloat16Color* PixelData = reinterpret_cast<FFloat16Color*>(ColorTextureBulkData.Realloc(NumBytes));
+	const int32 BytesPerSplat = GetOtherBytesPerSplat(EGaussianPositionFormat::Float32);
+	const int64 TotalBytes = GetPaddedBufferSize(static_cast<int64>(SplatCount) * BytesPerSplat);
 
-	// Initialize to black
-	FMemory::Memzero(PixelData, NumBytes);
+	OtherBulkData.Lock(LOCK_READ_WRITE);
+	uint8* DataPtr = static_cast<uint8*>(OtherBulkData.Realloc(TotalBytes));
+	FMemory::Memzero(DataPtr, TotalBytes);
 
-	// Fill with color data using Morton swizzling
 	for (int32 i = 0; i < SplatCount; i++)
 	{
-		const FGaussianSplatData& Splat = InSplats[i];
+		float Legacy[7];
+		FMemory::Memcpy(Legacy, LegacyData.GetData() + static_cast<int64>(i) * LegacyBytesPerSplat, sizeof(Legacy));
 
-		// Calculate Morton-swizzled texture coordinate
-		int32 TexX, TexY;
-		GaussianSplattingUtils::SplatIndexToTextureCoord(i, ColorTextureWidth, TexX, TexY);
-
-		if (TexY < ColorTextureHeight)
-		{
-			// Convert SH DC to color
-			// IMPORTANT: Do NOT clamp RGB - SH coefficients can produce values outside [0,1]
-			// Float16 texture format can store HDR values, clamping would cause color errors
-			FVector3f Color = GaussianSplattingUtils::SHDCToColor(Splat.SH_DC);
-
-			FFloat16Color& Pixel = PixelData[TexY * ColorTextureWidth + TexX];
-			Pixel.R = FFloat16(Color.X);  // No clamping - allow HDR values
-			Pixel.G = FFloat16(Color.Y);
-			Pixel.B = FFloat16(Color.Z);
-			Pixel.A = FFloat16(FMath::Clamp(Splat.Opacity, 0.0f, 1.0f));  // Opacity is always [0,1]
-		}
+		const uint32 PackedRotation = GaussianSplattingUtils::PackSmallest3Rotation(FQuat4f(Legacy[0], Legacy[1], Legacy[2], Legacy[3]));
+		uint8* SplatPtr = DataPtr + static_cast<int64>(i) * BytesPerSplat;
+		FMemory::Memcpy(SplatPtr, &PackedRotation, sizeof(uint32));
+		FMemory::Memcpy(SplatPtr + sizeof(uint32), &Legacy[4], sizeof(float) * 3);
 	}
 
-	ColorTextureBulkData.Unlock();
-
-	// Set bulk data flags for optimal storage
-	ColorTextureBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	OtherBulkData.Unlock();
 
-	UE_LOG(LogTemp, Log, TEXT("CreateColorTextureData: Stored %d bytes of pixel data"), NumBytes);
+	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset: Repacked legacy rotation/scale data (%d -> %d bytes per splat)"),
+		LegacyBytesPerSplat, BytesPerSplat);
 }
 
 void UGaussianSplatAsset::CreateColorTextureFromData()
@@ -454,6 +1714,14 @@ void UGaussianSplatAsset::CreateColorTextureFromData()
 	UE_LOG(LogTemp, Log, TEXT("CreateColorTextureFromData: Creating %dx%d texture from stored bulk data"),
 		ColorTextureWidth, ColorTextureHeight);
 
+	// RHIs without BC7 get the blocks decoded to RGBA8, which the shader samples the same way
+	EPixelFormat PixelFormat = GetColorPixelFormat(ColorFormat);
+	const bool bDecodeBC7 = PixelFormat == PF_BC7 && !GPixelFormats[PF_BC7].Supported;
+	if (bDecodeBC7)
+	{
+		PixelFormat = PF_R8G8B8A8;
+	}
+
 	// Create texture - use Transient flag since this is recreated at runtime
 	ColorTexture = NewObject<UTexture2D>(this, NAME_None, RF_Transient);
 
@@ -461,12 +1729,12 @@ void UGaussianSplatAsset::CreateColorTextureFromData()
 	FTexturePlatformData* PlatformData = new FTexturePlatformData();
 	PlatformData->SizeX = ColorTextureWidth;
 	PlatformData->SizeY = ColorTextureHeight;
-	PlatformData->PixelFormat = PF_FloatRGBA;
+	PlatformData->PixelFormat = PixelFormat;
 	ColorTexture->SetPlatformData(PlatformData);
 
 	// Configure texture settings
 	ColorTexture->SRGB = false;
-	ColorTexture->CompressionSettings = TC_HDR;
+	ColorTexture->CompressionSettings = ColorFormat == EGaussianColorFormat::BC7 ? TC_BC7 : TC_HDR;
 	ColorTexture->Filter = TF_Nearest;
 	ColorTexture->AddressX = TA_Clamp;
 	ColorTexture->AddressY = TA_Clamp;
@@ -481,13 +1749,34 @@ void UGaussianSplatAsset::CreateColorTextureFromData()
 	Mip->SizeY = ColorTextureHeight;
 
 	// Lock bulk data for reading and copy to mip
-	const void* SrcData = ColorTextureBulkData.LockReadOnly();
-	const int32 NumBytes = static_cast<int32>(BulkDataSize);
+	const uint8* SrcData = static_cast<const uint8*>(ColorTextureBulkData.LockReadOnly());
 
-	Mip->BulkData.Lock(LOCK_READ_WRITE);
-	void* MipData = Mip->BulkData.Realloc(NumBytes);
-	FMemory::Memcpy(MipData, SrcData, NumBytes);
-	Mip->BulkData.Unlock();
+	if (bDecodeBC7)
+	{
+		const int32 BlocksX = ColorTextureWidth / 4;
+		const int32 NumBlocks = static_cast<int32>(FMath::Min<int64>(BulkDataSize / 16, static_cast<int64>(BlocksX) * (ColorTextureHeight / 4)));
+		Mip->BulkData.Lock(LOCK_READ_WRITE);
+		uint8* MipData = static_cast<uint8*>(Mip->BulkData.Realloc(GetColorTextureBytes(EGaussianColorFormat::Norm8x4, ColorTextureWidth, ColorTextureHeight)));
+		ParallelFor(NumBlocks, [&](int32 BlockIndex)
+		{
+			uint8 BlockTexels[16][4];
+			DecodeBC7Block(SrcData + static_cast<int64>(BlockIndex) * 16, BlockTexels);
+			for (int32 p = 0; p < 16; p++)
+			{
+				const int64 TexelIndex = static_cast<int64>((BlockIndex / BlocksX) * 4 + p / 4) * ColorTextureWidth + (BlockIndex % BlocksX) * 4 + p % 4;
+				FMemory::Memcpy(MipData + TexelIndex * 4, BlockTexels[p], 4);
+			}
+		});
+		Mip->BulkData.Unlock();
+	}
+	else
+	{
+		const int32 NumBytes = static_cast<int32>(BulkDataSize);
+		Mip->BulkData.Lock(LOCK_READ_WRITE);
+		void* MipData = Mip->BulkData.Realloc(NumBytes);
+		FMemory::Memcpy(MipData, SrcData, NumBytes);
+		Mip->BulkData.Unlock();
+	}
 
 	ColorTextureBulkData.Unlock();
 
@@ -497,47 +1786,75 @@ void UGaussianSplatAsset::CreateColorTextureFromData()
 	UE_LOG(LogTemp, Log, TEXT("CreateColorTextureFromData: Texture created and resource updated"));
 }
 
-void UGaussianSplatAsset::CompressSH(const TArray<FGaussianSplatData>& InSplats)
+void UGaussianSplatAsset::CompressClusteredSH(const TArray<float>& Values)
 {
-	if (SHBands == 0)
+	const int32 Dim = GetNumSHCoeffsForBands(SHBands) * 3;
+
+	// Clustered formats replace per-splat coefficients with a palette index
+	TArray<float> Palette;
+	TArray<uint16> PaletteIndices;
+	ClusterSH(Values, Dim, GetSHPaletteSizeForFormat(SHFormat), Palette, PaletteIndices);
+	SHPaletteSize = Palette.Num() / Dim;
+
+	uint32 BandOffsets[4];
+	GetSHBandOffsets(BandOffsets);
+
+	// Lock bulk data for writing
+	SHBulkData.Lock(LOCK_READ_WRITE);
+	uint8* DataPtr = static_cast<uint8*>(SHBulkData.Realloc(BandOffsets[3]));
+	FMemory::Memzero(DataPtr, BandOffsets[3]);
+	FMemory::Memcpy(DataPtr, PaletteIndices.GetData(), PaletteIndices.Num() * sizeof(uint16));
+
+	// Palette entries are stored as Float16
+	ParallelFor(SHPaletteSize, [&](int32 Entry)
+	{
+		WriteSHEntry(DataPtr, BandOffsets, SHBands, EGaussianSHFormat::Float16, Entry, &Palette[Entry * Dim],
+			FVector3f::ZeroVector, FVector3f::ZeroVector);
+	});
+
+	SHBulkData.Unlock();
+
+	// Set bulk data flags for optimal storage
+	SHBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+}
+
+void UGaussianSplatAsset::ConvertLegacySH()
+{
+	const int32 NumCoeffs = GetNumSHCoeffsForBands(SHBands);
+	const int64 LegacyBytesPerSplat = NumCoeffs * 3 * sizeof(FFloat16);
+	if (SplatCount <= 0 || NumCoeffs == 0 || SHBulkData.GetBulkDataSize() < SplatCount * LegacyBytesPerSplat)
 	{
-		// No additional SH data needed (DC stored in color texture)
-		// Clear any existing bulk data
-		SHBulkData.RemoveBulkData();
 		return;
 	}
 
-	const int32 NumCoeffs = (SHBands == 1) ? 3 : (SHBands == 2) ? 8 : 15;
+	TArray<uint8> LegacyData;
+	LegacyData.SetNumUninitialized(static_cast<int32>(SHBulkData.GetBulkDataSize()));
+	FMemory::Memcpy(LegacyData.GetData(), SHBulkData.LockReadOnly(), LegacyData.Num());
+	SHBulkData.Unlock();
 
-	// Always store as Float16 for now (TODO: implement Norm11/Norm6 compression)
-	// Calculate actual bytes needed: NumCoeffs * 3 channels * 2 bytes per FFloat16
-	const int32 BytesPerSplat = NumCoeffs * 3 * sizeof(FFloat16);
-	const int32 TotalBytes = SplatCount * BytesPerSplat;
+	uint32 BandOffsets[4];
+	GetSHBandOffsets(BandOffsets);
 
-	// Lock bulk data for writing
 	SHBulkData.Lock(LOCK_READ_WRITE);
-	FFloat16* HalfPtr = reinterpret_cast<FFloat16*>(SHBulkData.Realloc(TotalBytes));
+	uint8* DataPtr = static_cast<uint8*>(SHBulkData.Realloc(BandOffsets[3]));
+	FMemory::Memzero(DataPtr, BandOffsets[3]);
 
+	constexpr int32 CoeffBytes = 3 * sizeof(FFloat16);
 	for (int32 i = 0; i < SplatCount; i++)
 	{
-		const FGaussianSplatData& Splat = InSplats[i];
-
-		for (int32 c = 0; c < NumCoeffs; c++)
+		for (int32 Band = 1; Band <= SHBands; Band++)
 		{
-			int32 Idx = i * NumCoeffs * 3 + c * 3;
-			HalfPtr[Idx + 0] = FFloat16(Splat.SH[c].X);
-			HalfPtr[Idx + 1] = FFloat16(Splat.SH[c].Y);
-			HalfPtr[Idx + 2] = FFloat16(Splat.SH[c].Z);
+			const int32 FirstCoeff = Band * Band - 1;
+			FMemory::Memcpy(
+				DataPtr + BandOffsets[Band - 1] + static_cast<int64>(i) * GetSHBandStride(EGaussianSHFormat::Float16, Band),
+				LegacyData.GetData() + i * LegacyBytesPerSplat + FirstCoeff * CoeffBytes,
+				(2 * Band + 1) * CoeffBytes);
 		}
 	}
 
 	SHBulkData.Unlock();
 
-	// Set bulk data flags for optimal storage
-	SHBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
-
-	// Update format to reflect actual storage
-	SHFormat = EGaussianSHFormat::Float16;
+	UE_LOG(LogTemp, Log, TEXT("GaussianSplatAsset: Repacked legacy SH data into band-planar layout"));
 }
 
 void UGaussianSplatAsset::GetPositionData(TArray<uint8>& OutData) const
@@ -572,9 +1889,14 @@ void UGaussianSplatAsset::GetOtherData(TArray<uint8>& OutData) const
 	}
 }
 
-void UGaussianSplatAsset::GetSHData(TArray<uint8>& OutData) const
+void UGaussianSplatAsset::GetSHData(TArray<uint8>& OutData, int32 MaxBands) const
 {
-	const int64 DataSize = SHBulkData.GetBulkDataSize();
+	// Bands are stored as consecutive blocks, so the needed bands are a prefix of the bulk data
+	uint32 BandOffsets[4];
+	GetSHBandOffsets(BandOffsets);
+	const int64 DataSize = MaxBands > 0
+		? FMath::Min<int64>(SHBulkData.GetBulkDataSize(), BandOffsets[FMath::Min(MaxBands, GaussianSplattingConstants::MaxSHOrder)])
+		: 0;
 	if (DataSize > 0)
 	{
 		OutData.SetNum(static_cast<int32>(DataSize));
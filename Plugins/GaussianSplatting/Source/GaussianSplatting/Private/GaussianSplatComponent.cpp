@@ -5,12 +5,14 @@
 #include "GaussianSplatSceneProxy.h"
 #include "GaussianSplatViewExtension.h"
 #include "Engine/World.h"
+#include "RenderingThread.h"
 
 UGaussianSplatComponent::UGaussianSplatComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
+	// Nothing is updated per frame, parameter changes reach the proxy through SendRenderDynamicData_Concurrent
+	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 
 	bUseAsOccluder = false;
 	SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
@@ -34,11 +36,19 @@ void UGaussianSplatComponent::PostEditChangeProperty(FPropertyChangedEvent& Prop
 	{
 		OnAssetChanged();
 	}
+	else if (PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, bAllowDynamicUpdates))
+	{
+		// Switches between shared and unshared GPU resources
+		MarkRenderStateDirty();
+	}
 	else if (PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, SHOrder) ||
 			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, OpacityScale) ||
-			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, SplatScale))
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, SplatScale) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, MaxSplatsPerView) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatComponent, bEnableFrustumCulling))
 	{
-		MarkRenderStateDirty();
+		// Sent to the existing proxy in SendRenderDynamicData_Concurrent, nothing is re-uploaded
+		MarkRenderDynamicDataDirty();
 	}
 
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -47,7 +57,6 @@ void UGaussianSplatComponent::PostEditChangeProperty(FPropertyChangedEvent& Prop
 
 void UGaussianSplatComponent::OnRegister()
 {
-	UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: OnRegister called!"));
 	Super::OnRegister();
 
 	if (SplatAsset)
@@ -58,19 +67,29 @@ void UGaussianSplatComponent::OnRegister()
 
 void UGaussianSplatComponent::OnUnregister()
 {
-	UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: OnUnregister called!"));
 	Super::OnUnregister();
 }
 
-void UGaussianSplatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UGaussianSplatComponent::SendRenderDynamicData_Concurrent()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::SendRenderDynamicData_Concurrent();
+
+	if (!SceneProxy)
+	{
+		return;
+	}
+
+	FGaussianSplatSceneProxy* Proxy = static_cast<FGaussianSplatSceneProxy*>(SceneProxy);
+	ENQUEUE_RENDER_COMMAND(UpdateGaussianSplatParameters)(
+		[Proxy, InSHOrder = SHOrder, InOpacityScale = OpacityScale, InSplatScale = SplatScale,
+		 InMaxSplatsPerView = MaxSplatsPerView, bInEnableFrustumCulling = bEnableFrustumCulling](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->SetRenderParameters_RenderThread(InSHOrder, InOpacityScale, InSplatScale, InMaxSplatsPerView, bInEnableFrustumCulling);
+		});
 }
 
 FPrimitiveSceneProxy* UGaussianSplatComponent::CreateSceneProxy()
 {
-	UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: CreateSceneProxy called!"));
-
 	if (!SplatAsset || !SplatAsset->IsValid())
 	{
 		return nullptr;
@@ -123,7 +142,53 @@ void UGaussianSplatComponent::SetSplatAsset(UGaussianSplatAsset* NewAsset)
 
 int32 UGaussianSplatComponent::GetSplatCount() const
 {
-	return SplatAsset ? SplatAsset->GetSplatCount() : 0;
+	return SplatAsset ? SplatAsset->GetSourceSplatCount() : 0;
+}
+
+void UGaussianSplatComponent::UpdateSplats(int32 FirstSplat, TConstArrayView<FGaussianSplatData> Splats)
+{
+	if (!bAllowDynamicUpdates)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: UpdateSplats on %s needs bAllowDynamicUpdates"), *GetPathName());
+		return;
+	}
+
+	const int32 First = FMath::Max(FirstSplat, 0);
+	const int32 Last = FMath::Min(FirstSplat + Splats.Num(), GetSplatCount());
+	if (!SceneProxy || First >= Last)
+	{
+		return;
+	}
+
+	// Encoded here so the render thread only copies
+	TArray<FGaussianSplatDynamicData> Encoded;
+	Encoded.Reserve(Last - First);
+	for (int32 SplatIndex = First; SplatIndex < Last; SplatIndex++)
+	{
+		Encoded.Add(GaussianSplattingUtils::MakeDynamicSplatData(Splats[SplatIndex - FirstSplat]));
+	}
+
+	FGaussianSplatSceneProxy* Proxy = static_cast<FGaussianSplatSceneProxy*>(SceneProxy);
+	ENQUEUE_RENDER_COMMAND(UpdateGaussianSplats)(
+		[Proxy, First, Encoded = MoveTemp(Encoded)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			Proxy->UpdateSplats_RenderThread(First, MoveTemp(Encoded));
+		});
+}
+
+void UGaussianSplatComponent::SetDeformDelegate(const FGaussianSplatDeformDelegate& InDeformDelegate)
+{
+	DeformDelegate = InDeformDelegate;
+
+	if (SceneProxy)
+	{
+		FGaussianSplatSceneProxy* Proxy = static_cast<FGaussianSplatSceneProxy*>(SceneProxy);
+		ENQUEUE_RENDER_COMMAND(SetGaussianSplatDeformDelegate)(
+			[Proxy, InDeformDelegate](FRHICommandListImmediate& RHICmdList)
+			{
+				Proxy->SetDeformDelegate_RenderThread(InDeformDelegate);
+			});
+	}
 }
 
 void UGaussianSplatComponent::OnAssetChanged()
@@ -135,8 +200,6 @@ void UGaussianSplatComponent::OnAssetChanged()
 
 void UGaussianSplatComponent::MarkRenderStateDirty()
 {
-	UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: MarkRenderStateDirty called!"));
-
 	MarkRenderDynamicDataDirty();
 
 	if (IsRegistered())
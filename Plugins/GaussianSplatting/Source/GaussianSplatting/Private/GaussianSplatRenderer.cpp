@@ -3,6 +3,8 @@
 #include "GaussianSplatRenderer.h"
 #include "GaussianSplatShaders.h"
 #include "GaussianSplatSceneProxy.h"
+#include "GaussianSplatStats.h"
+#include "GaussianSplatViewExtension.h"
 #include "RHICommandList.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
@@ -13,6 +15,780 @@
 #include "SceneView.h"
 #include "RenderCore.h"
 #include "CommonRenderResources.h"
+#include "SystemTextures.h"
+#include "HAL/IConsoleManager.h"
+#include "StereoRendering.h"
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatAsyncCompute(
+	TEXT("gs.AsyncCompute"),
+	1,
+	TEXT("Run splat view data and sort passes on the async compute pipe when supported, overlapping the base pass.\n")
+	TEXT("0 = graphics pipe, 1 = async compute (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatBatchProxies(
+	TEXT("gs.BatchProxies"),
+	1,
+	TEXT("Sort and draw all splat proxies of a view together.\n")
+	TEXT("0 = one sort and draw per proxy, 1 = one shared sort and draw with correct ordering between proxies (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatSortKeyBits(
+	TEXT("gs.SortKeyBits"),
+	32,
+	TEXT("Bits per splat depth key, one radix pass per 8 bits.\n")
+	TEXT("32 = full float depth, 4 passes (default)\n")
+	TEXT("24/16 = view depth quantized against the proxies' depth extent from their bounds, 3/2 passes. Orthographic views always use 32."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatSortMode(
+	TEXT("gs.SortMode"),
+	0,
+	TEXT("Radix sort implementation.\n")
+	TEXT("0 = multi-pass count/prefix/scatter, 4 dispatches per digit (default)\n")
+	TEXT("1 = OneSweep: one histogram pass for all digits, then a single scatter per digit with decoupled lookback. Needs wave operations, falls back to 0 otherwise"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatSortEveryNthFrame(
+	TEXT("gs.SortEveryNthFrame"),
+	1,
+	TEXT("Full sort cadence for a moving camera. View data is still recomputed every frame.\n")
+	TEXT("1 = full sort every frame the camera moves (default)\n")
+	TEXT("N > 1 = full sort at most every N frames, the frames between reuse and refine the last order\n")
+	TEXT("0 = full sort only when gs.SortReuseDistance or gs.SortReuseAngle is exceeded"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatSortReuseDistance(
+	TEXT("gs.SortReuseDistance"),
+	0.0f,
+	TEXT("Camera translation (cm) since the last full sort below which the previous order is reused and refined.\n")
+	TEXT("0 = no distance threshold (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatSortReuseAngle(
+	TEXT("gs.SortReuseAngle"),
+	0.0f,
+	TEXT("Camera rotation (degrees) since the last full sort below which the previous order is reused and refined.\n")
+	TEXT("0 = no angle threshold (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatSortRefine(
+	TEXT("gs.SortRefine"),
+	1,
+	TEXT("When a previous order is reused, re-sort it in overlapping 1024-splat tiles against the current depths.\n")
+	TEXT("0 = reuse the order as is, 1 = refine (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatChunkCulling(
+	TEXT("gs.ChunkCulling"),
+	1,
+	TEXT("Frustum-cull splat chunks (256 splats each) against their bounds before computing view data.\n")
+	TEXT("0 = compute view data for every splat, 1 = skip chunks outside the view (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatSHCacheAngle(
+	TEXT("gs.SHCacheAngle"),
+	1.0f,
+	TEXT("Cache the view-dependent (SH) color of each splat per view and evaluate a chunk again only once the direction\n")
+	TEXT("from the camera to its center turned by more than this many degrees. Saves loading the SH coefficients every frame.\n")
+	TEXT("0 = evaluate SH for every splat every frame (default 1)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatTileRasterizer(
+	TEXT("gs.TileRasterizer"),
+	0,
+	TEXT("Rasterize splats in compute instead of drawing one alpha-blended quad per splat.\n")
+	TEXT("0 = instanced quads (default)\n")
+	TEXT("1 = bin splats into 16x16 screen tiles and blend each tile front-to-back in groupshared memory, stopping once pixels are opaque.\n")
+	TEXT("Needs a single-sample scene color with UAV support, falls back to 0 otherwise"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatTileRasterMaxEntriesPerSplat(
+	TEXT("gs.TileRasterMaxEntriesPerSplat"),
+	4.0f,
+	TEXT("Tile rasterizer capacity: (tile, splat) entries reserved per splat. A splat gets one entry per tile it overlaps,\n")
+	TEXT("entries past the capacity drop the farthest splats of the view and are counted under \"stat GaussianSplatting\" (default 4)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatStereoSharedSort(
+	TEXT("gs.StereoSharedSort"),
+	1,
+	TEXT("Stereo rendering: sort once for both eyes. The primary eye culls against both eye frusta and sorts at the eyes'\n")
+	TEXT("midpoint depth, the secondary eye only computes its view data and draws in that order.\n")
+	TEXT("0 = sort each eye separately, 1 = share the sort (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatFoveation(
+	TEXT("gs.Foveation"),
+	1,
+	TEXT("Drop small splats towards the edge of the view, see gs.FoveationInnerRadius and gs.FoveationMinPixelSize.\n")
+	TEXT("0 = off, 1 = stereo eye views only (default), 2 = every view"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatFoveationInnerRadius(
+	TEXT("gs.FoveationInnerRadius"),
+	0.5f,
+	TEXT("Radius around the view center, in NDC (1 = view edge), rendered at full detail and full shading rate (default 0.5)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatFoveationMinPixelSize(
+	TEXT("gs.FoveationMinPixelSize"),
+	1.0f,
+	TEXT("Size threshold, in pixels of quad half-extent, below which splats are dropped at the view edge.\n")
+	TEXT("Ramps up from 0 at gs.FoveationInnerRadius. 0 = keep every splat (default 1)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatFoveationVRS(
+	TEXT("gs.FoveationVRS"),
+	1,
+	TEXT("With gs.Foveation, shade the splat draw coarser outside gs.FoveationInnerRadius through a shading rate image,\n")
+	TEXT("2x2 and 4x4 in the outer half where supported. Needs image-based variable rate shading, ignored otherwise.\n")
+	TEXT("0 = off, 1 = on (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatOcclusionCulling(
+	TEXT("gs.OcclusionCulling"),
+	0,
+	TEXT("Drop splats entirely behind opaque geometry before they are sorted, tested against an HZB of the previous frame's scene depth.\n")
+	TEXT("Perspective views with a view state only, a shared stereo sort is never culled. Not supported with MSAA.\n")
+	TEXT("0 = off (default), 1 = on"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatOcclusionCullingResortFrames(
+	TEXT("gs.OcclusionCullingResortFrames"),
+	8,
+	TEXT("An occlusion-culled sort order is sorted again after this many frames even while the camera rests,\n")
+	TEXT("so splats uncovered by moving geometry reappear. Default 8"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatDepthWrite(
+	TEXT("gs.SplatDepthWrite"),
+	0,
+	TEXT("Write an approximate splat depth into the scene depth after the splats are drawn, for later translucency and TAA.\n")
+	TEXT("Each quad is written at its center's depth where its gaussian alpha reaches gs.SplatDepthWriteAlpha.\n")
+	TEXT("0 = off (default), 1 = on"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatDepthWriteAlpha(
+	TEXT("gs.SplatDepthWriteAlpha"),
+	0.5f,
+	TEXT("Alpha a splat pixel needs to write depth with gs.SplatDepthWrite. Default 0.5"),
+	ECVF_RenderThreadSafe);
+
+/** Raster pass parameters: vertex shader inputs, the GPU-written draw args and the scene color/depth bindings */
+BEGIN_SHADER_PARAMETER_STRUCT(FGaussianSplatDrawParameters, )
+	SHADER_PARAMETER_STRUCT_INCLUDE(FGaussianSplatVS::FParameters, VS)
+	RDG_BUFFER_ACCESS(IndirectDrawArgs, ERHIAccess::IndirectArgs)
+	RENDER_TARGET_BINDING_SLOTS()
+END_SHADER_PARAMETER_STRUCT()
+
+namespace GaussianSplatRendererPrivate
+{
+	/**
+	 * View projection without the temporal AA jitter. PreRenderView runs before the jitter is applied,
+	 * so this keeps early and inline compute consistent and lets the camera-static cache hit under TAA.
+	 */
+	FMatrix GetViewProjectionMatrixNoAA(const FSceneView& View)
+	{
+		return View.ViewMatrices.GetViewMatrix() * View.ViewMatrices.ComputeProjectionNoAAMatrix();
+	}
+
+	/**
+	 * Every global shader the renderer dispatches, resolved once per frame rather than per proxy and pass.
+	 * Refreshing on a new render thread frame keeps the refs valid across recompileshaders.
+	 */
+	struct FShaderRefs
+	{
+		TShaderRef<FGaussianSplatCalcViewDataCS> CalcViewData;
+		TShaderRef<FGaussianSplatCullChunksCS> CullChunks;
+		TShaderRef<FGaussianSplatRefineSortCS> RefineSort;
+		TShaderRef<FGaussianSplatBuildIndirectArgsCS> BuildIndirectArgs;
+		TShaderRef<FRadixSortCountCS> RadixSortCount;
+		TShaderRef<FRadixSortPrefixSumCS> RadixSortPrefixSum;
+		TShaderRef<FRadixSortDigitPrefixSumCS> RadixSortDigitPrefixSum;
+		TShaderRef<FRadixSortScatterCS> RadixSortScatter;
+		TShaderRef<FRadixSortOneSweepHistogramCS> OneSweepHistogram;
+		TShaderRef<FRadixSortOneSweepHistogramScanCS> OneSweepHistogramScan;
+		TShaderRef<FRadixSortOneSweepScatterCS> OneSweepScatter;
+		TShaderRef<FGaussianSplatTileCountCS> TileCount;
+		TShaderRef<FGaussianSplatTileScanCS> TileScan;
+		TShaderRef<FGaussianSplatTileEmitCS> TileEmit;
+		TShaderRef<FGaussianSplatTileRangesCS> TileRanges;
+		TShaderRef<FGaussianSplatTileRasterizeCS> TileRasterize;
+		TShaderRef<FGaussianSplatFoveationRateCS> FoveationRate;
+		TShaderRef<FGaussianSplatHZBFromDepthCS> HZBFromDepth;
+		TShaderRef<FGaussianSplatHZBDownsampleCS> HZBDownsample;
+		TShaderRef<FGaussianSplatVS> SplatVS;
+		TShaderRef<FGaussianSplatPS> SplatPS;
+		TShaderRef<FGaussianSplatDepthPS> SplatDepthPS;
+		/** Static draw state of the splat quads, render targets are applied per pass */
+		FGraphicsPipelineStateInitializer DrawPSOInit;
+		/** Static draw state of the depth-only splat quads (gs.SplatDepthWrite) */
+		FGraphicsPipelineStateInitializer DepthPSOInit;
+
+		uint64 FrameNumber = MAX_uint64;
+	};
+
+	const FShaderRefs& GetShaders()
+	{
+		check(IsInRenderingThread());
+		static FShaderRefs Shaders;
+		if (Shaders.FrameNumber == GFrameCounterRenderThread)
+		{
+			return Shaders;
+		}
+
+		FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+		Shaders.CalcViewData = TShaderMapRef<FGaussianSplatCalcViewDataCS>(ShaderMap);
+		Shaders.CullChunks = TShaderMapRef<FGaussianSplatCullChunksCS>(ShaderMap);
+		Shaders.RefineSort = TShaderMapRef<FGaussianSplatRefineSortCS>(ShaderMap);
+		Shaders.BuildIndirectArgs = TShaderMapRef<FGaussianSplatBuildIndirectArgsCS>(ShaderMap);
+		Shaders.RadixSortCount = TShaderMapRef<FRadixSortCountCS>(ShaderMap);
+		Shaders.RadixSortPrefixSum = TShaderMapRef<FRadixSortPrefixSumCS>(ShaderMap);
+		Shaders.RadixSortDigitPrefixSum = TShaderMapRef<FRadixSortDigitPrefixSumCS>(ShaderMap);
+		Shaders.RadixSortScatter = TShaderMapRef<FRadixSortScatterCS>(ShaderMap);
+		Shaders.OneSweepHistogram = TShaderMapRef<FRadixSortOneSweepHistogramCS>(ShaderMap);
+		Shaders.OneSweepHistogramScan = TShaderMapRef<FRadixSortOneSweepHistogramScanCS>(ShaderMap);
+		Shaders.OneSweepScatter = TShaderMapRef<FRadixSortOneSweepScatterCS>(ShaderMap);
+		Shaders.TileCount = TShaderMapRef<FGaussianSplatTileCountCS>(ShaderMap);
+		Shaders.TileScan = TShaderMapRef<FGaussianSplatTileScanCS>(ShaderMap);
+		Shaders.TileEmit = TShaderMapRef<FGaussianSplatTileEmitCS>(ShaderMap);
+		Shaders.TileRanges = TShaderMapRef<FGaussianSplatTileRangesCS>(ShaderMap);
+		Shaders.TileRasterize = TShaderMapRef<FGaussianSplatTileRasterizeCS>(ShaderMap);
+		Shaders.FoveationRate = TShaderMapRef<FGaussianSplatFoveationRateCS>(ShaderMap);
+		Shaders.HZBFromDepth = TShaderMapRef<FGaussianSplatHZBFromDepthCS>(ShaderMap);
+		Shaders.HZBDownsample = TShaderMapRef<FGaussianSplatHZBDownsampleCS>(ShaderMap);
+		Shaders.SplatVS = TShaderMapRef<FGaussianSplatVS>(ShaderMap);
+		Shaders.SplatPS = TShaderMapRef<FGaussianSplatPS>(ShaderMap);
+		Shaders.SplatDepthPS = TShaderMapRef<FGaussianSplatDepthPS>(ShaderMap);
+		FGraphicsPipelineStateInitializer& PSOInit = Shaders.DrawPSOInit;
+		PSOInit = FGraphicsPipelineStateInitializer();
+		PSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+		// Depth test enabled (CF_DepthNearOrEqual) so splats are occluded by scene geometry
+		// Depth write disabled (false) because splats are transparent and blend among themselves
+		PSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_DepthNearOrEqual>::GetRHI();
+
+		// Blend mode: Standard premultiplied alpha "over" for back-to-front compositing
+		// result = src + dst * (1 - srcAlpha)
+		// This properly attenuates the background behind splats
+		PSOInit.BlendState = TStaticBlendState<
+			CW_RGBA,
+			BO_Add, BF_One, BF_InverseSourceAlpha,  // Color: Src + Dst * (1 - SrcAlpha)
+			BO_Add, BF_One, BF_InverseSourceAlpha   // Alpha: same
+		>::GetRHI();
+
+		PSOInit.PrimitiveType = PT_TriangleList;
+		PSOInit.BoundShaderState.VertexDeclarationRHI = GEmptyVertexDeclaration.VertexDeclarationRHI;
+		if (Shaders.SplatVS.IsValid() && Shaders.SplatPS.IsValid())
+		{
+			PSOInit.BoundShaderState.VertexShaderRHI = Shaders.SplatVS.GetVertexShader();
+			PSOInit.BoundShaderState.PixelShaderRHI = Shaders.SplatPS.GetPixelShader();
+		}
+
+		// Depth-only variant: same quads, depth written where the splat is opaque enough and no color output
+		FGraphicsPipelineStateInitializer& DepthPSOInit = Shaders.DepthPSOInit;
+		DepthPSOInit = PSOInit;
+		DepthPSOInit.DepthStencilState = TStaticDepthStencilState<true, CF_DepthNearOrEqual>::GetRHI();
+		DepthPSOInit.BlendState = TStaticBlendState<CW_NONE>::GetRHI();
+		DepthPSOInit.BoundShaderState.PixelShaderRHI = Shaders.SplatDepthPS.IsValid() ? Shaders.SplatDepthPS.GetPixelShader() : nullptr;
+
+		Shaders.FrameNumber = GFrameCounterRenderThread;
+		return Shaders;
+	}
+
+	/** Splats per radix sort tile, must match TILE_SIZE in RadixSort.usf */
+	constexpr uint32 RadixSortTileSize = 1024;
+
+	/** Mips of the occlusion HZB, the top mip of a 1080p view covers 512 pixels per texel */
+	constexpr int32 MaxOcclusionHZBMips = 8;
+
+	/** Chunks per chunk culling group, must match numthreads in CullChunks.usf */
+	constexpr uint32 CullChunksGroupSize = 64;
+
+	/** View data is computed in whole chunks, so every proxy's slice starts and ends on a chunk boundary */
+	int32 GetChunkAlignedSplatCount(int32 SplatCount)
+	{
+		return Align(SplatCount, GaussianSplattingConstants::SplatsPerChunk);
+	}
+
+	/** Transient buffers that carry the visible splat count from CalcViewData to the sort */
+	struct FVisibleSplatBuffers
+	{
+		FRDGBufferRef VisibleCountBuffer = nullptr;
+		FRDGBufferRef SortDispatchArgsBuffer = nullptr;
+	};
+
+	/** The visible count starts at zero, every CalcViewData dispatch that follows appends to it */
+	FVisibleSplatBuffers CreateVisibleSplatBuffers(FRDGBuilder& GraphBuilder, ERDGPassFlags ComputePassFlags)
+	{
+		FVisibleSplatBuffers Buffers;
+		Buffers.VisibleCountBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 1), TEXT("GaussianVisibleCountBuffer"));
+		Buffers.SortDispatchArgsBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(1), TEXT("GaussianSortDispatchArgs"));
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(Buffers.VisibleCountBuffer), 0, ComputePassFlags);
+		return Buffers;
+	}
+
+	/** Key width for the sort: 16, 24 or 32 bits. Quantized keys need the linear view depth of a perspective projection. */
+	uint32 GetSortKeyBits(const FSceneView& View)
+	{
+		if (!View.IsPerspectiveProjection())
+		{
+			return 32;
+		}
+		const int32 KeyBits = CVarGaussianSplatSortKeyBits.GetValueOnRenderThread();
+		return KeyBits <= 16 ? 16 : (KeyBits <= 24 ? 24 : 32);
+	}
+
+	/** OneSweep needs wave ballots and at most 16 waves per 256-thread group */
+	bool UseOneSweepSort()
+	{
+		return CVarGaussianSplatSortMode.GetValueOnRenderThread() == 1 &&
+			GRHISupportsWaveOperations && GRHIMinimumWaveSize >= 16 && GRHIMaximumWaveSize <= 128;
+	}
+
+	/**
+	 * View-space depth extent of a set of bounds, as (near, 1 / (far - near)) for key quantization.
+	 * Splats outside the bounds clamp to the nearest end, they still sort correctly against the rest.
+	 */
+	FVector2f GetViewDepthRange(const FSceneView& View, TConstArrayView<FBoxSphereBounds> Bounds)
+	{
+		const FMatrix& ViewMatrix = View.ViewMatrices.GetViewMatrix();
+		double Near = UE_BIG_NUMBER;
+		double Far = -UE_BIG_NUMBER;
+		for (const FBoxSphereBounds& B : Bounds)
+		{
+			const double CenterDepth = ViewMatrix.TransformPosition(B.Origin).Z;
+			Near = FMath::Min(Near, CenterDepth - B.SphereRadius);
+			Far = FMath::Max(Far, CenterDepth + B.SphereRadius);
+		}
+
+		// Nothing in front of the near plane is visible
+		Near = FMath::Max(Near, (double)View.NearClippingDistance);
+		Far = FMath::Max(Far, Near + UE_KINDA_SMALL_NUMBER);
+		return FVector2f((float)Near, (float)(1.0 / (Far - Near)));
+	}
+
+	/** Render thread frame of the last sort, and the sort buffer bytes it requested */
+	uint64 SortScratchFrame = MAX_uint64;
+	int64 SortScratchBytes = 0;
+
+	/**
+	 * Transient sort buffer of exactly NumElements keys. RDG allocates it from its transient pool, so the sorts
+	 * of every proxy and view in a frame draw on the same memory wherever their lifetimes don't overlap.
+	 * The bytes the last sorting frame requested are shown as STAT_GaussianSplatSortScratchMemory.
+	 */
+	FRDGBufferRef CreateSortScratchBuffer(FRDGBuilder& GraphBuilder, uint32 NumElements, const TCHAR* Name)
+	{
+		if (SortScratchFrame != GFrameCounterRenderThread)
+		{
+			SortScratchFrame = GFrameCounterRenderThread;
+			SortScratchBytes = 0;
+		}
+
+		const FRDGBufferDesc Desc = FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumElements);
+		SortScratchBytes += Desc.GetSize();
+		SET_MEMORY_STAT(STAT_GaussianSplatSortScratchMemory, SortScratchBytes);
+		return GraphBuilder.CreateBuffer(Desc, Name);
+	}
+
+	/**
+	 * Values enter the sort in this buffer. An odd pass count ends in the other ping-pong buffer,
+	 * so CalcViewData appends to a transient buffer and the last scatter lands in SortKeysBuffer.
+	 */
+	FRDGBufferRef GetUnsortedKeysBuffer(FRDGBuilder& GraphBuilder, FRDGBufferRef SortKeysBuffer, uint32 SortKeyBits, int32 SplatCount)
+	{
+		const uint32 NumPasses = SortKeyBits / 8;
+		if ((NumPasses & 1) == 0)
+		{
+			return SortKeysBuffer;
+		}
+		return CreateSortScratchBuffer(GraphBuilder, SplatCount, TEXT("GaussianUnsortedKeysBuffer"));
+	}
+
+	/** Must match SCAN_GROUP_SIZE in TileRasterizer.usf */
+	constexpr uint32 TileScanGroupSize = 256;
+
+	/** Upper bound on tile rasterizer entries, keeps the transient sort buffers within 256 MiB each */
+	constexpr int64 MaxTileRasterEntries = 64 * 1024 * 1024;
+
+	/** gs.TileRasterizer is on and the scene color can be written from compute */
+	bool UseTileRasterizer(const FRenderTargetBindingSlots& RenderTargets)
+	{
+		if (CVarGaussianSplatTileRasterizer.GetValueOnRenderThread() == 0)
+		{
+			return false;
+		}
+		const FRDGTexture* ColorTexture = RenderTargets[0].GetTexture();
+		const FRDGTexture* DepthTexture = RenderTargets.DepthStencil.GetTexture();
+		return ColorTexture && DepthTexture &&
+			EnumHasAnyFlags(ColorTexture->Desc.Flags, TexCreate_UAV) &&
+			ColorTexture->Desc.NumSamples == 1 && DepthTexture->Desc.NumSamples == 1;
+	}
+
+	/**
+	 * True once an occlusion-culled order has lived for gs.OcclusionCullingResortFrames.
+	 * Culling used an older frame's depth, a resting camera would otherwise never show splats that moving geometry uncovers.
+	 */
+	bool IsOcclusionCulledSortExpired(const FSceneView& View, const FGaussianSplatViewResources& Resources)
+	{
+		if (!Resources.bOcclusionCulledSort)
+		{
+			return false;
+		}
+		const uint32 FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+		const int32 ResortFrames = FMath::Max(1, CVarGaussianSplatOcclusionCullingResortFrames.GetValueOnRenderThread());
+		return FrameNumber - Resources.LastFullSortFrameNumber >= (uint32)ResortFrames;
+	}
+
+	/** Splats per refine tile, must match REFINE_TILE_SIZE in CalcDistances.usf */
+	constexpr uint32 RefineSortTileSize = 1024;
+
+	/**
+	 * True if the order from the last full sort may be reused (and refined) for this view instead of sorting again.
+	 * Exceeding a reuse threshold always forces a full sort; gs.SortEveryNthFrame caps how long an order lives.
+	 */
+	bool CanReuseSortOrder(const FSceneView& View, const FGaussianSplatViewResources& Resources)
+	{
+		const float ReuseDistance = CVarGaussianSplatSortReuseDistance.GetValueOnRenderThread();
+		const float ReuseAngle = CVarGaussianSplatSortReuseAngle.GetValueOnRenderThread();
+		const int32 SortEveryNthFrame = CVarGaussianSplatSortEveryNthFrame.GetValueOnRenderThread();
+
+		if (IsOcclusionCulledSortExpired(View, Resources))
+		{
+			return false;
+		}
+		if (ReuseDistance > 0.0f &&
+			FVector::Dist(View.ViewMatrices.GetViewOrigin(), Resources.LastFullSortViewOrigin) > ReuseDistance)
+		{
+			return false;
+		}
+		if (ReuseAngle > 0.0f &&
+			FVector::DotProduct(View.GetViewDirection(), Resources.LastFullSortViewDirection) < FMath::Cos(FMath::DegreesToRadians(ReuseAngle)))
+		{
+			return false;
+		}
+
+		if (SortEveryNthFrame > 1)
+		{
+			const uint32 FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+			return FrameNumber - Resources.LastFullSortFrameNumber < (uint32)SortEveryNthFrame;
+		}
+		return SortEveryNthFrame == 0 && (ReuseDistance > 0.0f || ReuseAngle > 0.0f);
+	}
+
+	/** The view's occlusion HZB when this sort may cull against it, a shared stereo sort keeps what either eye sees */
+	const FGaussianSplatOcclusionHZB* GetOcclusionHZB(const FSceneView& View, const FSceneView* StereoView)
+	{
+		if (StereoView || !FGaussianSplatRenderer::UseOcclusionCulling(View))
+		{
+			return nullptr;
+		}
+		const FGaussianSplatViewExtension* Ext = FGaussianSplatViewExtension::Get();
+		return Ext ? Ext->FindOcclusionHZB(View) : nullptr;
+	}
+
+	/** Remember the camera a full sort was computed for */
+	void RecordFullSort(const FSceneView& View, FGaussianSplatViewResources& Resources)
+	{
+		Resources.LastFullSortFrameNumber = View.Family ? View.Family->FrameNumber : 0;
+		Resources.LastFullSortViewOrigin = View.ViewMatrices.GetViewOrigin();
+		Resources.LastFullSortViewDirection = View.GetViewDirection();
+	}
+
+	/** Half a tile on odd frames, so refine tiles overlap their neighbours from the previous frame */
+	uint32 GetRefineTileOffset(const FSceneView& View)
+	{
+		const uint32 FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+		return (FrameNumber & 1) * (RefineSortTileSize / 2);
+	}
+
+	/**
+	 * Other eye of a stereo pair when the eyes share a sort (gs.StereoSharedSort), else null.
+	 * Only the first eye of the other kind is paired, further stereo views sort on their own.
+	 */
+	const FSceneView* GetStereoPartnerView(const FSceneView& View)
+	{
+		if (CVarGaussianSplatStereoSharedSort.GetValueOnRenderThread() == 0 || !View.Family ||
+			!IStereoRendering::IsStereoEyeView(View) || !View.IsPerspectiveProjection())
+		{
+			return nullptr;
+		}
+
+		const bool bPrimary = IStereoRendering::IsAPrimaryView(View);
+		for (const FSceneView* Other : View.Family->Views)
+		{
+			if (Other && Other != &View && IStereoRendering::IsStereoEyeView(*Other) &&
+				IStereoRendering::IsAPrimaryView(*Other) != bPrimary)
+			{
+				return Other;
+			}
+		}
+		return nullptr;
+	}
+
+	/** View projection of the other eye of a shared stereo sort, identity without one */
+	FMatrix GetStereoViewProjectionMatrix(const FSceneView* StereoView)
+	{
+		return StereoView ? GetViewProjectionMatrixNoAA(*StereoView) : FMatrix::Identity;
+	}
+
+	/**
+	 * True if the primary eye's order was set up this frame with View as its other eye, so View can draw with it.
+	 * Eyes rendered on different GPUs cannot share, each GPU only holds the order it sorted itself.
+	 * Callers also compare what the order was computed from (LOD range or batch).
+	 */
+	bool CanShareStereoSort(const FSceneView& View, const FSceneView& PrimaryView, const FGaussianSplatViewResources* PrimaryResources)
+	{
+		return PrimaryResources && PrimaryResources->IsPreparedFor(PrimaryView) && View.GPUMask == PrimaryView.GPUMask &&
+			PrimaryResources->bHasCachedSortData && !PrimaryResources->bCachedStereoSecondary &&
+			PrimaryResources->CachedStereoViewProjectionMatrix.Equals(GetViewProjectionMatrixNoAA(View), 0.0f);
+	}
+
+	/** gs.Foveation applies to this view */
+	bool UseFoveation(const FSceneView& View)
+	{
+		const int32 Mode = CVarGaussianSplatFoveation.GetValueOnRenderThread();
+		return Mode == 2 || (Mode == 1 && IStereoRendering::IsStereoEyeView(View));
+	}
+
+	/** The splat draw can be shaded through a foveated shading rate image */
+	bool UseFoveatedShadingRate(const FSceneView& View)
+	{
+		return CVarGaussianSplatFoveationVRS.GetValueOnRenderThread() != 0 && UseFoveation(View) &&
+			GRHISupportsAttachmentVariableRateShading && GRHIVariableRateShadingImageDataType == VRSImage_Palette &&
+			GRHIVariableRateShadingImageTileMinWidth > 0 && GRHIVariableRateShadingImageTileMinHeight > 0;
+	}
+
+	/** Full rate inside gs.FoveationInnerRadius, 2x2 then 4x4 (where supported) towards the edge of the view */
+	FRDGTextureRef CreateFoveatedShadingRateImage(FRDGBuilder& GraphBuilder, const FSceneView& View, FIntPoint TargetExtent)
+	{
+		TShaderRef<FGaussianSplatFoveationRateCS> ComputeShader = GetShaders().FoveationRate;
+		if (!ComputeShader.IsValid())
+		{
+			return nullptr;
+		}
+
+		const FIntPoint TileSize(GRHIVariableRateShadingImageTileMinWidth, GRHIVariableRateShadingImageTileMinHeight);
+		const FIntPoint ImageSize = FIntPoint::DivideAndRoundUp(TargetExtent, TileSize);
+		FRDGTextureRef ShadingRateImage = GraphBuilder.CreateTexture(
+			FRDGTextureDesc::Create2D(ImageSize, GRHIVariableRateShadingImageFormat, FClearValueBinding::None,
+				TexCreate_Foveation | TexCreate_UAV | TexCreate_ShaderResource),
+			TEXT("GaussianFoveatedShadingRate"));
+
+		const float InnerRadius = FMath::Clamp(CVarGaussianSplatFoveationInnerRadius.GetValueOnRenderThread(), 0.0f, 1.0f);
+		const EVRSShadingRate CoarsestRate = GRHISupportsLargerVariableRateShadingSizes ? EVRSShadingRate::VRSSR_4x4 : EVRSShadingRate::VRSSR_2x2;
+		const FIntRect ViewRect = View.UnscaledViewRect;
+
+		FGaussianSplatFoveationRateCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatFoveationRateCS::FParameters>();
+		Parameters->RWShadingRateImage = GraphBuilder.CreateUAV(ShadingRateImage);
+		Parameters->ImageSize = FUintVector2(ImageSize.X, ImageSize.Y);
+		Parameters->TileSize = FUintVector2(TileSize.X, TileSize.Y);
+		Parameters->ViewMin = FVector2f(ViewRect.Min);
+		Parameters->ViewSize = FVector2f(FMath::Max(ViewRect.Width(), 1), FMath::Max(ViewRect.Height(), 1));
+		Parameters->InnerRadius = InnerRadius;
+		Parameters->OuterRadius = 0.5f * (InnerRadius + 1.0f);
+		Parameters->CoarseRate = (uint32)EVRSShadingRate::VRSSR_2x2;
+		Parameters->CoarsestRate = (uint32)CoarsestRate;
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("GaussianSplatFoveatedShadingRate"),
+			ERDGPassFlags::Compute,
+			ComputeShader,
+			Parameters,
+			FComputeShaderUtils::GetGroupCount(ImageSize, FIntPoint(8, 8)));
+		return ShadingRateImage;
+	}
+
+	/** How a view's sort was produced this frame, for the sort cache counters */
+	enum class ESortStat : uint8
+	{
+		Full,
+		Reused,
+		Skipped,
+		Shared
+	};
+
+	/** Copy the visible count of a full sort back for the stats, one copy in flight per view */
+	void EnqueueVisibleCountReadback(FRDGBuilder& GraphBuilder, FGaussianSplatViewResources& Resources, FRDGBufferRef VisibleCountBuffer)
+	{
+#if STATS || CSV_PROFILER
+		if (Resources.bVisibleCountReadbackPending)
+		{
+			return;
+		}
+		if (!Resources.VisibleCountReadback)
+		{
+			Resources.VisibleCountReadback = MakeUnique<FRHIGPUBufferReadback>(TEXT("GaussianVisibleCountReadback"));
+		}
+		AddEnqueueCopyPass(GraphBuilder, Resources.VisibleCountReadback.Get(), VisibleCountBuffer, sizeof(uint32));
+		Resources.bVisibleCountReadbackPending = true;
+#endif
+	}
+
+	/**
+	 * Count a view's sort outcome and splats for "stat GaussianSplatting" and the CSV profile.
+	 * Visible and culled splats come from the latest completed readback, a few frames behind the GPU.
+	 */
+	void RecordSortStats(FGaussianSplatViewResources& Resources, ESortStat Outcome, int32 SubmittedSplats)
+	{
+#if STATS || CSV_PROFILER
+		if (Resources.bVisibleCountReadbackPending && Resources.VisibleCountReadback->IsReady())
+		{
+			const uint32* Count = static_cast<const uint32*>(Resources.VisibleCountReadback->Lock(sizeof(uint32)));
+			Resources.LastVisibleSplatCount = (int32)*Count;
+			Resources.VisibleCountReadback->Unlock();
+			Resources.bVisibleCountReadbackPending = false;
+		}
+
+		switch (Outcome)
+		{
+		case ESortStat::Full:
+			INC_DWORD_STAT(STAT_GaussianSplatSortFull);
+			CSV_CUSTOM_STAT(GaussianSplatting, FullSorts, 1, ECsvCustomStatOp::Accumulate);
+			break;
+		case ESortStat::Reused:
+			INC_DWORD_STAT(STAT_GaussianSplatSortReused);
+			CSV_CUSTOM_STAT(GaussianSplatting, ReusedSorts, 1, ECsvCustomStatOp::Accumulate);
+			break;
+		case ESortStat::Skipped:
+			INC_DWORD_STAT(STAT_GaussianSplatSortSkipped);
+			CSV_CUSTOM_STAT(GaussianSplatting, SkippedSorts, 1, ECsvCustomStatOp::Accumulate);
+			break;
+		case ESortStat::Shared:
+			INC_DWORD_STAT(STAT_GaussianSplatSortShared);
+			CSV_CUSTOM_STAT(GaussianSplatting, SharedSorts, 1, ECsvCustomStatOp::Accumulate);
+			break;
+		}
+
+		INC_DWORD_STAT_BY(STAT_GaussianSplatSubmittedSplats, SubmittedSplats);
+		CSV_CUSTOM_STAT(GaussianSplatting, SubmittedSplats, SubmittedSplats, ECsvCustomStatOp::Accumulate);
+		if (Resources.LastVisibleSplatCount >= 0)
+		{
+			const int32 VisibleSplats = FMath::Min(Resources.LastVisibleSplatCount, SubmittedSplats);
+			INC_DWORD_STAT_BY(STAT_GaussianSplatVisibleSplats, VisibleSplats);
+			INC_DWORD_STAT_BY(STAT_GaussianSplatCulledSplats, SubmittedSplats - VisibleSplats);
+			CSV_CUSTOM_STAT(GaussianSplatting, VisibleSplats, VisibleSplats, ECsvCustomStatOp::Accumulate);
+			CSV_CUSTOM_STAT(GaussianSplatting, CulledSplats, SubmittedSplats - VisibleSplats, ECsvCustomStatOp::Accumulate);
+		}
+#endif
+	}
+
+	/** Copy the tile rasterizer's clamped and requested entry counts back for the stats, one copy in flight per view */
+	void EnqueueTileEntryCountReadback(FRDGBuilder& GraphBuilder, FGaussianSplatViewResources& Resources, FRDGBufferRef EntryCountBuffer)
+	{
+#if STATS || CSV_PROFILER
+		if (Resources.bTileEntryCountReadbackPending)
+		{
+			return;
+		}
+		if (!Resources.TileEntryCountReadback)
+		{
+			Resources.TileEntryCountReadback = MakeUnique<FRHIGPUBufferReadback>(TEXT("GaussianTileEntryCountReadback"));
+		}
+		AddEnqueueCopyPass(GraphBuilder, Resources.TileEntryCountReadback.Get(), EntryCountBuffer, 2 * sizeof(uint32));
+		Resources.bTileEntryCountReadbackPending = true;
+#endif
+	}
+
+	/**
+	 * Count the tile entries a view dropped for lack of capacity, from the latest completed readback.
+	 * Warns once, since dropped entries are the farthest splats of crowded tiles missing from the image.
+	 */
+	void RecordTileRasterStats(FGaussianSplatViewResources& Resources)
+	{
+#if STATS || CSV_PROFILER
+		if (Resources.bTileEntryCountReadbackPending && Resources.TileEntryCountReadback->IsReady())
+		{
+			const uint32* Counts = static_cast<const uint32*>(Resources.TileEntryCountReadback->Lock(2 * sizeof(uint32)));
+			Resources.LastDroppedTileEntries = (int32)FMath::Min<uint32>(Counts[1] - Counts[0], MAX_int32);
+			Resources.TileEntryCountReadback->Unlock();
+			Resources.bTileEntryCountReadbackPending = false;
+
+			static bool bWarnedDroppedEntries = false;
+			if (Resources.LastDroppedTileEntries > 0 && !bWarnedDroppedEntries)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: Tile rasterizer dropped %d entries of far splats, raise gs.TileRasterMaxEntriesPerSplat"),
+					Resources.LastDroppedTileEntries);
+				bWarnedDroppedEntries = true;
+			}
+		}
+
+		INC_DWORD_STAT_BY(STAT_GaussianSplatTileRasterDroppedEntries, Resources.LastDroppedTileEntries);
+		CSV_CUSTOM_STAT(GaussianSplatting, TileRasterDroppedEntries, Resources.LastDroppedTileEntries, ECsvCustomStatOp::Accumulate);
+#endif
+	}
+
+	/** Batched view buffers grow in steps of this many splats so visibility changes rarely reallocate */
+	constexpr int32 BatchCapacityGranularity = 64 * 1024;
+
+	/** Hash of everything a batch's view data depends on besides the camera */
+	uint32 ComputeBatchHash(TConstArrayView<FGaussianSplatBatchItem> Items)
+	{
+		uint32 Hash = 0;
+		for (const FGaussianSplatBatchItem& Item : Items)
+		{
+			Hash = HashCombineFast(Hash, PointerHash(Item.GPUResources));
+			Hash = FCrc::MemCrc32(&Item.LocalToWorld, sizeof(FMatrix), Hash);
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.SplatOffset));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.SplatCount));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.SHOrder));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.OpacityScale));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.SplatScale));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.GPUResources->ColorTextureSRV.IsValid()));
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Item.GPUResources->GetDynamicRevision()));
+		}
+		return Hash;
+	}
+
+	/** Hash of what a proxy's cached SH colors are evaluated from, see FGaussianSplatViewResources::RegisterSHCacheBuffers */
+	uint32 HashSHCacheInputs(uint32 Hash, const FGaussianSplatGPUResources* GPUResources, int32 SplatOffset, int32 SplatCount, int32 SHOrder)
+	{
+		Hash = HashCombineFast(Hash, PointerHash(GPUResources));
+		Hash = HashCombineFast(Hash, ::GetTypeHash(SplatOffset));
+		Hash = HashCombineFast(Hash, ::GetTypeHash(SplatCount));
+		Hash = HashCombineFast(Hash, ::GetTypeHash(SHOrder));
+		return HashCombineFast(Hash, ::GetTypeHash(GPUResources->ColorTextureSRV.IsValid()));
+	}
+
+	/** True when CalcViewData evaluates SH bands above DC for a proxy */
+	bool UsesViewDependentColor(const FGaussianSplatGPUResources* GPUResources, int32 SHOrder)
+	{
+		return FMath::Min(SHOrder, GPUResources->UploadedSHBands) > 0 && GPUResources->ColorTextureSRV.IsValid();
+	}
+
+	/**
+	 * Register the view's SH color cache when gs.SHCacheAngle is set
+	 * @param NumElements Number of splats the view data buffer holds
+	 * @return False when the cache is off, SH is then evaluated for every splat
+	 */
+	bool SetupSHCache(FRDGBuilder& GraphBuilder, FGaussianSplatViewResources& ViewResources, int32 NumElements, uint32 CacheKey, ERDGPassFlags ComputePassFlags, FGaussianSplatSHCacheTargets& OutTargets)
+	{
+		const float AngleDegrees = CVarGaussianSplatSHCacheAngle.GetValueOnRenderThread();
+		if (AngleDegrees <= 0.0f)
+		{
+			return false;
+		}
+
+		ViewResources.RegisterSHCacheBuffers(GraphBuilder, NumElements, CacheKey, ComputePassFlags, OutTargets.ColorBuffer, OutTargets.DirectionBuffer);
+		OutTargets.CosAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Min(AngleDegrees, 90.0f)));
+		return true;
+	}
+
+	int32 GetBatchSplatCount(TConstArrayView<FGaussianSplatBatchItem> Items)
+	{
+		int32 Total = 0;
+		for (const FGaussianSplatBatchItem& Item : Items)
+		{
+			Total += GetChunkAlignedSplatCount(Item.SplatCount);
+		}
+		return Total;
+	}
+}
+
+using namespace GaussianSplatRendererPrivate;
 
 FGaussianSplatRenderer::FGaussianSplatRenderer()
 {
@@ -22,85 +798,530 @@ FGaussianSplatRenderer::~FGaussianSplatRenderer()
 {
 }
 
-uint32 FGaussianSplatRenderer::NextPowerOfTwo(uint32 Value)
+double FGaussianSplatRenderer::BenchmarkSort(FRHICommandListImmediate& RHICmdList, int32 NumKeys, uint32 SortKeyBits, int32 Iterations)
 {
-	Value--;
-	Value |= Value >> 1;
-	Value |= Value >> 2;
-	Value |= Value >> 4;
-	Value |= Value >> 8;
-	Value |= Value >> 16;
-	Value++;
-	return Value;
+	check(IsInRenderingThread());
+	if (!GSupportsTimestampRenderQueries || NumKeys <= 0 || Iterations <= 0)
+	{
+		return -1.0;
+	}
+	SortKeyBits = SortKeyBits <= 16 ? 16 : (SortKeyBits <= 24 ? 24 : 32);
+
+	// Uniformly distributed keys within the key width, values are the key indices like CalcViewData writes
+	TArray<uint32> SourceKeys;
+	TArray<uint32> SourceValues;
+	SourceKeys.SetNumUninitialized(NumKeys);
+	SourceValues.SetNumUninitialized(NumKeys);
+	FRandomStream Random(NumKeys);
+	const uint32 KeyMask = SortKeyBits == 32 ? 0xFFFFFFFFu : ((1u << SortKeyBits) - 1);
+	for (int32 Index = 0; Index < NumKeys; Index++)
+	{
+		SourceKeys[Index] = ((uint32)Random.GetUnsignedInt()) & KeyMask;
+		SourceValues[Index] = (uint32)Index;
+	}
+	const uint32 SortCount[1] = { (uint32)NumKeys };
+	const uint32 SortDispatchArgs[3] = { FMath::DivideAndRoundUp((uint32)NumKeys, RadixSortTileSize), 1, 1 };
+
+	// Timestamps: before the copy-only loop, between the loops and after the copy+sort loop
+	FRenderQueryRHIRef Timestamps[3];
+	for (FRenderQueryRHIRef& Timestamp : Timestamps)
+	{
+		Timestamp = RHICreateRenderQuery(RQT_AbsoluteTime);
+	}
+
+	{
+		FRDGBuilder GraphBuilder(RHICmdList);
+
+		FRDGBufferRef KeysSource = CreateStructuredBuffer(GraphBuilder, TEXT("GaussianBenchmarkKeys"), sizeof(uint32), NumKeys, SourceKeys.GetData(), SourceKeys.Num() * sizeof(uint32));
+		FRDGBufferRef ValuesSource = CreateStructuredBuffer(GraphBuilder, TEXT("GaussianBenchmarkValues"), sizeof(uint32), NumKeys, SourceValues.GetData(), SourceValues.Num() * sizeof(uint32));
+		FRDGBufferRef SortCountBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GaussianBenchmarkSortCount"), sizeof(uint32), 1, SortCount, sizeof(SortCount));
+		FRDGBufferRef SortDispatchArgsBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(1), TEXT("GaussianBenchmarkSortDispatchArgs"));
+		GraphBuilder.QueueBufferUpload(SortDispatchArgsBuffer, SortDispatchArgs, sizeof(SortDispatchArgs));
+
+		FRDGBufferRef DistanceBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumKeys), TEXT("GaussianSortDistanceBuffer"));
+		FRDGBufferRef SortKeysBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumKeys), TEXT("GaussianSortKeysBuffer"));
+		FRDGBufferRef UnsortedKeysBuffer = GetUnsortedKeysBuffer(GraphBuilder, SortKeysBuffer, SortKeyBits, NumKeys);
+
+		auto AddTimestampPass = [&GraphBuilder](FRHIRenderQuery* Timestamp)
+		{
+			GraphBuilder.AddPass(RDG_EVENT_NAME("GaussianBenchmarkTimestamp"), ERDGPassFlags::NeverCull,
+				[Timestamp](FRHICommandListImmediate& InRHICmdList)
+				{
+					InRHICmdList.EndRenderQuery(Timestamp);
+				});
+		};
+
+		// Every sort starts from the unsorted keys, the cost of restoring them is timed on its own and subtracted
+		AddTimestampPass(Timestamps[0]);
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			AddCopyBufferPass(GraphBuilder, DistanceBuffer, KeysSource);
+			AddCopyBufferPass(GraphBuilder, UnsortedKeysBuffer, ValuesSource);
+		}
+		AddTimestampPass(Timestamps[1]);
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			AddCopyBufferPass(GraphBuilder, DistanceBuffer, KeysSource);
+			AddCopyBufferPass(GraphBuilder, UnsortedKeysBuffer, ValuesSource);
+			DispatchRadixSort(GraphBuilder, DistanceBuffer, UnsortedKeysBuffer, SortKeysBuffer, SortCountBuffer, SortDispatchArgsBuffer, NumKeys, SortKeyBits, ERDGPassFlags::Compute);
+		}
+		AddTimestampPass(Timestamps[2]);
+
+		GraphBuilder.Execute();
+	}
+	RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThread);
+
+	uint64 Microseconds[3] = { 0, 0, 0 };
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		if (!RHIGetRenderQueryResult(Timestamps[Index], Microseconds[Index], true))
+		{
+			return -1.0;
+		}
+	}
+	const double CopyMicroseconds = (double)(Microseconds[1] - Microseconds[0]);
+	const double SortMicroseconds = (double)(Microseconds[2] - Microseconds[1]) - CopyMicroseconds;
+	return FMath::Max(SortMicroseconds, 0.0) / 1000.0 / Iterations;
 }
 
-void FGaussianSplatRenderer::Render(
-	FRHICommandListImmediate& RHICmdList,
+int64 FGaussianSplatRenderer::GetSortScratchBytes()
+{
+	return SortScratchBytes;
+}
+
+ERDGPassFlags FGaussianSplatRenderer::GetComputePassFlags()
+{
+	const bool bUseAsyncCompute = CVarGaussianSplatAsyncCompute.GetValueOnRenderThread() != 0 && GSupportsEfficientAsyncCompute;
+	return bUseAsyncCompute ? ERDGPassFlags::AsyncCompute : ERDGPassFlags::Compute;
+}
+
+bool FGaussianSplatRenderer::IsBatchingEnabled()
+{
+	return CVarGaussianSplatBatchProxies.GetValueOnRenderThread() != 0;
+}
+
+const FSceneView* FGaussianSplatRenderer::GetStereoPrimaryView(const FSceneView& View)
+{
+	return IStereoRendering::IsASecondaryView(View) ? GetStereoPartnerView(View) : nullptr;
+}
+
+void FGaussianSplatRenderer::GatherBatchItems(
+	const FSceneView& View,
+	TConstArrayView<FGaussianSplatSceneProxy*> Proxies,
+	TArray<FGaussianSplatBatchItem>& OutItems)
+{
+	OutItems.Reset(Proxies.Num());
+
+	for (FGaussianSplatSceneProxy* Proxy : Proxies)
+	{
+		if (!Proxy->IsRenderableInView(View))
+		{
+			continue;
+		}
+
+		FGaussianSplatBatchItem& Item = OutItems.AddDefaulted_GetRef();
+		Item.GPUResources = Proxy->GetGPUResources();
+		Item.LocalToWorld = Proxy->GetLocalToWorld();
+		Item.Bounds = Proxy->GetBounds();
+		Proxy->SelectLOD(View, Item.SplatOffset, Item.SplatCount);
+		Item.SHOrder = Proxy->GetSHOrder();
+		Item.OpacityScale = Proxy->GetOpacityScale();
+		Item.SplatScale = Proxy->GetSplatScale();
+	}
+}
+
+void FGaussianSplatRenderer::AddComputePasses(
+	FRDGBuilder& GraphBuilder,
 	const FSceneView& View,
 	FGaussianSplatGPUResources* GPUResources,
+	FGaussianSplatViewResources* ViewResources,
+	FGaussianSplatViewResources* StereoPrimaryResources,
 	const FMatrix& LocalToWorld,
+	const FBoxSphereBounds& Bounds,
+	int32 SplatOffset,
 	int32 SplatCount,
 	int32 SHOrder,
 	float OpacityScale,
-	float SplatScale)
+	float SplatScale,
+	ERDGPassFlags ComputePassFlags)
 {
-	if (!GPUResources || !GPUResources->IsValid() || SplatCount <= 0)
+	SCOPE_CYCLE_COUNTER(STAT_GaussianSplatAddComputePasses);
+
+	// Each view keeps its own view data and sort results, so views never overwrite each other
+	if (!GPUResources || !GPUResources->IsValid() || !ViewResources || SplatCount <= 0)
 	{
 		return;
 	}
 
-	SCOPED_DRAW_EVENT(RHICmdList, GaussianSplatRendering);
+	FRDGBufferRef ViewDataBuffer = nullptr;
+	FRDGBufferRef SortKeysBuffer = nullptr;
+	FRDGBufferRef DrawArgsBuffer = nullptr;
+	ViewResources->RegisterBuffers(GraphBuilder, GetChunkAlignedSplatCount(SplatCount), ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer);
+	ViewResources->MarkPrepared(View);
 
 	// Check if we have a valid ColorTexture for CalcViewData
 	bool bHasColorTexture = GPUResources->ColorTextureSRV.IsValid();
 
-	// Camera-static sort skipping: skip entire compute pipeline when nothing has changed
-	FMatrix CurrentVP = View.ViewMatrices.GetViewProjectionMatrix();
-	bool bCanSkipCompute = GPUResources->bHasCachedSortData &&
-		GPUResources->CachedViewProjectionMatrix.Equals(CurrentVP, 0.0f) &&
-		GPUResources->CachedLocalToWorld.Equals(LocalToWorld, 0.0f) &&
-		GPUResources->CachedOpacityScale == OpacityScale &&
-		GPUResources->CachedSplatScale == SplatScale &&
-		GPUResources->CachedHasColorTexture == bHasColorTexture;
+	// Shared stereo sort: the primary eye culls and sorts for both eyes, the secondary eye draws in that order
+	// when the primary eye was set up first for the same splats, and sorts on its own otherwise
+	const FSceneView* StereoView = GetStereoPartnerView(View);
+	bool bStereoSecondary = false;
+	if (StereoView && IStereoRendering::IsASecondaryView(View))
+	{
+		bStereoSecondary = CanShareStereoSort(View, *StereoView, StereoPrimaryResources) &&
+			StereoPrimaryResources->CachedSplatOffset == SplatOffset &&
+			StereoPrimaryResources->CachedSplatCount == SplatCount;
+		StereoView = bStereoSecondary ? StereoView : nullptr;
+	}
+	const FMatrix StereoVP = GetStereoViewProjectionMatrix(StereoView);
+
+	// Everything besides the camera that the view data and sort order depend on
+	FMatrix CurrentVP = GetViewProjectionMatrixNoAA(View);
+	const uint32 SortKeyBits = GetSortKeyBits(View);
+	const bool bSameInputs = ViewResources->bHasCachedSortData &&
+		ViewResources->bCachedStereoSecondary == bStereoSecondary &&
+		ViewResources->CachedSortKeyBits == SortKeyBits &&
+		ViewResources->CachedSplatOffset == SplatOffset &&
+		ViewResources->CachedSplatCount == SplatCount &&
+		ViewResources->CachedLocalToWorld.Equals(LocalToWorld, 0.0f) &&
+		ViewResources->CachedOpacityScale == OpacityScale &&
+		ViewResources->CachedSplatScale == SplatScale &&
+		ViewResources->CachedHasColorTexture == bHasColorTexture &&
+		ViewResources->CachedSHOrder == SHOrder &&
+		ViewResources->CachedDynamicRevision == GPUResources->GetDynamicRevision();
+
+	// Camera-static sort skipping: skip entire compute pipeline when nothing has changed for this view
+	if (bSameInputs && ViewResources->CachedViewProjectionMatrix.Equals(CurrentVP, 0.0f) &&
+		ViewResources->CachedStereoViewProjectionMatrix.Equals(StereoVP, 0.0f) &&
+		!IsOcclusionCulledSortExpired(View, *ViewResources))
+	{
+		RecordSortStats(*ViewResources, ESortStat::Skipped, SplatCount);
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatCompute");
 
-	if (!bCanSkipCompute)
+	const FVector2f DepthRange = GetViewDepthRange(View, MakeArrayView(&Bounds, 1));
+
+	// View-dependent color is cached per chunk while the direction to it barely changes
+	FGaussianSplatSHCacheTargets SHCacheTargets;
+	const FGaussianSplatSHCacheTargets* SHCache = UsesViewDependentColor(GPUResources, SHOrder) &&
+		SetupSHCache(GraphBuilder, *ViewResources, GetChunkAlignedSplatCount(SplatCount), HashSHCacheInputs(0, GPUResources, SplatOffset, SplatCount, SHOrder), ComputePassFlags, SHCacheTargets)
+		? &SHCacheTargets : nullptr;
+
+	// Temporal sort reuse: small camera motion keeps the last order, refined against the new view data
+	// The reused order may reference splats of chunks that left the view, so every chunk is computed
+	// Refining re-keys at this eye's depth only, so a shared stereo order is always sorted in full
+	if (bSameInputs && !StereoView && CanReuseSortOrder(View, *ViewResources))
 	{
-		// Step 1: Calculate view data for each splat
-		DispatchCalcViewData(RHICmdList, View, GPUResources, LocalToWorld, SplatCount, SHOrder, OpacityScale, SplatScale, bHasColorTexture);
+		DispatchCalcViewData(GraphBuilder, View, nullptr, GPUResources, ViewDataBuffer, 0, nullptr, SHCache, false, LocalToWorld, SplatOffset, SplatCount, SHOrder, OpacityScale, SplatScale, bHasColorTexture, ComputePassFlags);
+		DispatchRefineSort(GraphBuilder, View, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, SplatCount, SortKeyBits, DepthRange, GetRefineTileOffset(View), ComputePassFlags);
+		ViewResources->CachedViewProjectionMatrix = CurrentVP;
+		RecordSortStats(*ViewResources, ESortStat::Reused, SplatCount);
+		return;
+	}
 
-		// Step 2: Calculate sort distances
-		DispatchCalcDistances(RHICmdList, GPUResources, SplatCount);
+	if (bStereoSecondary)
+	{
+		// The primary eye's order covers the splats either eye sees, this eye's view data must cover them too
+		DispatchCalcViewData(GraphBuilder, View, StereoView, GPUResources, ViewDataBuffer, 0, nullptr, SHCache, true, LocalToWorld, SplatOffset, SplatCount, SHOrder, OpacityScale, SplatScale, bHasColorTexture, ComputePassFlags);
+		ViewResources->LastVisibleSplatCount = StereoPrimaryResources->LastVisibleSplatCount;
+		ViewResources->bOcclusionCulledSort = false;
+		RecordSortStats(*ViewResources, ESortStat::Shared, SplatCount);
+	}
+	else
+	{
+		// Distances are only needed while sorting, RDG can alias the transient buffer
+		FRDGBufferRef DistanceBuffer = CreateSortScratchBuffer(GraphBuilder, SplatCount, TEXT("GaussianSortDistanceBuffer"));
+		const FVisibleSplatBuffers VisibleBuffers = CreateVisibleSplatBuffers(GraphBuilder, ComputePassFlags);
+		FRDGBufferRef UnsortedKeysBuffer = GetUnsortedKeysBuffer(GraphBuilder, SortKeysBuffer, SortKeyBits, SplatCount);
+
+		// Step 1: Calculate view data for each splat of the chunks in view, appending the survivors' sort keys
+		const FGaussianSplatSortKeyTargets SortKeyTargets = { DistanceBuffer, UnsortedKeysBuffer, VisibleBuffers.VisibleCountBuffer, SortKeyBits, DepthRange, GetOcclusionHZB(View, StereoView) };
+		DispatchCalcViewData(GraphBuilder, View, StereoView, GPUResources, ViewDataBuffer, 0, &SortKeyTargets, SHCache, true, LocalToWorld, SplatOffset, SplatCount, SHOrder, OpacityScale, SplatScale, bHasColorTexture, ComputePassFlags);
+		DispatchBuildIndirectArgs(GraphBuilder, VisibleBuffers.VisibleCountBuffer, VisibleBuffers.SortDispatchArgsBuffer, DrawArgsBuffer, ComputePassFlags);
+
+		// Step 2: Sort the visible splats back-to-front
+		DispatchRadixSort(GraphBuilder, DistanceBuffer, UnsortedKeysBuffer, SortKeysBuffer, VisibleBuffers.VisibleCountBuffer, VisibleBuffers.SortDispatchArgsBuffer, SplatCount, SortKeyBits, ComputePassFlags);
+		RecordFullSort(View, *ViewResources);
+		ViewResources->bOcclusionCulledSort = SortKeyTargets.OcclusionHZB != nullptr;
+		EnqueueVisibleCountReadback(GraphBuilder, *ViewResources, VisibleBuffers.VisibleCountBuffer);
+		RecordSortStats(*ViewResources, ESortStat::Full, SplatCount);
+	}
 
-		// Step 3: Sort splats back-to-front
-		DispatchRadixSort(RHICmdList, GPUResources, SplatCount);
+	// Update cache
+	ViewResources->CachedViewProjectionMatrix = CurrentVP;
+	ViewResources->CachedStereoViewProjectionMatrix = StereoVP;
+	ViewResources->bCachedStereoSecondary = bStereoSecondary;
+	ViewResources->CachedLocalToWorld = LocalToWorld;
+	ViewResources->CachedOpacityScale = OpacityScale;
+	ViewResources->CachedSplatScale = SplatScale;
+	ViewResources->CachedHasColorTexture = bHasColorTexture;
+	ViewResources->CachedSHOrder = SHOrder;
+	ViewResources->CachedSortKeyBits = SortKeyBits;
+	ViewResources->CachedSplatOffset = SplatOffset;
+	ViewResources->CachedSplatCount = SplatCount;
+	ViewResources->CachedDynamicRevision = GPUResources->GetDynamicRevision();
+	ViewResources->bHasCachedSortData = true;
+}
 
-		// Update cache
-		GPUResources->CachedViewProjectionMatrix = CurrentVP;
-		GPUResources->CachedLocalToWorld = LocalToWorld;
-		GPUResources->CachedOpacityScale = OpacityScale;
-		GPUResources->CachedSplatScale = SplatScale;
-		GPUResources->CachedHasColorTexture = bHasColorTexture;
-		GPUResources->bHasCachedSortData = true;
+void FGaussianSplatRenderer::Render(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FGaussianSplatGPUResources* GPUResources,
+	FGaussianSplatViewResources* ViewResources,
+	FGaussianSplatViewResources* StereoPrimaryResources,
+	const FMatrix& LocalToWorld,
+	const FBoxSphereBounds& Bounds,
+	int32 SplatOffset,
+	int32 SplatCount,
+	int32 SHOrder,
+	float OpacityScale,
+	float SplatScale,
+	const FRenderTargetBindingSlots& RenderTargets)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GaussianSplatRender);
+
+	if (!GPUResources || !GPUResources->IsValid() || !ViewResources || SplatCount <= 0)
+	{
+		return;
+	}
+
+	// Views that did not go through PreRenderView (or proxies added mid-frame) compute inline
+	if (!ViewResources->IsPreparedFor(View))
+	{
+		AddComputePasses(GraphBuilder, View, GPUResources, ViewResources, StereoPrimaryResources, LocalToWorld, Bounds, SplatOffset, SplatCount, SHOrder, OpacityScale, SplatScale, ERDGPassFlags::Compute);
+	}
+
+	FRDGBufferRef ViewDataBuffer = nullptr;
+	FRDGBufferRef SortKeysBuffer = nullptr;
+	FRDGBufferRef DrawArgsBuffer = nullptr;
+	ViewResources->RegisterBuffers(GraphBuilder, GetChunkAlignedSplatCount(SplatCount), ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer);
+
+	// A secondary eye sharing the primary eye's sort draws its own view data in that order
+	if (ViewResources->bCachedStereoSecondary && StereoPrimaryResources)
+	{
+		FRDGBufferRef PrimaryViewDataBuffer = nullptr;
+		StereoPrimaryResources->RegisterBuffers(GraphBuilder, GetChunkAlignedSplatCount(SplatCount), PrimaryViewDataBuffer, SortKeysBuffer, DrawArgsBuffer);
+	}
+
+	// Step 3: Draw the splats (always — uses cached buffers when compute is skipped)
+	DrawSplats(GraphBuilder, View, *ViewResources, GPUResources, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, SplatCount, RenderTargets);
+}
+
+void FGaussianSplatRenderer::AddBatchedComputePasses(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FGaussianSplatViewResources* BatchResources,
+	FGaussianSplatViewResources* StereoPrimaryBatchResources,
+	TConstArrayView<FGaussianSplatBatchItem> Items,
+	ERDGPassFlags ComputePassFlags)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GaussianSplatAddComputePasses);
+
+	const int32 TotalSplatCount = GetBatchSplatCount(Items);
+	if (!BatchResources || TotalSplatCount <= 0)
+	{
+		return;
+	}
+
+	FRDGBufferRef ViewDataBuffer = nullptr;
+	FRDGBufferRef SortKeysBuffer = nullptr;
+	FRDGBufferRef DrawArgsBuffer = nullptr;
+	BatchResources->RegisterBuffers(GraphBuilder, Align(TotalSplatCount, BatchCapacityGranularity), ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer);
+	BatchResources->MarkPrepared(View);
+
+	// Everything besides the camera that the batch's view data and sort order depend on
+	const FMatrix CurrentVP = GetViewProjectionMatrixNoAA(View);
+	const uint32 BatchHash = ComputeBatchHash(Items);
+	const uint32 SortKeyBits = GetSortKeyBits(View);
+
+	// Shared stereo sort, see AddComputePasses
+	const FSceneView* StereoView = GetStereoPartnerView(View);
+	bool bStereoSecondary = false;
+	if (StereoView && IStereoRendering::IsASecondaryView(View))
+	{
+		bStereoSecondary = CanShareStereoSort(View, *StereoView, StereoPrimaryBatchResources) &&
+			StereoPrimaryBatchResources->CachedBatchHash == BatchHash &&
+			StereoPrimaryBatchResources->CachedBatchSplatCount == TotalSplatCount;
+		StereoView = bStereoSecondary ? StereoView : nullptr;
+	}
+	const FMatrix StereoVP = GetStereoViewProjectionMatrix(StereoView);
+
+	int32 SubmittedSplats = 0;
+	for (const FGaussianSplatBatchItem& Item : Items)
+	{
+		SubmittedSplats += Item.SplatCount;
+	}
+
+	const bool bSameInputs = BatchResources->bHasCachedSortData &&
+		BatchResources->bCachedStereoSecondary == bStereoSecondary &&
+		BatchResources->CachedSortKeyBits == SortKeyBits &&
+		BatchResources->CachedBatchHash == BatchHash &&
+		BatchResources->CachedBatchSplatCount == TotalSplatCount;
+
+	// Camera-static sort skipping: the batch is reusable while the camera and every item are unchanged
+	if (bSameInputs && BatchResources->CachedViewProjectionMatrix.Equals(CurrentVP, 0.0f) &&
+		BatchResources->CachedStereoViewProjectionMatrix.Equals(StereoVP, 0.0f) &&
+		!IsOcclusionCulledSortExpired(View, *BatchResources))
+	{
+		RecordSortStats(*BatchResources, ESortStat::Skipped, SubmittedSplats);
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatBatchedCompute(%d proxies)", Items.Num());
+
+	// Quantized keys span the depth extent of every proxy in the batch
+	TArray<FBoxSphereBounds, TInlineAllocator<16>> ItemBounds;
+	for (const FGaussianSplatBatchItem& Item : Items)
+	{
+		ItemBounds.Add(Item.Bounds);
+	}
+	const FVector2f DepthRange = GetViewDepthRange(View, ItemBounds);
+
+	// SH color cache over the whole batch buffer, any item changing moves the slices after it
+	uint32 SHCacheKey = 0;
+	bool bAnyViewDependentColor = false;
+	for (const FGaussianSplatBatchItem& Item : Items)
+	{
+		SHCacheKey = HashSHCacheInputs(SHCacheKey, Item.GPUResources, Item.SplatOffset, Item.SplatCount, Item.SHOrder);
+		bAnyViewDependentColor |= UsesViewDependentColor(Item.GPUResources, Item.SHOrder);
+	}
+	FGaussianSplatSHCacheTargets SHCacheTargets;
+	const FGaussianSplatSHCacheTargets* SHCache = bAnyViewDependentColor &&
+		SetupSHCache(GraphBuilder, *BatchResources, Align(TotalSplatCount, BatchCapacityGranularity), SHCacheKey, ComputePassFlags, SHCacheTargets)
+		? &SHCacheTargets : nullptr;
+
+	// The reused order may reference splats of chunks that left the view, so reuse computes every chunk
+	// A shared stereo order is always sorted in full, a secondary eye only computes its view data
+	const bool bReuseSortOrder = bSameInputs && !StereoView && CanReuseSortOrder(View, *BatchResources);
+	const bool bEmitSortKeys = !bReuseSortOrder && !bStereoSecondary;
+
+	// A full sort appends the visible splats of every proxy to the same sort buffers
+	FGaussianSplatSortKeyTargets SortKeyTargets;
+	FVisibleSplatBuffers VisibleBuffers;
+	FRDGBufferRef UnsortedKeysBuffer = nullptr;
+	if (bEmitSortKeys)
+	{
+		VisibleBuffers = CreateVisibleSplatBuffers(GraphBuilder, ComputePassFlags);
+		UnsortedKeysBuffer = GetUnsortedKeysBuffer(GraphBuilder, SortKeysBuffer, SortKeyBits, TotalSplatCount);
+		SortKeyTargets.DistanceBuffer = CreateSortScratchBuffer(GraphBuilder, TotalSplatCount, TEXT("GaussianSortDistanceBuffer"));
+		SortKeyTargets.KeysBuffer = UnsortedKeysBuffer;
+		SortKeyTargets.VisibleCountBuffer = VisibleBuffers.VisibleCountBuffer;
+		SortKeyTargets.SortKeyBits = SortKeyBits;
+		SortKeyTargets.DepthRange = DepthRange;
+		SortKeyTargets.OcclusionHZB = GetOcclusionHZB(View, StereoView);
 	}
 
-	// Step 4: Draw the splats (always — uses cached buffers when compute is skipped)
-	DrawSplats(RHICmdList, View, GPUResources, SplatCount);
+	// Step 1: Each proxy writes its view data into its chunk-aligned slice of the shared buffer
+	uint32 ViewDataOffset = 0;
+	for (const FGaussianSplatBatchItem& Item : Items)
+	{
+		const bool bHasColorTexture = Item.GPUResources->ColorTextureSRV.IsValid();
+		DispatchCalcViewData(GraphBuilder, View, StereoView, Item.GPUResources, ViewDataBuffer, ViewDataOffset, bEmitSortKeys ? &SortKeyTargets : nullptr, SHCache, !bReuseSortOrder,
+			Item.LocalToWorld, Item.SplatOffset, Item.SplatCount, Item.SHOrder, Item.OpacityScale, Item.SplatScale, bHasColorTexture, ComputePassFlags);
+		ViewDataOffset += GetChunkAlignedSplatCount(Item.SplatCount);
+	}
+
+	// Temporal sort reuse: small camera motion keeps the last order, refined against the new view data
+	if (bReuseSortOrder)
+	{
+		DispatchRefineSort(GraphBuilder, View, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, TotalSplatCount, SortKeyBits, DepthRange, GetRefineTileOffset(View), ComputePassFlags);
+		BatchResources->CachedViewProjectionMatrix = CurrentVP;
+		RecordSortStats(*BatchResources, ESortStat::Reused, SubmittedSplats);
+		return;
+	}
+
+	// Step 2: One radix sort across the visible splats of all proxies
+	if (bEmitSortKeys)
+	{
+		DispatchBuildIndirectArgs(GraphBuilder, VisibleBuffers.VisibleCountBuffer, VisibleBuffers.SortDispatchArgsBuffer, DrawArgsBuffer, ComputePassFlags);
+		DispatchRadixSort(GraphBuilder, SortKeyTargets.DistanceBuffer, UnsortedKeysBuffer, SortKeysBuffer, VisibleBuffers.VisibleCountBuffer, VisibleBuffers.SortDispatchArgsBuffer, TotalSplatCount, SortKeyBits, ComputePassFlags);
+		RecordFullSort(View, *BatchResources);
+		BatchResources->bOcclusionCulledSort = SortKeyTargets.OcclusionHZB != nullptr;
+		EnqueueVisibleCountReadback(GraphBuilder, *BatchResources, VisibleBuffers.VisibleCountBuffer);
+		RecordSortStats(*BatchResources, ESortStat::Full, SubmittedSplats);
+	}
+	else
+	{
+		BatchResources->LastVisibleSplatCount = StereoPrimaryBatchResources->LastVisibleSplatCount;
+		BatchResources->bOcclusionCulledSort = false;
+		RecordSortStats(*BatchResources, ESortStat::Shared, SubmittedSplats);
+	}
+
+	// Update cache
+	BatchResources->CachedViewProjectionMatrix = CurrentVP;
+	BatchResources->CachedStereoViewProjectionMatrix = StereoVP;
+	BatchResources->bCachedStereoSecondary = bStereoSecondary;
+	BatchResources->CachedBatchHash = BatchHash;
+	BatchResources->CachedBatchSplatCount = TotalSplatCount;
+	BatchResources->CachedSortKeyBits = SortKeyBits;
+	BatchResources->bHasCachedSortData = true;
+}
+
+void FGaussianSplatRenderer::RenderBatched(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FGaussianSplatViewResources* BatchResources,
+	FGaussianSplatViewResources* StereoPrimaryBatchResources,
+	TConstArrayView<FGaussianSplatBatchItem> Items,
+	const FRenderTargetBindingSlots& RenderTargets)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GaussianSplatRender);
+
+	const int32 TotalSplatCount = GetBatchSplatCount(Items);
+	if (!BatchResources || TotalSplatCount <= 0)
+	{
+		return;
+	}
+
+	// Compute inline if PreRenderView did not prepare this view, or the visible set changed since
+	if (!BatchResources->IsPreparedFor(View) ||
+		BatchResources->CachedBatchHash != ComputeBatchHash(Items) ||
+		BatchResources->CachedBatchSplatCount != TotalSplatCount)
+	{
+		AddBatchedComputePasses(GraphBuilder, View, BatchResources, StereoPrimaryBatchResources, Items, ERDGPassFlags::Compute);
+	}
+
+	FRDGBufferRef ViewDataBuffer = nullptr;
+	FRDGBufferRef SortKeysBuffer = nullptr;
+	FRDGBufferRef DrawArgsBuffer = nullptr;
+	BatchResources->RegisterBuffers(GraphBuilder, Align(TotalSplatCount, BatchCapacityGranularity), ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer);
+
+	// A secondary eye sharing the primary eye's sort draws its own view data in that order
+	if (BatchResources->bCachedStereoSecondary && StereoPrimaryBatchResources)
+	{
+		FRDGBufferRef PrimaryViewDataBuffer = nullptr;
+		StereoPrimaryBatchResources->RegisterBuffers(GraphBuilder, Align(TotalSplatCount, BatchCapacityGranularity), PrimaryViewDataBuffer, SortKeysBuffer, DrawArgsBuffer);
+	}
+
+	// Every GPU resource set owns an identical quad index buffer, any of them can drive the batched draw
+	DrawSplats(GraphBuilder, View, *BatchResources, Items[0].GPUResources, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, TotalSplatCount, RenderTargets);
 }
 
 void FGaussianSplatRenderer::DispatchCalcViewData(
-	FRHICommandListImmediate& RHICmdList,
+	FRDGBuilder& GraphBuilder,
 	const FSceneView& View,
+	const FSceneView* StereoView,
 	FGaussianSplatGPUResources* GPUResources,
+	FRDGBufferRef ViewDataBuffer,
+	uint32 ViewDataOffset,
+	const FGaussianSplatSortKeyTargets* SortKeyTargets,
+	const FGaussianSplatSHCacheTargets* SHCacheTargets,
+	bool bCullChunks,
 	const FMatrix& LocalToWorld,
+	int32 SplatOffset,
 	int32 SplatCount,
 	int32 SHOrder,
 	float OpacityScale,
 	float SplatScale,
-	bool bHasColorTexture)
+	bool bHasColorTexture,
+	ERDGPassFlags ComputePassFlags)
 {
-	SCOPED_DRAW_EVENT(RHICmdList, GaussianSplatCalcViewData);
-
-	TShaderMapRef<FGaussianSplatCalcViewDataCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderRef<FGaussianSplatCalcViewDataCS> ComputeShader = GetShaders().CalcViewData;
 
 	if (!ComputeShader.IsValid())
 	{
@@ -108,103 +1329,324 @@ void FGaussianSplatRenderer::DispatchCalcViewData(
 		return;
 	}
 
-	// Transition buffers for compute
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->ViewDataBuffer, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatViewData);
+
+	// Slices and LOD levels start on chunk boundaries, so a proxy's chunks map to consecutive entries
+	check(ViewDataOffset % GaussianSplattingConstants::SplatsPerChunk == 0);
+	check(SplatOffset % GaussianSplattingConstants::SplatsPerChunk == 0);
+
+	// Dynamic splats move away from the asset's chunk bounds, so neither chunk culling nor the per-chunk SH cache applies
+	const bool bDynamicSplats = GPUResources->HasDynamicSplats() && SplatOffset == 0;
+	if (bDynamicSplats)
+	{
+		bCullChunks = false;
+		SHCacheTargets = nullptr;
+	}
 
-	FGaussianSplatCalcViewDataCS::FParameters Parameters;
-	Parameters.PositionBuffer = GPUResources->PositionBufferSRV;
-	Parameters.OtherDataBuffer = GPUResources->OtherDataBufferSRV;
-	Parameters.SHBuffer = GPUResources->SHBufferSRV;
-	Parameters.ChunkBuffer = GPUResources->ChunkBufferSRV;
-	Parameters.ColorTexture = GPUResources->GetColorTextureSRVOrDummy();  // Uses dummy texture if real one not available
-	Parameters.ColorSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	Parameters.ViewDataBuffer = GPUResources->ViewDataBufferUAV;
+	FRDGBufferRef VisibleChunkList = nullptr;
+	FRDGBufferRef ChunkDispatchArgs = nullptr;
+	DispatchCullChunks(GraphBuilder, View, StereoView, GPUResources, LocalToWorld, SplatOffset, SplatCount, SplatScale,
+		bCullChunks, VisibleChunkList, ChunkDispatchArgs, ComputePassFlags);
+	if (!VisibleChunkList)
+	{
+		return;
+	}
+
+	FGaussianSplatCalcViewDataCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatCalcViewDataCS::FParameters>();
+	Parameters->PositionBuffer = GPUResources->PositionBufferSRV;
+	Parameters->OtherDataBuffer = GPUResources->OtherDataBufferSRV;
+	Parameters->SHBuffer = GPUResources->SHBufferSRV;
+	Parameters->ChunkBuffer = GPUResources->ChunkBufferSRV;
+	Parameters->ColorTexture = GPUResources->GetColorTextureSRVOrDummy();  // Uses dummy texture if real one not available
+	Parameters->ColorSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	Parameters->ViewDataBuffer = GraphBuilder.CreateUAV(ViewDataBuffer);
+	Parameters->VisibleChunkList = GraphBuilder.CreateSRV(VisibleChunkList);
+	if (bDynamicSplats)
+	{
+		Parameters->DynamicSplatBuffer = GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(GPUResources->GetDynamicRenderBuffer()));
+	}
+	else
+	{
+		static const FGaussianSplatDynamicData DummyDynamicSplat;
+		Parameters->DynamicSplatBuffer = GraphBuilder.CreateSRV(CreateStructuredBuffer(GraphBuilder, TEXT("GaussianDummyDynamicSplats"),
+			sizeof(FGaussianSplatDynamicData), 1, &DummyDynamicSplat, sizeof(DummyDynamicSplat), ERDGInitialDataFlags::NoCopy));
+	}
+	if (SortKeyTargets)
+	{
+		Parameters->DistanceBuffer = GraphBuilder.CreateUAV(SortKeyTargets->DistanceBuffer);
+		Parameters->KeyBuffer = GraphBuilder.CreateUAV(SortKeyTargets->KeysBuffer);
+		Parameters->VisibleCountBuffer = GraphBuilder.CreateUAV(SortKeyTargets->VisibleCountBuffer);
+		Parameters->EmitSortKeys = 1;
+		Parameters->SortKeyBits = SortKeyTargets->SortKeyBits;
+		Parameters->DepthRangeNear = SortKeyTargets->DepthRange.X;
+		Parameters->DepthRangeInvLength = SortKeyTargets->DepthRange.Y;
+	}
+	else
+	{
+		// Nothing is appended, but every UAV has to be bound
+		FRDGBufferRef DummySortBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 1), TEXT("GaussianDummySortBuffer"));
+		Parameters->DistanceBuffer = GraphBuilder.CreateUAV(DummySortBuffer);
+		Parameters->KeyBuffer = GraphBuilder.CreateUAV(DummySortBuffer);
+		Parameters->VisibleCountBuffer = GraphBuilder.CreateUAV(DummySortBuffer);
+		Parameters->EmitSortKeys = 0;
+		Parameters->SortKeyBits = 32;
+	}
+	if (SHCacheTargets)
+	{
+		Parameters->SHColorCache = GraphBuilder.CreateUAV(SHCacheTargets->ColorBuffer);
+		Parameters->SHCacheDirections = GraphBuilder.CreateUAV(SHCacheTargets->DirectionBuffer);
+		Parameters->UseSHCache = 1;
+		Parameters->SHCacheCosAngle = SHCacheTargets->CosAngle;
+	}
+	else
+	{
+		Parameters->SHColorCache = GraphBuilder.CreateUAV(GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FUintVector2), 1), TEXT("GaussianDummySHColorCache")));
+		Parameters->SHCacheDirections = GraphBuilder.CreateUAV(GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), 1), TEXT("GaussianDummySHCacheDirections")));
+		Parameters->UseSHCache = 0;
+		Parameters->SHCacheCosAngle = 1.0f;
+	}
+	Parameters->IndirectArgs = ChunkDispatchArgs;
 
 	// Matrices
-	Parameters.LocalToWorld = FMatrix44f(LocalToWorld);
-	Parameters.WorldToClip = FMatrix44f(View.ViewMatrices.GetViewProjectionMatrix());
-	Parameters.WorldToView = FMatrix44f(View.ViewMatrices.GetViewMatrix());
-	Parameters.CameraPosition = FVector3f(View.ViewMatrices.GetViewOrigin());
+	Parameters->LocalToWorld = FMatrix44f(LocalToWorld);
+	Parameters->WorldToClip = FMatrix44f(GetViewProjectionMatrixNoAA(View));
+	Parameters->WorldToView = FMatrix44f(View.ViewMatrices.GetViewMatrix());
+	Parameters->CameraPosition = FVector3f(View.ViewMatrices.GetViewOrigin());
+	Parameters->StereoCull = StereoView ? 1 : 0;
+	Parameters->StereoWorldToClip = FMatrix44f(GetStereoViewProjectionMatrix(StereoView));
 
 	// Screen info
 	FIntRect ViewRect = View.UnscaledViewRect;
-	Parameters.ScreenSize = FVector2f(ViewRect.Width(), ViewRect.Height());
+	Parameters->ScreenSize = FVector2f(ViewRect.Width(), ViewRect.Height());
 
 	// Focal length approximation from projection matrix
 	const FMatrix& ProjMatrix = View.ViewMatrices.GetProjectionMatrix();
-	Parameters.FocalLength = FVector2f(
+	Parameters->FocalLength = FVector2f(
 		ProjMatrix.M[0][0] * ViewRect.Width() * 0.5f,
 		ProjMatrix.M[1][1] * ViewRect.Height() * 0.5f
 	);
 
-	Parameters.SplatCount = SplatCount;
-	Parameters.SHOrder = SHOrder;
-	Parameters.OpacityScale = OpacityScale;
-	Parameters.SplatScale = SplatScale;
-	Parameters.ColorTextureSize = FIntPoint(GaussianSplattingConstants::ColorTextureWidth,
-		FMath::DivideAndRoundUp(SplatCount, GaussianSplattingConstants::ColorTextureWidth));
-	Parameters.PositionFormat = 0;  // Always Float32 (simplified format)
-	Parameters.UseDefaultColor = bHasColorTexture ? 0 : 1;  // Use default color if no texture
-
-	// Dispatch compute shader
-	const uint32 ThreadGroupSize = 256;
-	const uint32 NumGroups = FMath::DivideAndRoundUp((uint32)SplatCount, ThreadGroupSize);
-
-	SetComputePipelineState(RHICmdList, ComputeShader.GetComputeShader());
-	SetShaderParameters(RHICmdList, ComputeShader, ComputeShader.GetComputeShader(), Parameters);
-	RHICmdList.DispatchComputeShader(NumGroups, 1, 1);
-	UnsetShaderUAVs(RHICmdList, ComputeShader, ComputeShader.GetComputeShader());
-
-	// Transition buffer for next stage
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->ViewDataBuffer, ERHIAccess::UAVCompute, ERHIAccess::SRVCompute));
+	Parameters->SplatCount = SplatCount;
+	Parameters->SplatOffset = SplatOffset;
+	Parameters->ViewDataOffset = ViewDataOffset;
+	Parameters->SHOrder = FMath::Min(SHOrder, GPUResources->UploadedSHBands);
+	Parameters->OpacityScale = OpacityScale;
+	Parameters->SplatScale = SplatScale;
+	Parameters->ColorTextureSize = GPUResources->ColorTexture.IsValid()
+		? GPUResources->ColorTexture->GetSizeXY()
+		: FIntPoint(GaussianSplattingConstants::ColorTextureWidth, GaussianSplattingUtils::GetColorTextureHeight(GPUResources->GetSplatCount(), GaussianSplattingConstants::ColorTextureWidth));
+	Parameters->PositionFormat = GPUResources->GetPositionFormatUint();
+	Parameters->ScaleFormat = GPUResources->GetScaleFormatUint();
+	Parameters->PrecomputedCovariance = GPUResources->bPrecomputedCovariance ? 1 : 0;
+	Parameters->UseDynamicSplats = bDynamicSplats ? 1 : 0;
+	Parameters->SHFormat = GPUResources->GetSHFormatUint();
+	Parameters->SHBandOffsets = GPUResources->SHBandOffsets;
+	Parameters->UseDefaultColor = bHasColorTexture ? 0 : 1;  // Use default color if no texture
+	Parameters->FoveationInnerRadius = FMath::Clamp(CVarGaussianSplatFoveationInnerRadius.GetValueOnRenderThread(), 0.0f, 1.0f);
+	Parameters->FoveationMinPixelSize = UseFoveation(View) ? FMath::Max(CVarGaussianSplatFoveationMinPixelSize.GetValueOnRenderThread(), 0.0f) : 0.0f;
+
+	// Occlusion culling against the HZB of an earlier frame, only while the survivors are appended to a sort
+	const FGaussianSplatOcclusionHZB* OcclusionHZB = SortKeyTargets ? SortKeyTargets->OcclusionHZB : nullptr;
+	if (OcclusionHZB)
+	{
+		Parameters->HZBTexture = GraphBuilder.RegisterExternalTexture(OcclusionHZB->Texture);
+		Parameters->UseOcclusionCulling = 1;
+		Parameters->HZBWorldToClip = OcclusionHZB->WorldToClip;
+		Parameters->HZBProjectionScale = OcclusionHZB->ProjectionScale;
+		Parameters->HZBDeviceZParams = OcclusionHZB->DeviceZParams;
+		Parameters->HZBUVToTexel = OcclusionHZB->UVToTexel;
+		Parameters->HZBSize = FUintVector2(OcclusionHZB->Size.X, OcclusionHZB->Size.Y);
+		Parameters->HZBNumMips = OcclusionHZB->NumMips;
+	}
+	else
+	{
+		Parameters->HZBTexture = GSystemTextures.GetBlackDummy(GraphBuilder);
+		Parameters->UseOcclusionCulling = 0;
+	}
+
+	// One group per visible chunk
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GaussianSplatCalcViewData"),
+		ComputePassFlags,
+		ComputeShader,
+		Parameters,
+		ChunkDispatchArgs,
+		0);
 }
 
-void FGaussianSplatRenderer::DispatchCalcDistances(
-	FRHICommandListImmediate& RHICmdList,
+void FGaussianSplatRenderer::DispatchCullChunks(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	const FSceneView* StereoView,
 	FGaussianSplatGPUResources* GPUResources,
-	int32 SplatCount)
+	const FMatrix& LocalToWorld,
+	int32 SplatOffset,
+	int32 SplatCount,
+	float SplatScale,
+	bool bCullChunks,
+	FRDGBufferRef& OutVisibleChunkList,
+	FRDGBufferRef& OutChunkDispatchArgs,
+	ERDGPassFlags ComputePassFlags)
+{
+	OutVisibleChunkList = nullptr;
+	OutChunkDispatchArgs = nullptr;
+
+	TShaderRef<FGaussianSplatCullChunksCS> ComputeShader = GetShaders().CullChunks;
+
+	if (!ComputeShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatCullChunksCS shader not valid"));
+		return;
+	}
+
+	const uint32 NumChunks = FMath::DivideAndRoundUp(SplatCount, GaussianSplattingConstants::SplatsPerChunk);
+	const uint32 ChunkOffset = SplatOffset / GaussianSplattingConstants::SplatsPerChunk;
+
+	// Assets without chunk bounds still go through the list, with every chunk visible
+	const bool bCullingEnabled = bCullChunks &&
+		CVarGaussianSplatChunkCulling.GetValueOnRenderThread() != 0 &&
+		GPUResources->GetNumChunks() >= (int32)(ChunkOffset + NumChunks);
+
+	OutVisibleChunkList = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumChunks), TEXT("GaussianVisibleChunkList"));
+	OutChunkDispatchArgs = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(1), TEXT("GaussianChunkDispatchArgs"));
+
+	FGaussianSplatCullChunksCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatCullChunksCS::FParameters>();
+	Parameters->ChunkBuffer = GPUResources->ChunkBufferSRV;
+	Parameters->VisibleChunkList = GraphBuilder.CreateUAV(OutVisibleChunkList);
+	Parameters->ChunkDispatchArgs = GraphBuilder.CreateUAV(OutChunkDispatchArgs, PF_R32_UINT);
+	Parameters->LocalToClip = FMatrix44f(LocalToWorld * GetViewProjectionMatrixNoAA(View));
+	Parameters->StereoLocalToClip = FMatrix44f(LocalToWorld * GetStereoViewProjectionMatrix(StereoView));
+	Parameters->StereoCull = StereoView ? 1 : 0;
+	Parameters->NumChunks = NumChunks;
+	Parameters->ChunkOffset = ChunkOffset;
+	Parameters->SplatScale = SplatScale;
+	Parameters->CullingEnabled = bCullingEnabled ? 1 : 0;
+
+	// Visible chunks are appended through the group count of the dispatch args
+	AddClearUAVPass(GraphBuilder, Parameters->ChunkDispatchArgs, 0, ComputePassFlags);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GaussianSplatCullChunks"),
+		ComputePassFlags,
+		ComputeShader,
+		Parameters,
+		FIntVector(FMath::DivideAndRoundUp(NumChunks, CullChunksGroupSize), 1, 1));
+}
+
+void FGaussianSplatRenderer::DispatchRefineSort(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FRDGBufferRef ViewDataBuffer,
+	FRDGBufferRef SortKeysBuffer,
+	FRDGBufferRef DrawArgsBuffer,
+	int32 MaxSortCount,
+	uint32 SortKeyBits,
+	const FVector2f& DepthRange,
+	uint32 TileOffset,
+	ERDGPassFlags ComputePassFlags)
 {
-	SCOPED_DRAW_EVENT(RHICmdList, GaussianSplatCalcDistances);
+	if (CVarGaussianSplatSortRefine.GetValueOnRenderThread() == 0)
+	{
+		return;
+	}
 
-	TShaderMapRef<FGaussianSplatCalcDistancesCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderRef<FGaussianSplatRefineSortCS> ComputeShader = GetShaders().RefineSort;
 
 	if (!ComputeShader.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatCalcDistancesCS shader not valid"));
+		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatRefineSortCS shader not valid"));
 		return;
 	}
 
-	// Transition buffers
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->SortDistanceBuffer, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->SortKeysBuffer, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatSort);
+
+	FGaussianSplatRefineSortCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatRefineSortCS::FParameters>();
+	Parameters->ViewDataBuffer = GraphBuilder.CreateSRV(ViewDataBuffer);
+	Parameters->SortKeysBuffer = GraphBuilder.CreateUAV(SortKeysBuffer);
+	Parameters->DrawArgs = GraphBuilder.CreateSRV(DrawArgsBuffer, PF_R32_UINT);
+	Parameters->SortKeyBits = SortKeyBits;
+	Parameters->DepthRangeNear = DepthRange.X;
+	Parameters->DepthRangeInvLength = DepthRange.Y;
+	Parameters->TileOffset = TileOffset;
+	Parameters->InvDeviceZToViewDepth = FVector4f(View.InvDeviceZToWorldZTransform);
+
+	// Tiles past the visible count exit immediately, the count lives on the GPU
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GaussianSplatRefineSort"),
+		ComputePassFlags,
+		ComputeShader,
+		Parameters,
+		FIntVector(FMath::DivideAndRoundUp((uint32)MaxSortCount, RefineSortTileSize), 1, 1));
+}
 
-	FGaussianSplatCalcDistancesCS::FParameters Parameters;
-	Parameters.ViewDataBuffer = GPUResources->ViewDataBufferSRV;
-	Parameters.DistanceBuffer = GPUResources->SortDistanceBufferUAV;
-	Parameters.KeyBuffer = GPUResources->SortKeysBufferUAV;
-	Parameters.SplatCount = SplatCount;
+void FGaussianSplatRenderer::DispatchBuildIndirectArgs(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef VisibleCountBuffer,
+	FRDGBufferRef SortDispatchArgsBuffer,
+	FRDGBufferRef DrawArgsBuffer,
+	ERDGPassFlags ComputePassFlags)
+{
+	TShaderRef<FGaussianSplatBuildIndirectArgsCS> ComputeShader = GetShaders().BuildIndirectArgs;
 
-	// Dispatch only for actual SplatCount — no power-of-2 padding needed for radix sort
-	const uint32 ThreadGroupSize = 256;
-	const uint32 NumGroups = FMath::DivideAndRoundUp((uint32)SplatCount, ThreadGroupSize);
+	if (!ComputeShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatBuildIndirectArgsCS shader not valid"));
+		return;
+	}
 
-	SetComputePipelineState(RHICmdList, ComputeShader.GetComputeShader());
-	SetShaderParameters(RHICmdList, ComputeShader, ComputeShader.GetComputeShader(), Parameters);
-	RHICmdList.DispatchComputeShader(NumGroups, 1, 1);
-	UnsetShaderUAVs(RHICmdList, ComputeShader, ComputeShader.GetComputeShader());
+	// Sizes the sort dispatch from the visible count, so it is timed with the sort rather than the view data
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatSort);
+
+	FGaussianSplatBuildIndirectArgsCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatBuildIndirectArgsCS::FParameters>();
+	Parameters->VisibleCountBuffer = GraphBuilder.CreateSRV(VisibleCountBuffer);
+	Parameters->SortDispatchArgs = GraphBuilder.CreateUAV(SortDispatchArgsBuffer, PF_R32_UINT);
+	Parameters->DrawArgs = GraphBuilder.CreateUAV(DrawArgsBuffer, PF_R32_UINT);
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GaussianSplatBuildIndirectArgs"),
+		ComputePassFlags,
+		ComputeShader,
+		Parameters,
+		FIntVector(1, 1, 1));
 }
 
 void FGaussianSplatRenderer::DispatchRadixSort(
-	FRHICommandListImmediate& RHICmdList,
-	FGaussianSplatGPUResources* GPUResources,
-	int32 SplatCount)
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef DistanceBuffer,
+	FRDGBufferRef UnsortedKeysBuffer,
+	FRDGBufferRef SortKeysBuffer,
+	FRDGBufferRef SortCountBuffer,
+	FRDGBufferRef SortDispatchArgsBuffer,
+	int32 MaxSortCount,
+	uint32 SortKeyBits,
+	ERDGPassFlags ComputePassFlags)
 {
-	SCOPED_DRAW_EVENT(RHICmdList, GaussianSplatRadixSort);
+	const uint32 NumPasses = SortKeyBits / 8;
+
+	// An even pass count sorts in place, an odd one ends in SortKeysBuffer (see GetUnsortedKeysBuffer)
+	check(((NumPasses & 1) == 0) == (UnsortedKeysBuffer == SortKeysBuffer));
+
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatSort);
 
-	TShaderMapRef<FRadixSortCountCS> CountShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-	TShaderMapRef<FRadixSortPrefixSumCS> PrefixSumShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-	TShaderMapRef<FRadixSortDigitPrefixSumCS> DigitPrefixSumShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-	TShaderMapRef<FRadixSortScatterCS> ScatterShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	if (UseOneSweepSort())
+	{
+		DispatchOneSweepSort(GraphBuilder, DistanceBuffer, UnsortedKeysBuffer, SortKeysBuffer, SortCountBuffer, SortDispatchArgsBuffer, MaxSortCount, NumPasses, ComputePassFlags);
+		return;
+	}
+
+	TShaderRef<FRadixSortCountCS> CountShader = GetShaders().RadixSortCount;
+	TShaderRef<FRadixSortPrefixSumCS> PrefixSumShader = GetShaders().RadixSortPrefixSum;
+	TShaderRef<FRadixSortDigitPrefixSumCS> DigitPrefixSumShader = GetShaders().RadixSortDigitPrefixSum;
+	TShaderRef<FRadixSortScatterCS> ScatterShader = GetShaders().RadixSortScatter;
 
 	if (!CountShader.IsValid() || !PrefixSumShader.IsValid() ||
 		!DigitPrefixSumShader.IsValid() || !ScatterShader.IsValid())
@@ -213,38 +1655,38 @@ void FGaussianSplatRenderer::DispatchRadixSort(
 		return;
 	}
 
-	// Radix sort works with any count — no power-of-2 padding needed
-	uint32 SortCount = (uint32)SplatCount;
-	uint32 NumTiles = FMath::DivideAndRoundUp(SortCount, 1024u);
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatRadixSort");
+
+	// Radix sort works with any count — no power-of-2 padding needed.
+	// Scratch is sized for the worst case, the passes only cover the tiles of the GPU-side visible count.
+	uint32 SortCount = (uint32)MaxSortCount;
+	uint32 NumTiles = FMath::DivideAndRoundUp(SortCount, RadixSortTileSize);
+
+	// Transient scratch: ping-pong targets and histograms, aliased by RDG across proxies and views
+	FRDGBufferRef DistanceBufferAlt = CreateSortScratchBuffer(GraphBuilder, SortCount, TEXT("GaussianSortDistanceBufferAlt"));
+	FRDGBufferRef SortKeysBufferAlt = (UnsortedKeysBuffer != SortKeysBuffer) ? SortKeysBuffer : CreateSortScratchBuffer(GraphBuilder, SortCount, TEXT("GaussianSortKeysBufferAlt"));
+	FRDGBufferRef HistogramBuffer = CreateSortScratchBuffer(GraphBuilder, NumTiles * 256, TEXT("GaussianRadixHistogramBuffer"));
+	FRDGBufferRef DigitOffsetBuffer = CreateSortScratchBuffer(GraphBuilder, 256, TEXT("GaussianRadixDigitOffsetBuffer"));
 
 	// Distance buffers: [0] = primary, [1] = alt
-	FUnorderedAccessViewRHIRef DistUAVs[2] = {
-		GPUResources->SortDistanceBufferUAV,
-		GPUResources->SortDistanceBufferAltUAV
-	};
-	FBufferRHIRef DistBuffers[2] = {
-		GPUResources->SortDistanceBuffer,
-		GPUResources->SortDistanceBufferAlt
+	FRDGBufferUAVRef DistUAVs[2] = {
+		GraphBuilder.CreateUAV(DistanceBuffer),
+		GraphBuilder.CreateUAV(DistanceBufferAlt)
 	};
 
-	// Key buffers: [0] = primary, [1] = alt
-	FUnorderedAccessViewRHIRef KeyUAVs[2] = {
-		GPUResources->SortKeysBufferUAV,
-		GPUResources->SortKeysBufferAltUAV
-	};
-	FBufferRHIRef KeyBuffers[2] = {
-		GPUResources->SortKeysBuffer,
-		GPUResources->SortKeysBufferAlt
+	// Key buffers: [0] = input, [1] = alt (the output for odd pass counts)
+	FRDGBufferUAVRef KeyUAVs[2] = {
+		GraphBuilder.CreateUAV(UnsortedKeysBuffer),
+		GraphBuilder.CreateUAV(SortKeysBufferAlt)
 	};
 
-	// Ensure alt buffers are in UAVCompute state
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->SortDistanceBufferAlt, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->SortKeysBufferAlt, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->RadixHistogramBuffer, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->RadixDigitOffsetBuffer, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
+	FRDGBufferUAVRef HistogramUAV = GraphBuilder.CreateUAV(HistogramBuffer);
+	FRDGBufferUAVRef DigitOffsetUAV = GraphBuilder.CreateUAV(DigitOffsetBuffer);
+	FRDGBufferSRVRef SortCountSRV = GraphBuilder.CreateSRV(SortCountBuffer);
 
-	// 4 radix passes: bits 0-7, 8-15, 16-23, 24-31
-	for (uint32 Pass = 0; Pass < 4; Pass++)
+	// One radix pass per 8 key bits: bits 0-7, 8-15, 16-23, 24-31
+	// RDG inserts the UAV barriers between dependent passes
+	for (uint32 Pass = 0; Pass < NumPasses; Pass++)
 	{
 		uint32 RadixShift = Pass * 8;
 		uint32 SrcIdx = Pass & 1;
@@ -252,169 +1694,555 @@ void FGaussianSplatRenderer::DispatchRadixSort(
 
 		// --- CountCS: build per-tile histograms ---
 		{
-			FRadixSortCountCS::FParameters Params;
-			Params.HistogramBuffer = GPUResources->RadixHistogramBufferUAV;
-			Params.SrcKeys = DistUAVs[SrcIdx];
-			Params.RadixShift = RadixShift;
-			Params.Count = SortCount;
-			Params.NumTiles = NumTiles;
-
-			SetComputePipelineState(RHICmdList, CountShader.GetComputeShader());
-			SetShaderParameters(RHICmdList, CountShader, CountShader.GetComputeShader(), Params);
-			RHICmdList.DispatchComputeShader(NumTiles, 1, 1);
-			UnsetShaderUAVs(RHICmdList, CountShader, CountShader.GetComputeShader());
+			FRadixSortCountCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortCountCS::FParameters>();
+			Params->HistogramBuffer = HistogramUAV;
+			Params->SrcKeys = DistUAVs[SrcIdx];
+			Params->SortCountBuffer = SortCountSRV;
+			Params->RadixShift = RadixShift;
+			Params->IndirectArgs = SortDispatchArgsBuffer;
+
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("Count(Pass %u)", Pass), ComputePassFlags,
+				CountShader, Params, SortDispatchArgsBuffer, 0);
 		}
 
-		// UAV barrier
-		RHICmdList.Transition(FRHITransitionInfo(GPUResources->RadixHistogramBuffer, ERHIAccess::UAVCompute, ERHIAccess::UAVCompute));
-
 		// --- PrefixSumCS: exclusive prefix sum per digit across tiles ---
 		{
-			FRadixSortPrefixSumCS::FParameters Params;
-			Params.HistogramBuffer = GPUResources->RadixHistogramBufferUAV;
-			Params.DigitOffsetBuffer = GPUResources->RadixDigitOffsetBufferUAV;
-			Params.NumTiles = NumTiles;
+			FRadixSortPrefixSumCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortPrefixSumCS::FParameters>();
+			Params->HistogramBuffer = HistogramUAV;
+			Params->DigitOffsetBuffer = DigitOffsetUAV;
+			Params->SortCountBuffer = SortCountSRV;
 
-			SetComputePipelineState(RHICmdList, PrefixSumShader.GetComputeShader());
-			SetShaderParameters(RHICmdList, PrefixSumShader, PrefixSumShader.GetComputeShader(), Params);
-			RHICmdList.DispatchComputeShader(256, 1, 1);
-			UnsetShaderUAVs(RHICmdList, PrefixSumShader, PrefixSumShader.GetComputeShader());
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("PrefixSum(Pass %u)", Pass), ComputePassFlags,
+				PrefixSumShader, Params, FIntVector(256, 1, 1));
 		}
 
-		// UAV barrier
-		RHICmdList.Transition(FRHITransitionInfo(GPUResources->RadixDigitOffsetBuffer, ERHIAccess::UAVCompute, ERHIAccess::UAVCompute));
-
 		// --- DigitPrefixSumCS: exclusive prefix sum across digit totals ---
 		{
-			FRadixSortDigitPrefixSumCS::FParameters Params;
-			Params.DigitOffsetBuffer = GPUResources->RadixDigitOffsetBufferUAV;
+			FRadixSortDigitPrefixSumCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortDigitPrefixSumCS::FParameters>();
+			Params->DigitOffsetBuffer = DigitOffsetUAV;
 
-			SetComputePipelineState(RHICmdList, DigitPrefixSumShader.GetComputeShader());
-			SetShaderParameters(RHICmdList, DigitPrefixSumShader, DigitPrefixSumShader.GetComputeShader(), Params);
-			RHICmdList.DispatchComputeShader(1, 1, 1);
-			UnsetShaderUAVs(RHICmdList, DigitPrefixSumShader, DigitPrefixSumShader.GetComputeShader());
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("DigitPrefixSum(Pass %u)", Pass), ComputePassFlags,
+				DigitPrefixSumShader, Params, FIntVector(1, 1, 1));
 		}
 
-		// UAV barrier
-		RHICmdList.Transition(FRHITransitionInfo(GPUResources->RadixDigitOffsetBuffer, ERHIAccess::UAVCompute, ERHIAccess::UAVCompute));
-		RHICmdList.Transition(FRHITransitionInfo(GPUResources->RadixHistogramBuffer, ERHIAccess::UAVCompute, ERHIAccess::UAVCompute));
-
 		// --- ScatterCS: scatter keys+values to sorted positions ---
 		{
-			FRadixSortScatterCS::FParameters Params;
-			Params.SrcKeys = DistUAVs[SrcIdx];
-			Params.SrcVals = KeyUAVs[SrcIdx];
-			Params.DstKeys = DistUAVs[DstIdx];
-			Params.DstVals = KeyUAVs[DstIdx];
-			Params.HistogramBuffer = GPUResources->RadixHistogramBufferUAV;
-			Params.DigitOffsetBuffer = GPUResources->RadixDigitOffsetBufferUAV;
-			Params.RadixShift = RadixShift;
-			Params.Count = SortCount;
-			Params.NumTiles = NumTiles;
-
-			SetComputePipelineState(RHICmdList, ScatterShader.GetComputeShader());
-			SetShaderParameters(RHICmdList, ScatterShader, ScatterShader.GetComputeShader(), Params);
-			RHICmdList.DispatchComputeShader(NumTiles, 1, 1);
-			UnsetShaderUAVs(RHICmdList, ScatterShader, ScatterShader.GetComputeShader());
+			FRadixSortScatterCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortScatterCS::FParameters>();
+			Params->SrcKeys = DistUAVs[SrcIdx];
+			Params->SrcVals = KeyUAVs[SrcIdx];
+			Params->DstKeys = DistUAVs[DstIdx];
+			Params->DstVals = KeyUAVs[DstIdx];
+			Params->HistogramBuffer = HistogramUAV;
+			Params->DigitOffsetBuffer = DigitOffsetUAV;
+			Params->SortCountBuffer = SortCountSRV;
+			Params->RadixShift = RadixShift;
+			Params->IndirectArgs = SortDispatchArgsBuffer;
+
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("Scatter(Pass %u)", Pass), ComputePassFlags,
+				ScatterShader, Params, SortDispatchArgsBuffer, 0);
 		}
+	}
+
+	// Even pass count: result is back in the input buffer, which is SortKeysBuffer. Odd: result is in [1], also SortKeysBuffer.
+}
+
+void FGaussianSplatRenderer::DispatchOneSweepSort(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef DistanceBuffer,
+	FRDGBufferRef UnsortedKeysBuffer,
+	FRDGBufferRef SortKeysBuffer,
+	FRDGBufferRef SortCountBuffer,
+	FRDGBufferRef SortDispatchArgsBuffer,
+	int32 MaxSortCount,
+	uint32 NumPasses,
+	ERDGPassFlags ComputePassFlags)
+{
+	TShaderRef<FRadixSortOneSweepHistogramCS> HistogramShader = GetShaders().OneSweepHistogram;
+	TShaderRef<FRadixSortOneSweepHistogramScanCS> HistogramScanShader = GetShaders().OneSweepHistogramScan;
+	TShaderRef<FRadixSortOneSweepScatterCS> ScatterShader = GetShaders().OneSweepScatter;
 
-		// UAV barriers between passes
-		RHICmdList.Transition(FRHITransitionInfo(DistBuffers[DstIdx], ERHIAccess::UAVCompute, ERHIAccess::UAVCompute));
-		RHICmdList.Transition(FRHITransitionInfo(KeyBuffers[DstIdx], ERHIAccess::UAVCompute, ERHIAccess::UAVCompute));
+	if (!HistogramShader.IsValid() || !HistogramScanShader.IsValid() || !ScatterShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("OneSweep radix sort shaders not valid"));
+		return;
 	}
 
-	// After 4 passes (even count), result is back in primary buffers [0]
-	// Transition SortKeysBuffer for rendering
-	RHICmdList.Transition(FRHITransitionInfo(GPUResources->SortKeysBuffer, ERHIAccess::UAVCompute, ERHIAccess::SRVGraphics));
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatOneSweepSort");
+
+	uint32 SortCount = (uint32)MaxSortCount;
+	uint32 MaxTiles = FMath::DivideAndRoundUp(SortCount, RadixSortTileSize);
+
+	FRDGBufferRef DistanceBufferAlt = CreateSortScratchBuffer(GraphBuilder, SortCount, TEXT("GaussianSortDistanceBufferAlt"));
+	FRDGBufferRef SortKeysBufferAlt = (UnsortedKeysBuffer != SortKeysBuffer) ? SortKeysBuffer : CreateSortScratchBuffer(GraphBuilder, SortCount, TEXT("GaussianSortKeysBufferAlt"));
+	FRDGBufferRef GlobalHistogramBuffer = CreateSortScratchBuffer(GraphBuilder, NumPasses * 256, TEXT("GaussianOneSweepGlobalHistogram"));
+	FRDGBufferRef TileStatusBuffer = CreateSortScratchBuffer(GraphBuilder, NumPasses * MaxTiles * 256, TEXT("GaussianOneSweepTileStatus"));
+	FRDGBufferRef TileCounterBuffer = CreateSortScratchBuffer(GraphBuilder, NumPasses, TEXT("GaussianOneSweepTileCounter"));
+
+	FRDGBufferUAVRef DistUAVs[2] = {
+		GraphBuilder.CreateUAV(DistanceBuffer),
+		GraphBuilder.CreateUAV(DistanceBufferAlt)
+	};
+	FRDGBufferUAVRef KeyUAVs[2] = {
+		GraphBuilder.CreateUAV(UnsortedKeysBuffer),
+		GraphBuilder.CreateUAV(SortKeysBufferAlt)
+	};
+
+	FRDGBufferUAVRef GlobalHistogramUAV = GraphBuilder.CreateUAV(GlobalHistogramBuffer);
+	FRDGBufferUAVRef TileStatusUAV = GraphBuilder.CreateUAV(TileStatusBuffer);
+	FRDGBufferUAVRef TileCounterUAV = GraphBuilder.CreateUAV(TileCounterBuffer);
+	FRDGBufferSRVRef GlobalHistogramSRV = GraphBuilder.CreateSRV(GlobalHistogramBuffer);
+	FRDGBufferSRVRef SortCountSRV = GraphBuilder.CreateSRV(SortCountBuffer);
+
+	// Tile status and tile allocators of every pass start out cleared
+	AddClearUAVPass(GraphBuilder, GlobalHistogramUAV, 0, ComputePassFlags);
+	AddClearUAVPass(GraphBuilder, TileStatusUAV, 0, ComputePassFlags);
+	AddClearUAVPass(GraphBuilder, TileCounterUAV, 0, ComputePassFlags);
+
+	// --- HistogramCS: digit histograms of every pass in one read ---
+	{
+		FRadixSortOneSweepHistogramCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortOneSweepHistogramCS::FParameters>();
+		Params->GlobalHistogramBuffer = GlobalHistogramUAV;
+		Params->SrcKeys = DistUAVs[0];
+		Params->SortCountBuffer = SortCountSRV;
+		Params->NumPasses = NumPasses;
+		Params->IndirectArgs = SortDispatchArgsBuffer;
+
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("Histogram"), ComputePassFlags,
+			HistogramShader, Params, SortDispatchArgsBuffer, 0);
+	}
+
+	// --- HistogramScanCS: global digit offsets per pass ---
+	{
+		FRadixSortOneSweepHistogramScanCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortOneSweepHistogramScanCS::FParameters>();
+		Params->GlobalHistogramBuffer = GlobalHistogramUAV;
+
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("HistogramScan"), ComputePassFlags,
+			HistogramScanShader, Params, FIntVector(NumPasses, 1, 1));
+	}
+
+	// --- ScatterCS: one dispatch per digit ---
+	for (uint32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		uint32 SrcIdx = Pass & 1;
+		uint32 DstIdx = 1 - SrcIdx;
+
+		FRadixSortOneSweepScatterCS::FParameters* Params = GraphBuilder.AllocParameters<FRadixSortOneSweepScatterCS::FParameters>();
+		Params->SrcKeys = DistUAVs[SrcIdx];
+		Params->SrcVals = KeyUAVs[SrcIdx];
+		Params->DstKeys = DistUAVs[DstIdx];
+		Params->DstVals = KeyUAVs[DstIdx];
+		Params->GlobalHistogramBuffer = GlobalHistogramSRV;
+		Params->TileStatusBuffer = TileStatusUAV;
+		Params->TileCounterBuffer = TileCounterUAV;
+		Params->SortCountBuffer = SortCountSRV;
+		Params->RadixShift = Pass * 8;
+		Params->PassIndex = Pass;
+		Params->MaxTiles = MaxTiles;
+		Params->IndirectArgs = SortDispatchArgsBuffer;
+
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("Scatter(Pass %u)", Pass), ComputePassFlags,
+			ScatterShader, Params, SortDispatchArgsBuffer, 0);
+	}
 }
 
 void FGaussianSplatRenderer::DrawSplats(
-	FRHICommandListImmediate& RHICmdList,
+	FRDGBuilder& GraphBuilder,
 	const FSceneView& View,
+	FGaussianSplatViewResources& ViewResources,
 	FGaussianSplatGPUResources* GPUResources,
-	int32 SplatCount)
+	FRDGBufferRef ViewDataBuffer,
+	FRDGBufferRef SortKeysBuffer,
+	FRDGBufferRef DrawArgsBuffer,
+	int32 SplatCount,
+	const FRenderTargetBindingSlots& RenderTargets)
 {
-	SCOPED_DRAW_EVENT(RHICmdList, GaussianSplatDraw);
+	if (!GPUResources || !GPUResources->IndexBuffer.IsValid() || !ViewDataBuffer || !SortKeysBuffer || !DrawArgsBuffer)
+	{
+		return;
+	}
 
-	if (!GPUResources || !GPUResources->IndexBuffer.IsValid())
+	if (UseTileRasterizer(RenderTargets))
 	{
+		// Times its binning and tile sort under GaussianSplatTileSort and only its blending under GaussianSplatDraw
+		DispatchTileRasterizer(GraphBuilder, View, ViewResources, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, SplatCount,
+			RenderTargets[0].GetTexture(), RenderTargets.DepthStencil.GetTexture());
+		RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatDraw);
+		DrawSplatDepth(GraphBuilder, View, GPUResources, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, SplatCount, RenderTargets.DepthStencil.GetTexture());
 		return;
 	}
 
-	TShaderMapRef<FGaussianSplatVS> VertexShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
-	TShaderMapRef<FGaussianSplatPS> PixelShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatDraw);
+
+	TShaderRef<FGaussianSplatVS> VertexShader = GetShaders().SplatVS;
+	TShaderRef<FGaussianSplatPS> PixelShader = GetShaders().SplatPS;
 
 	if (!VertexShader.IsValid() || !PixelShader.IsValid())
 	{
 		return;
 	}
 
-	// Transition view data buffer for graphics reads.
-	// Use Unknown source: handles both fresh compute (SRVCompute) and cached (SRVGraphics) paths.
-	if (GPUResources->ViewDataBuffer.IsValid())
+	// Vertex shader parameters; RDG transitions the buffers for graphics reads
+	FGaussianSplatDrawParameters* PassParameters = GraphBuilder.AllocParameters<FGaussianSplatDrawParameters>();
+	PassParameters->VS.ViewDataBuffer = GraphBuilder.CreateSRV(ViewDataBuffer);
+	PassParameters->VS.SortKeysBuffer = GraphBuilder.CreateSRV(SortKeysBuffer);
+	PassParameters->VS.SplatCount = SplatCount;
+	PassParameters->IndirectDrawArgs = DrawArgsBuffer;
+	PassParameters->RenderTargets = RenderTargets;
+
+	// Foveated shading: the quads' pixel shader runs at coarser rates towards the edge of the view
+	if (UseFoveatedShadingRate(View) && RenderTargets[0].GetTexture())
 	{
-		RHICmdList.Transition(FRHITransitionInfo(GPUResources->ViewDataBuffer, ERHIAccess::Unknown, ERHIAccess::SRVGraphics));
+		PassParameters->RenderTargets.ShadingRateTexture = CreateFoveatedShadingRateImage(GraphBuilder, View, RenderTargets[0].GetTexture()->Desc.Extent);
 	}
 
-	// Set up graphics pipeline state
-	FGraphicsPipelineStateInitializer GraphicsPSOInit;
-	RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+	const FIntRect ViewRect = View.UnscaledViewRect;
+	FBufferRHIRef IndexBuffer = GPUResources->IndexBuffer;
+	const FGraphicsPipelineStateInitializer& DrawPSOInit = GetShaders().DrawPSOInit;
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GaussianSplatDraw"),
+		PassParameters,
+		ERDGPassFlags::Raster,
+		[PassParameters, VertexShader, PixelShader, ViewRect, IndexBuffer, DrawPSOInit](FRHICommandList& RHICmdList)
+		{
+			// Static state comes from the per-frame shader cache, only the render targets change between passes
+			FGraphicsPipelineStateInitializer GraphicsPSOInit = DrawPSOInit;
+			RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+
+			SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+
+			// Set viewport to match the view rect - critical for correct rendering when viewport is resized
+			RHICmdList.SetViewport(
+				ViewRect.Min.X,
+				ViewRect.Min.Y,
+				0.0f,
+				ViewRect.Max.X,
+				ViewRect.Max.Y,
+				1.0f
+			);
+
+			SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), PassParameters->VS);
+
+			// Pixel shader parameters
+			FGaussianSplatPS::FParameters PSParameters;
+			SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), PSParameters);
+
+			// Draw instanced quads
+			// One instance per visible splat, the instance count was written by BuildIndirectArgsCS
+			// Using index buffer: 6 indices per quad (2 triangles)
+			RHICmdList.SetStreamSource(0, nullptr, 0);
+			RHICmdList.DrawIndexedPrimitiveIndirect(
+				IndexBuffer,
+				PassParameters->IndirectDrawArgs->GetIndirectRHICallBuffer(),
+				0  // ArgumentOffset
+			);
+		}
+	);
 
-	GraphicsPSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
-	// Depth test enabled (CF_DepthNearOrEqual) so splats are occluded by scene geometry
-	// Depth write disabled (false) because splats are transparent and blend among themselves
-	GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_DepthNearOrEqual>::GetRHI();
+	DrawSplatDepth(GraphBuilder, View, GPUResources, ViewDataBuffer, SortKeysBuffer, DrawArgsBuffer, SplatCount, RenderTargets.DepthStencil.GetTexture());
+}
 
-	// Blend mode: Standard premultiplied alpha "over" for back-to-front compositing
-	// result = src + dst * (1 - srcAlpha)
-	// This properly attenuates the background behind splats
-	GraphicsPSOInit.BlendState = TStaticBlendState<
-		CW_RGBA,
-		BO_Add, BF_One, BF_InverseSourceAlpha,  // Color: Src + Dst * (1 - SrcAlpha)
-		BO_Add, BF_One, BF_InverseSourceAlpha   // Alpha: same
-	>::GetRHI();
+void FGaussianSplatRenderer::DrawSplatDepth(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FGaussianSplatGPUResources* GPUResources,
+	FRDGBufferRef ViewDataBuffer,
+	FRDGBufferRef SortKeysBuffer,
+	FRDGBufferRef DrawArgsBuffer,
+	int32 SplatCount,
+	FRDGTextureRef SceneDepthTexture)
+{
+	if (CVarGaussianSplatDepthWrite.GetValueOnRenderThread() == 0 || !SceneDepthTexture)
+	{
+		return;
+	}
 
-	GraphicsPSOInit.PrimitiveType = PT_TriangleList;
-	GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GEmptyVertexDeclaration.VertexDeclarationRHI;
-	GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
-	GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+	TShaderRef<FGaussianSplatVS> VertexShader = GetShaders().SplatVS;
+	TShaderRef<FGaussianSplatDepthPS> PixelShader = GetShaders().SplatDepthPS;
 
-	SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+	if (!VertexShader.IsValid() || !PixelShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatDepthPS shader not valid"));
+		return;
+	}
 
-	// Set viewport to match the view rect - critical for correct rendering when viewport is resized
-	FIntRect ViewRect = View.UnscaledViewRect;
-	RHICmdList.SetViewport(
-		ViewRect.Min.X,
-		ViewRect.Min.Y,
-		0.0f,
-		ViewRect.Max.X,
-		ViewRect.Max.Y,
-		1.0f
-	);
+	// Depth only, written after the color draw so splats never depth-reject their own blend
+	FGaussianSplatDrawParameters* PassParameters = GraphBuilder.AllocParameters<FGaussianSplatDrawParameters>();
+	PassParameters->VS.ViewDataBuffer = GraphBuilder.CreateSRV(ViewDataBuffer);
+	PassParameters->VS.SortKeysBuffer = GraphBuilder.CreateSRV(SortKeysBuffer);
+	PassParameters->VS.SplatCount = SplatCount;
+	PassParameters->IndirectDrawArgs = DrawArgsBuffer;
+	PassParameters->RenderTargets.DepthStencil = FDepthStencilBinding(
+		SceneDepthTexture,
+		ERenderTargetLoadAction::ELoad,
+		ERenderTargetLoadAction::ELoad,
+		FExclusiveDepthStencil::DepthWrite_StencilRead);
+
+	const FIntRect ViewRect = View.UnscaledViewRect;
+	FBufferRHIRef IndexBuffer = GPUResources->IndexBuffer;
+	const FGraphicsPipelineStateInitializer& DepthPSOInit = GetShaders().DepthPSOInit;
+	const float AlphaThreshold = FMath::Clamp(CVarGaussianSplatDepthWriteAlpha.GetValueOnRenderThread(), 1.0f / 255.0f, 1.0f);
+
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GaussianSplatDepth"),
+		PassParameters,
+		ERDGPassFlags::Raster,
+		[PassParameters, VertexShader, PixelShader, ViewRect, IndexBuffer, DepthPSOInit, AlphaThreshold](FRHICommandList& RHICmdList)
+		{
+			FGraphicsPipelineStateInitializer GraphicsPSOInit = DepthPSOInit;
+			RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+
+			SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+			RHICmdList.SetViewport(ViewRect.Min.X, ViewRect.Min.Y, 0.0f, ViewRect.Max.X, ViewRect.Max.Y, 1.0f);
+
+			SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), PassParameters->VS);
+
+			FGaussianSplatDepthPS::FParameters PSParameters;
+			PSParameters.DepthWriteAlphaThreshold = AlphaThreshold;
+			SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), PSParameters);
 
-	// Set vertex shader parameters
-	FGaussianSplatVS::FParameters VSParameters;
-	VSParameters.ViewDataBuffer = GPUResources->ViewDataBufferSRV;
-	VSParameters.SortKeysBuffer = GPUResources->SortKeysBufferSRV;
-	VSParameters.SplatCount = SplatCount;
-
-	SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), VSParameters);
-
-	// Pixel shader parameters
-	FGaussianSplatPS::FParameters PSParameters;
-	SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), PSParameters);
-
-	// Draw instanced quads
-	// 4 vertices per quad, SplatCount instances
-	// Using index buffer: 6 indices per quad (2 triangles)
-	RHICmdList.SetStreamSource(0, nullptr, 0);
-	RHICmdList.DrawIndexedPrimitive(
-		GPUResources->IndexBuffer,
-		0,  // BaseVertexIndex
-		0,  // FirstInstance
-		4,  // NumVertices
-		0,  // StartIndex
-		2,  // NumPrimitives (2 triangles per quad)
-		SplatCount  // NumInstances
+			RHICmdList.SetStreamSource(0, nullptr, 0);
+			RHICmdList.DrawIndexedPrimitiveIndirect(
+				IndexBuffer,
+				PassParameters->IndirectDrawArgs->GetIndirectRHICallBuffer(),
+				0  // ArgumentOffset
+			);
+		}
 	);
 }
+
+bool FGaussianSplatRenderer::UseOcclusionCulling(const FSceneView& View)
+{
+	// Views without a view state share view key 0, their depth would be mixed up between frames
+	return CVarGaussianSplatOcclusionCulling.GetValueOnRenderThread() != 0 &&
+		View.IsPerspectiveProjection() && View.GetViewKey() != 0;
+}
+
+void FGaussianSplatRenderer::BuildOcclusionHZB(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FRDGTextureRef SceneDepthTexture,
+	FGaussianSplatOcclusionHZB& OutHZB)
+{
+	TShaderRef<FGaussianSplatHZBFromDepthCS> FromDepthShader = GetShaders().HZBFromDepth;
+	TShaderRef<FGaussianSplatHZBDownsampleCS> DownsampleShader = GetShaders().HZBDownsample;
+
+	if (!FromDepthShader.IsValid() || !DownsampleShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatHZBFromDepthCS shader not valid"));
+		return;
+	}
+
+	const FIntRect ViewRect = View.UnscaledViewRect;
+	if (!SceneDepthTexture || SceneDepthTexture->Desc.NumSamples > 1 || ViewRect.Area() <= 0)
+	{
+		OutHZB.Texture.SafeRelease();
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatOcclusionHZB");
+
+	// Splats larger than the top mip are never culled, so a few mips cover every footprint worth testing
+	const FIntPoint Size = FIntPoint::DivideAndRoundUp(ViewRect.Size(), 4);
+	const int32 NumMips = FMath::Min<int32>(FMath::FloorLog2(FMath::Max(Size.X, Size.Y)) + 1, MaxOcclusionHZBMips);
+	FRDGTextureRef HZBTexture = GraphBuilder.CreateTexture(
+		FRDGTextureDesc::Create2D(Size, PF_R32_FLOAT, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV, NumMips),
+		TEXT("GaussianOcclusionHZB"));
+
+	{
+		FGaussianSplatHZBFromDepthCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatHZBFromDepthCS::FParameters>();
+		Parameters->SceneDepthTexture = SceneDepthTexture;
+		Parameters->RWHZB = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(HZBTexture, 0));
+		Parameters->ViewMin = FUintVector2(ViewRect.Min.X, ViewRect.Min.Y);
+		Parameters->ViewSize = FUintVector2(ViewRect.Width(), ViewRect.Height());
+		Parameters->OutputSize = FUintVector2(Size.X, Size.Y);
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("GaussianSplatHZBFromDepth"),
+			ERDGPassFlags::Compute,
+			FromDepthShader,
+			Parameters,
+			FComputeShaderUtils::GetGroupCount(Size, FIntPoint(8, 8)));
+	}
+
+	FIntPoint ParentSize = Size;
+	for (int32 Mip = 1; Mip < NumMips; Mip++)
+	{
+		const FIntPoint MipSize(FMath::Max(Size.X >> Mip, 1), FMath::Max(Size.Y >> Mip, 1));
+
+		FGaussianSplatHZBDownsampleCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatHZBDownsampleCS::FParameters>();
+		Parameters->ParentMip = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::CreateForMipLevel(HZBTexture, Mip - 1));
+		Parameters->RWHZB = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(HZBTexture, Mip));
+		Parameters->ParentSize = FUintVector2(ParentSize.X, ParentSize.Y);
+		Parameters->OutputSize = FUintVector2(MipSize.X, MipSize.Y);
+
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("GaussianSplatHZBDownsample(Mip %d)", Mip),
+			ERDGPassFlags::Compute,
+			DownsampleShader,
+			Parameters,
+			FComputeShaderUtils::GetGroupCount(MipSize, FIntPoint(8, 8)));
+		ParentSize = MipSize;
+	}
+
+	// Culling projects splats with the same jitter-free camera the depth was rendered from
+	const FMatrix ProjMatrix = View.ViewMatrices.ComputeProjectionNoAAMatrix();
+	OutHZB.Texture = GraphBuilder.ConvertToExternalTexture(HZBTexture);
+	OutHZB.WorldToClip = FMatrix44f(GetViewProjectionMatrixNoAA(View));
+	OutHZB.ProjectionScale = FVector2f(ProjMatrix.M[0][0], ProjMatrix.M[1][1]);
+	OutHZB.DeviceZParams = FVector2f(ProjMatrix.M[2][2], ProjMatrix.M[3][2]);
+	OutHZB.UVToTexel = FVector2f(ViewRect.Size()) / 4.0f;
+	OutHZB.Size = Size;
+	OutHZB.NumMips = NumMips;
+	OutHZB.FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+	OutHZB.GPUMask = View.GPUMask;
+}
+
+void FGaussianSplatRenderer::DispatchTileRasterizer(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FGaussianSplatViewResources& ViewResources,
+	FRDGBufferRef ViewDataBuffer,
+	FRDGBufferRef SortKeysBuffer,
+	FRDGBufferRef DrawArgsBuffer,
+	int32 SplatCount,
+	FRDGTextureRef SceneColorTexture,
+	FRDGTextureRef SceneDepthTexture)
+{
+	TShaderRef<FGaussianSplatTileCountCS> CountShader = GetShaders().TileCount;
+	TShaderRef<FGaussianSplatTileScanCS> ScanShader = GetShaders().TileScan;
+	TShaderRef<FGaussianSplatTileEmitCS> EmitShader = GetShaders().TileEmit;
+	TShaderRef<FGaussianSplatTileRangesCS> RangesShader = GetShaders().TileRanges;
+	TShaderRef<FGaussianSplatTileRasterizeCS> RasterizeShader = GetShaders().TileRasterize;
+
+	if (!CountShader.IsValid() || !ScanShader.IsValid() || !EmitShader.IsValid() ||
+		!RangesShader.IsValid() || !RasterizeShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Tile rasterizer shaders not valid"));
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatTileRasterizer");
+
+	// Same rect the quad draw uses as its viewport
+	const FIntRect ViewRect = View.UnscaledViewRect;
+	const FUintVector2 ViewSize(ViewRect.Width(), ViewRect.Height());
+	const uint32 TileSize = GaussianSplattingConstants::MortonTileSize;
+	const FUintVector2 NumTiles(FMath::DivideAndRoundUp(ViewSize.X, TileSize), FMath::DivideAndRoundUp(ViewSize.Y, TileSize));
+	const uint32 TotalTiles = NumTiles.X * NumTiles.Y;
+	if (TotalTiles == 0 || SplatCount <= 0)
+	{
+		return;
+	}
+
+	const uint32 NumSplatGroups = FMath::DivideAndRoundUp((uint32)SplatCount, TileScanGroupSize);
+	const float EntriesPerSplat = FMath::Max(CVarGaussianSplatTileRasterMaxEntriesPerSplat.GetValueOnRenderThread(), 1.0f);
+	const uint32 MaxEntries = (uint32)FMath::Clamp((int64)(SplatCount * (double)EntriesPerSplat), (int64)SplatCount, MaxTileRasterEntries);
+
+	// An even pass count keeps the sorted keys, which TileRangesCS reads, in TileKeys
+	const uint32 TileKeyBits = TotalTiles <= (1u << 16) ? 16 : 32;
+
+	FRDGBufferRef EntryOffsets = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSplatGroups * TileScanGroupSize), TEXT("GaussianTileEntryOffsets"));
+	FRDGBufferRef GroupTotals = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumSplatGroups), TEXT("GaussianTileGroupTotals"));
+	FRDGBufferRef EntryCountBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 2), TEXT("GaussianTileEntryCount"));
+	FRDGBufferRef SortDispatchArgs = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(1), TEXT("GaussianTileSortDispatchArgs"));
+	FRDGBufferRef TileKeys = CreateSortScratchBuffer(GraphBuilder, MaxEntries, TEXT("GaussianTileKeys"));
+	FRDGBufferRef TileValues = CreateSortScratchBuffer(GraphBuilder, MaxEntries, TEXT("GaussianTileValues"));
+	FRDGBufferRef TileRanges = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), TotalTiles * 2), TEXT("GaussianTileRanges"));
+
+	FRDGBufferSRVRef ViewDataSRV = GraphBuilder.CreateSRV(ViewDataBuffer);
+	FRDGBufferSRVRef SortKeysSRV = GraphBuilder.CreateSRV(SortKeysBuffer);
+	FRDGBufferSRVRef DrawArgsSRV = GraphBuilder.CreateSRV(DrawArgsBuffer, PF_R32_UINT);
+
+	RecordTileRasterStats(ViewResources);
+
+	// Binning and the tile sort are timed apart from the blending
+	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatTileSort);
+
+		// Step 1: Tiles per sorted splat, then the first entry of every splat
+		{
+			FGaussianSplatTileCountCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatTileCountCS::FParameters>();
+			Parameters->ViewDataBuffer = ViewDataSRV;
+			Parameters->SortKeysBuffer = SortKeysSRV;
+			Parameters->DrawArgs = DrawArgsSRV;
+			Parameters->EntryOffsets = GraphBuilder.CreateUAV(EntryOffsets);
+			Parameters->GroupTotals = GraphBuilder.CreateUAV(GroupTotals);
+			Parameters->ViewSize = ViewSize;
+			Parameters->NumTiles = NumTiles;
+
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("TileCount"), ERDGPassFlags::Compute,
+				CountShader, Parameters, FIntVector(NumSplatGroups, 1, 1));
+		}
+		{
+			FGaussianSplatTileScanCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatTileScanCS::FParameters>();
+			Parameters->GroupTotals = GraphBuilder.CreateUAV(GroupTotals);
+			Parameters->EntryCountBuffer = GraphBuilder.CreateUAV(EntryCountBuffer);
+			Parameters->SortDispatchArgs = GraphBuilder.CreateUAV(SortDispatchArgs, PF_R32_UINT);
+			Parameters->NumGroups = NumSplatGroups;
+			Parameters->MaxEntries = MaxEntries;
+
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("TileScan"), ERDGPassFlags::Compute,
+				ScanShader, Parameters, FIntVector(1, 1, 1));
+		}
+		EnqueueTileEntryCountReadback(GraphBuilder, ViewResources, EntryCountBuffer);
+
+		// Step 2: One entry per overlapped tile, grouped by tile with a stable sort that keeps the depth order
+		{
+			FGaussianSplatTileEmitCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatTileEmitCS::FParameters>();
+			Parameters->ViewDataBuffer = ViewDataSRV;
+			Parameters->SortKeysBuffer = SortKeysSRV;
+			Parameters->DrawArgs = DrawArgsSRV;
+			Parameters->EntryOffsets = GraphBuilder.CreateSRV(EntryOffsets);
+			Parameters->GroupTotals = GraphBuilder.CreateSRV(GroupTotals);
+			Parameters->TileKeys = GraphBuilder.CreateUAV(TileKeys);
+			Parameters->TileValues = GraphBuilder.CreateUAV(TileValues);
+			Parameters->ViewSize = ViewSize;
+			Parameters->NumTiles = NumTiles;
+			Parameters->MaxEntries = MaxEntries;
+
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("TileEmit"), ERDGPassFlags::Compute,
+				EmitShader, Parameters, FIntVector(NumSplatGroups, 1, 1));
+		}
+		DispatchRadixSort(GraphBuilder, TileKeys, TileValues, TileValues, EntryCountBuffer, SortDispatchArgs, MaxEntries, TileKeyBits, ERDGPassFlags::Compute);
+
+		// Step 3: Each tile's range of entries, tiles without splats keep (0, 0)
+		{
+			FGaussianSplatTileRangesCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatTileRangesCS::FParameters>();
+			Parameters->TileKeys = GraphBuilder.CreateSRV(TileKeys);
+			Parameters->EntryCountBuffer = GraphBuilder.CreateSRV(EntryCountBuffer);
+			Parameters->TileRanges = GraphBuilder.CreateUAV(TileRanges);
+			Parameters->IndirectArgs = SortDispatchArgs;
+
+			AddClearUAVPass(GraphBuilder, Parameters->TileRanges, 0, ERDGPassFlags::Compute);
+
+			FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("TileRanges"), ERDGPassFlags::Compute,
+				RangesShader, Parameters, SortDispatchArgs, 0);
+		}
+	}
+
+	// Step 4: Blend every tile front-to-back into scene color
+	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, GaussianSplatDraw);
+
+		FGaussianSplatTileRasterizeCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatTileRasterizeCS::FParameters>();
+		Parameters->ViewDataBuffer = ViewDataSRV;
+		Parameters->TileValues = GraphBuilder.CreateSRV(TileValues);
+		Parameters->TileRanges = GraphBuilder.CreateSRV(TileRanges);
+		Parameters->SceneDepthTexture = SceneDepthTexture;
+		Parameters->SceneColor = GraphBuilder.CreateUAV(SceneColorTexture);
+		Parameters->ViewMin = FUintVector2(ViewRect.Min.X, ViewRect.Min.Y);
+		Parameters->ViewSize = ViewSize;
+		Parameters->NumTiles = NumTiles;
+
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("TileRasterize"), ERDGPassFlags::Compute,
+			RasterizeShader, Parameters, FIntVector(NumTiles.X, NumTiles.Y, 1));
+	}
+}
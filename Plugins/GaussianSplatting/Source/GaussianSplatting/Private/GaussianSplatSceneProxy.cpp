@@ -4,11 +4,261 @@
 #include "GaussianSplatComponent.h"
 #include "GaussianSplatAsset.h"
 #include "GaussianSplatViewExtension.h"
+#include "GaussianSplatStats.h"
+#include "GaussianSplatShaders.h"
 #include "Engine/Texture2D.h"
 #include "RHICommandList.h"
 #include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RHIStaticStates.h"
+#include "GlobalShader.h"
 #include "SceneView.h"
 #include "SceneManagement.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/AllOf.h"
+#include "Algo/AnyOf.h"
+#include "Materials/Material.h"
+#include "MaterialDomain.h"
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatMaxCachedViewsPerProxy(
+	TEXT("gs.MaxCachedViewsPerProxy"),
+	4,
+	TEXT("Number of views per splat proxy (or per scene when batched) that keep their own view data and sort results.\n")
+	TEXT("Views beyond this evict the least recently rendered one and re-sort on their next frame."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatShadowSplatBudget(
+	TEXT("gs.ShadowSplatBudget"),
+	-1,
+	TEXT("Most shadow proxy splats a splat actor draws into each shadow view, largest first.\n")
+	TEXT("-1 = every splat the asset's Shadow Splat Budget kept at import (default), 0 = splats cast no shadows"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatStreamingPageChunks(
+	TEXT("gs.StreamingPageChunks"),
+	128,
+	TEXT("Chunks of 256 splats read and uploaded together when splat data streams in.\n")
+	TEXT("Applies to proxies created after the change."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatStreamingMaxPagesInFlight(
+	TEXT("gs.StreamingMaxPagesInFlight"),
+	8,
+	TEXT("Streaming pages per splat asset that may be read at once; also the number of in-memory pages uploaded per frame."),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatLODSplatsPerPixel(
+	TEXT("gs.LODSplatsPerPixel"),
+	4.0f,
+	TEXT("Splats per pixel of a proxy's projected bounds above which a coarser LOD level is rendered.\n")
+	TEXT("0 = always render the finest level allowed by the splat budget"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatForceLOD(
+	TEXT("gs.ForceLOD"),
+	-1,
+	TEXT("Render this LOD level (clamped to the asset's levels) regardless of screen size and budget.\n")
+	TEXT("-1 = automatic selection (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatDynamicUploadBufferMB(
+	TEXT("gs.DynamicUploadBufferMB"),
+	12,
+	TEXT("Size of the upload ring partial splat updates are staged in, per component with dynamic updates.\n")
+	TEXT("A frame uploads at most a third of it, larger updates continue on the next frames."),
+	ECVF_RenderThreadSafe);
+
+/** Frames the dynamic upload ring cycles through, each stages into its own slice */
+static constexpr uint32 DynamicUploadRingSlices = 3;
+
+/** GPU mask of FRHIGPUMask::GetNative bits, at least one of which is set */
+static FRHIGPUMask MakeGPUMask(uint32 GPUBits)
+{
+	check(GPUBits != 0);
+	FRHIGPUMask GPUMask = FRHIGPUMask::FromIndex(FMath::CountTrailingZeros(GPUBits));
+	for (uint32 Bits = GPUBits & (GPUBits - 1); Bits != 0; Bits &= Bits - 1)
+	{
+		GPUMask |= FRHIGPUMask::FromIndex(FMath::CountTrailingZeros(Bits));
+	}
+	return GPUMask;
+}
+
+BEGIN_SHADER_PARAMETER_STRUCT(FGaussianSplatDynamicUploadParameters, )
+	RDG_BUFFER_ACCESS(SplatBuffer, ERHIAccess::CopyDest)
+END_SHADER_PARAMETER_STRUCT()
+
+//////////////////////////////////////////////////////////////////////////
+// FGaussianSplatViewResources
+
+void FGaussianSplatViewResources::RegisterBuffers(FRDGBuilder& GraphBuilder, int32 NumElements, FRDGBufferRef& OutViewDataBuffer, FRDGBufferRef& OutSortKeysBuffer, FRDGBufferRef& OutDrawArgsBuffer)
+{
+	if (ViewDataBuffer.IsValid() && ViewDataBuffer->Desc.NumElements >= (uint32)NumElements)
+	{
+		OutViewDataBuffer = GraphBuilder.RegisterExternalBuffer(ViewDataBuffer);
+		OutSortKeysBuffer = GraphBuilder.RegisterExternalBuffer(SortKeysBuffer);
+		OutDrawArgsBuffer = GraphBuilder.RegisterExternalBuffer(DrawArgsBuffer);
+		return;
+	}
+
+	// First use (or more splats than before): allocate from the pool and keep the buffers alive across frames
+	OutViewDataBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(FGaussianSplatViewData), NumElements),
+		TEXT("GaussianViewDataBuffer"));
+	OutSortKeysBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumElements),
+		TEXT("GaussianSortKeysBuffer"));
+	OutDrawArgsBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateIndirectDesc<FRHIDrawIndexedIndirectParameters>(1),
+		TEXT("GaussianDrawArgsBuffer"));
+
+	ViewDataBuffer = GraphBuilder.ConvertToExternalBuffer(OutViewDataBuffer);
+	SortKeysBuffer = GraphBuilder.ConvertToExternalBuffer(OutSortKeysBuffer);
+	DrawArgsBuffer = GraphBuilder.ConvertToExternalBuffer(OutDrawArgsBuffer);
+	bHasCachedSortData = false;
+	UpdateTrackedMemory();
+}
+
+void FGaussianSplatViewResources::RegisterSHCacheBuffers(FRDGBuilder& GraphBuilder, int32 NumElements, uint32 CacheKey, ERDGPassFlags ComputePassFlags, FRDGBufferRef& OutColorBuffer, FRDGBufferRef& OutDirectionBuffer)
+{
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumElements, GaussianSplattingConstants::SplatsPerChunk);
+	bool bClearDirections = CachedSHCacheKey != CacheKey;
+	if (SHColorCacheBuffer.IsValid() && SHColorCacheBuffer->Desc.NumElements >= (uint32)NumElements)
+	{
+		OutColorBuffer = GraphBuilder.RegisterExternalBuffer(SHColorCacheBuffer);
+		OutDirectionBuffer = GraphBuilder.RegisterExternalBuffer(SHCacheDirectionBuffer);
+	}
+	else
+	{
+		OutColorBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FUintVector2), NumElements),
+			TEXT("GaussianSHColorCacheBuffer"));
+		OutDirectionBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), NumChunks),
+			TEXT("GaussianSHCacheDirectionBuffer"));
+		SHColorCacheBuffer = GraphBuilder.ConvertToExternalBuffer(OutColorBuffer);
+		SHCacheDirectionBuffer = GraphBuilder.ConvertToExternalBuffer(OutDirectionBuffer);
+		bClearDirections = true;
+		UpdateTrackedMemory();
+	}
+
+	// Cleared entries are marked invalid, so each chunk is evaluated again on its next dispatch
+	if (bClearDirections)
+	{
+		AddClearUAVPass(GraphBuilder, ComputePassFlags, GraphBuilder.CreateUAV(OutDirectionBuffer), 0u);
+	}
+	CachedSHCacheKey = CacheKey;
+}
+
+void FGaussianSplatViewResources::Release()
+{
+	ViewDataBuffer.SafeRelease();
+	SortKeysBuffer.SafeRelease();
+	DrawArgsBuffer.SafeRelease();
+	SHColorCacheBuffer.SafeRelease();
+	SHCacheDirectionBuffer.SafeRelease();
+	UpdateTrackedMemory();
+	CachedSHCacheKey = 0;
+	VisibleCountReadback.Reset();
+	bVisibleCountReadbackPending = false;
+	LastVisibleSplatCount = -1;
+	TileEntryCountReadback.Reset();
+	bTileEntryCountReadbackPending = false;
+	LastDroppedTileEntries = 0;
+	bHasCachedSortData = false;
+	CachedBatchHash = 0;
+	CachedBatchSplatCount = 0;
+	PreparedView = nullptr;
+}
+
+int64 FGaussianSplatViewResources::GetGPUMemoryBytes() const
+{
+	int64 Bytes = 0;
+	for (const TRefCountPtr<FRDGPooledBuffer>* Buffer : { &ViewDataBuffer, &SortKeysBuffer, &DrawArgsBuffer, &SHColorCacheBuffer, &SHCacheDirectionBuffer })
+	{
+		Bytes += Buffer->IsValid() ? (*Buffer)->Desc.GetSize() : 0;
+	}
+	return Bytes;
+}
+
+void FGaussianSplatViewResources::UpdateTrackedMemory()
+{
+	const int64 Bytes = GetGPUMemoryBytes();
+	INC_MEMORY_STAT_BY(STAT_GaussianSplatViewBufferMemory, Bytes - TrackedBufferMemory);
+	TrackedBufferMemory = Bytes;
+}
+
+bool FGaussianSplatViewResources::IsPreparedFor(const FSceneView& View) const
+{
+	const uint32 FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+	return PreparedView == &View && PreparedFrameNumber == FrameNumber && ViewDataBuffer.IsValid();
+}
+
+void FGaussianSplatViewResources::MarkPrepared(const FSceneView& View)
+{
+	PreparedView = &View;
+	PreparedFrameNumber = View.Family ? View.Family->FrameNumber : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FGaussianSplatViewResourceCache
+
+FGaussianSplatViewResources* FGaussianSplatViewResourceCache::FindOrAdd(const FSceneView& View)
+{
+	// Views without a persistent view state (some captures, thumbnails) all map to key 0 and share one entry
+	const uint32 ViewKey = View.GetViewKey();
+	const uint32 FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+
+	for (TUniquePtr<FGaussianSplatViewResources>& Entry : Entries)
+	{
+		if (Entry->ViewKey == ViewKey && Entry->GPUMask == View.GPUMask)
+		{
+			Entry->LastUsedFrameNumber = FrameNumber;
+			return Entry.Get();
+		}
+	}
+
+	// Evict least recently used entries to stay within the budget (including the one added below)
+	const int32 MaxViews = FMath::Max(1, CVarGaussianSplatMaxCachedViewsPerProxy.GetValueOnRenderThread());
+	while (Entries.Num() >= MaxViews)
+	{
+		int32 OldestIndex = 0;
+		for (int32 i = 1; i < Entries.Num(); i++)
+		{
+			// Unsigned difference handles frame number wrap-around
+			if (FrameNumber - Entries[i]->LastUsedFrameNumber > FrameNumber - Entries[OldestIndex]->LastUsedFrameNumber)
+			{
+				OldestIndex = i;
+			}
+		}
+		Entries[OldestIndex]->Release();
+		Entries.RemoveAtSwap(OldestIndex);
+	}
+
+	TUniquePtr<FGaussianSplatViewResources> NewEntry = MakeUnique<FGaussianSplatViewResources>();
+	NewEntry->ViewKey = ViewKey;
+	NewEntry->GPUMask = View.GPUMask;
+	NewEntry->LastUsedFrameNumber = FrameNumber;
+	return Entries.Add_GetRef(MoveTemp(NewEntry)).Get();
+}
+
+void FGaussianSplatViewResourceCache::Empty()
+{
+	for (TUniquePtr<FGaussianSplatViewResources>& Entry : Entries)
+	{
+		Entry->Release();
+	}
+	Entries.Empty();
+}
+
+int64 FGaussianSplatViewResourceCache::GetGPUMemoryBytes() const
+{
+	int64 Bytes = 0;
+	for (const TUniquePtr<FGaussianSplatViewResources>& Entry : Entries)
+	{
+		Bytes += Entry->GetGPUMemoryBytes();
+	}
+	return Bytes;
+}
 
 //////////////////////////////////////////////////////////////////////////
 // FGaussianSplatGPUResources
@@ -21,23 +271,57 @@ FGaussianSplatGPUResources::~FGaussianSplatGPUResources()
 {
 }
 
-void FGaussianSplatGPUResources::Initialize(UGaussianSplatAsset* Asset)
+void FGaussianSplatGPUResources::Initialize(UGaussianSplatAsset* Asset, int32 MaxSHOrder, bool bInDynamic)
 {
 	if (!Asset || !Asset->IsValid())
 	{
 		return;
 	}
 
+	SourceAsset = Asset;
 	SplatCount = Asset->GetSplatCount();
 
+	// Dynamic splats are decoded from rotation and scale, which a precomputed covariance no longer holds
+	bDynamic = bInDynamic && !Asset->bPrecomputedCovariance;
+	if (bInDynamic && !bDynamic)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: %s stores precomputed covariances, dynamic updates need an import without them"), *Asset->GetPathName());
+	}
+
+	// Partial updates cannot be replayed on a GPU that joins later, so dynamic splats live on every GPU
+	if (bDynamic)
+	{
+		ViewGPUMask = FRHIGPUMask::All();
+	}
+
 	// Store the position format from the asset (critical for shader to read correctly)
 	PositionFormat = Asset->PositionFormat;
-
-	// Cache data for RHI initialization (copy from bulk data)
-	Asset->GetPositionData(CachedPositionData);
-	Asset->GetOtherData(CachedOtherData);
-	Asset->GetSHData(CachedSHData);
+	ScaleFormat = Asset->ScaleFormat;
+	bPrecomputedCovariance = Asset->bPrecomputedCovariance;
+	SHFormat = Asset->SHFormat;
+
+	uint32 BandOffsets[4];
+	Asset->GetSHBandOffsets(BandOffsets);
+	SHBandOffsets = FUintVector4(BandOffsets[0], BandOffsets[1], BandOffsets[2], BandOffsets[3]);
+	UploadedSHBands = FMath::Clamp(FMath::Min(MaxSHOrder, Asset->SHBands), 0, GaussianSplattingConstants::MaxSHOrder);
+
+	// Only the buffer sizes are needed up front, the contents are streamed in pages (see UpdateStreaming)
+	PositionDataSize = Asset->GetPositionDataSize();
+	OtherDataSize = Asset->GetOtherDataSize();
+	SHDataSize = UploadedSHBands > 0 ? FMath::Min<int64>(Asset->GetSHDataSize(), BandOffsets[UploadedSHBands]) : 0;
+	if (SHDataSize == 0)
+	{
+		UploadedSHBands = 0;
+	}
 	CachedChunkData = Asset->ChunkData;
+	NumChunks = CachedChunkData.Num();
+
+	LODLevels = Asset->LODLevels;
+	if (LODLevels.Num() == 0)
+	{
+		FGaussianSplatLODLevel& Level = LODLevels.AddDefaulted_GetRef();
+		Level.NumSplats = SplatCount;
+	}
 
 	// Initialize render resource
 	if (!bInitialized)
@@ -55,12 +339,26 @@ void FGaussianSplatGPUResources::InitRHI(FRHICommandListBase& RHICmdList)
 	}
 
 	CreateStaticBuffers(RHICmdList);
-	CreateDynamicBuffers(RHICmdList);
 	CreateIndexBuffer(RHICmdList);
+	BuildStreamingPages();
+
+	TrackedBufferMemory = GetGPUMemoryBytes();
+	INC_MEMORY_STAT_BY(STAT_GaussianSplatStaticBufferMemory, TrackedBufferMemory);
 }
 
 void FGaussianSplatGPUResources::ReleaseRHI()
 {
+	CancelStreaming();
+
+	DEC_MEMORY_STAT_BY(STAT_GaussianSplatStaticBufferMemory, TrackedBufferMemory);
+	TrackedBufferMemory = 0;
+
+	DynamicSplatBuffer.SafeRelease();
+	DeformedSplatBuffer.SafeRelease();
+	DynamicUploadBuffer.SafeRelease();
+	DynamicUploadSliceSize = 0;
+	PendingDynamicUpdates.Empty();
+
 	PositionBuffer.SafeRelease();
 	PositionBufferSRV.SafeRelease();
 	OtherDataBuffer.SafeRelease();
@@ -69,24 +367,6 @@ void FGaussianSplatGPUResources::ReleaseRHI()
 	SHBufferSRV.SafeRelease();
 	ChunkBuffer.SafeRelease();
 	ChunkBufferSRV.SafeRelease();
-	ViewDataBuffer.SafeRelease();
-	ViewDataBufferUAV.SafeRelease();
-	ViewDataBufferSRV.SafeRelease();
-	SortDistanceBuffer.SafeRelease();
-	SortDistanceBufferUAV.SafeRelease();
-	SortDistanceBufferSRV.SafeRelease();
-	SortKeysBuffer.SafeRelease();
-	SortKeysBufferUAV.SafeRelease();
-	SortKeysBufferSRV.SafeRelease();
-	SortKeysBufferAlt.SafeRelease();
-	SortKeysBufferAltUAV.SafeRelease();
-	SortKeysBufferAltSRV.SafeRelease();
-	SortDistanceBufferAlt.SafeRelease();
-	SortDistanceBufferAltUAV.SafeRelease();
-	RadixHistogramBuffer.SafeRelease();
-	RadixHistogramBufferUAV.SafeRelease();
-	RadixDigitOffsetBuffer.SafeRelease();
-	RadixDigitOffsetBufferUAV.SafeRelease();
 	IndexBuffer.SafeRelease();
 	ColorTexture.SafeRelease();
 	ColorTextureSRV.SafeRelease();
@@ -98,60 +378,56 @@ void FGaussianSplatGPUResources::ReleaseRHI()
 
 void FGaussianSplatGPUResources::CreateStaticBuffers(FRHICommandListBase& RHICmdList)
 {
-	// Position buffer
-	if (CachedPositionData.Num() > 0)
+	// Position buffer (filled by the streaming pages)
+	if (PositionDataSize > 0)
 	{
 		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
 			TEXT("GaussianPositionBuffer"),
-			CachedPositionData.Num(),
+			PositionDataSize,
 			0,
 			BUF_Static | BUF_ShaderResource | BUF_ByteAddressBuffer)
 			.SetInitialState(ERHIAccess::SRVMask);
 		PositionBuffer = RHICmdList.CreateBuffer(Desc);
 
-		void* Data = RHICmdList.LockBuffer(PositionBuffer, 0, CachedPositionData.Num(), RLM_WriteOnly);
-		FMemory::Memcpy(Data, CachedPositionData.GetData(), CachedPositionData.Num());
-		RHICmdList.UnlockBuffer(PositionBuffer);
-
 		PositionBufferSRV = RHICmdList.CreateShaderResourceView(
 			PositionBuffer, FRHIViewDesc::CreateBufferSRV()
 				.SetType(FRHIViewDesc::EBufferType::Raw));
 	}
 
-	// Other data buffer (rotation + scale)
-	if (CachedOtherData.Num() > 0)
+	// Other data buffer (rotation + scale, filled by the streaming pages)
+	if (OtherDataSize > 0)
 	{
 		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
 			TEXT("GaussianOtherDataBuffer"),
-			CachedOtherData.Num(),
+			OtherDataSize,
 			0,
 			BUF_Static | BUF_ShaderResource | BUF_ByteAddressBuffer)
 			.SetInitialState(ERHIAccess::SRVMask);
 		OtherDataBuffer = RHICmdList.CreateBuffer(Desc);
 
-		void* Data = RHICmdList.LockBuffer(OtherDataBuffer, 0, CachedOtherData.Num(), RLM_WriteOnly);
-		FMemory::Memcpy(Data, CachedOtherData.GetData(), CachedOtherData.Num());
-		RHICmdList.UnlockBuffer(OtherDataBuffer);
-
 		OtherDataBufferSRV = RHICmdList.CreateShaderResourceView(
 			OtherDataBuffer, FRHIViewDesc::CreateBufferSRV()
 				.SetType(FRHIViewDesc::EBufferType::Raw));
 	}
 
-	// SH buffer
-	if (CachedSHData.Num() > 0)
+	// SH buffer - only the bands up to the rendered SH order; a small dummy keeps the SRV bound when none are needed
 	{
+		const int64 BufferSize = SHDataSize > 0 ? SHDataSize : 16;
+
 		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
 			TEXT("GaussianSHBuffer"),
-			CachedSHData.Num(),
+			BufferSize,
 			0,
 			BUF_Static | BUF_ShaderResource | BUF_ByteAddressBuffer)
 			.SetInitialState(ERHIAccess::SRVMask);
 		SHBuffer = RHICmdList.CreateBuffer(Desc);
 
-		void* Data = RHICmdList.LockBuffer(SHBuffer, 0, CachedSHData.Num(), RLM_WriteOnly);
-		FMemory::Memcpy(Data, CachedSHData.GetData(), CachedSHData.Num());
-		RHICmdList.UnlockBuffer(SHBuffer);
+		if (SHDataSize == 0)
+		{
+			void* Data = RHICmdList.LockBuffer(SHBuffer, 0, BufferSize, RLM_WriteOnly);
+			FMemory::Memzero(Data, BufferSize);
+			RHICmdList.UnlockBuffer(SHBuffer);
+		}
 
 		SHBufferSRV = RHICmdList.CreateShaderResourceView(
 			SHBuffer, FRHIViewDesc::CreateBufferSRV()
@@ -159,7 +435,7 @@ void FGaussianSplatGPUResources::CreateStaticBuffers(FRHICommandListBase& RHICmd
 	}
 
 	// Chunk buffer - Always create at least a dummy buffer for shader binding
-	// (Even though we always use Float32 positions now, shader still expects this parameter)
+	// (Float32 positions/scales don't read it, but the shader still expects this parameter)
 	{
 		uint32 ChunkCount = CachedChunkData.Num();
 		if (ChunkCount == 0)
@@ -179,159 +455,593 @@ void FGaussianSplatGPUResources::CreateStaticBuffers(FRHICommandListBase& RHICmd
 		void* Data = RHICmdList.LockBuffer(ChunkBuffer, 0, ChunkSize, RLM_WriteOnly);
 		if (CachedChunkData.Num() > 0)
 		{
-			FMemory::Memcpy(Data, CachedChunkData.GetData(), ChunkSize);
+			FMemory::Memcpy(Data, CachedChunkData.GetData(), ChunkSize);
+		}
+		else
+		{
+			FMemory::Memzero(Data, ChunkSize);  // Zero-initialize dummy entry
+		}
+		RHICmdList.UnlockBuffer(ChunkBuffer);
+
+		ChunkBufferSRV = RHICmdList.CreateShaderResourceView(
+			ChunkBuffer, FRHIViewDesc::CreateBufferSRV()
+				.SetType(FRHIViewDesc::EBufferType::Structured)
+				.SetStride(sizeof(FGaussianChunkInfo)));
+	}
+
+	// Clear cached data
+	CachedChunkData.Empty();
+}
+
+void FGaussianSplatGPUResources::BuildStreamingPages()
+{
+	CancelStreaming();
+	if (!SourceAsset)
+	{
+		return;
+	}
+
+	const int32 PageSplats = FMath::Max(1, CVarGaussianSplatStreamingPageChunks.GetValueOnRenderThread()) * GaussianSplattingConstants::SplatsPerChunk;
+	const int32 PositionStride = UGaussianSplatAsset::GetPositionBytesPerSplat(PositionFormat);
+	const int32 OtherStride = UGaussianSplatAsset::GetOtherBytesPerSplat(ScaleFormat, bPrecomputedCovariance);
+	const bool bClusteredSH = UGaussianSplatAsset::IsClusteredSHFormat(SHFormat);
+	const FByteBulkData* SHBulkData = UploadedSHBands > 0 ? &SourceAsset->SHBulkData : nullptr;
+
+	// Adds the bytes of splats [Begin, End) of a per-splat array; the last splat's range runs to the
+	// end of the array so its alignment padding is copied too
+	auto AddSplatRange = [this](FGaussianSplatStreamingPage& Page, const FByteBulkData* BulkData, FRHIBuffer* Buffer,
+		int64 ArrayOffset, int64 ArrayEnd, int32 Stride, int32 Begin, int32 End)
+	{
+		FGaussianSplatStreamingCopy& Copy = Page.Copies.AddDefaulted_GetRef();
+		Copy.BulkData = BulkData;
+		Copy.Buffer = Buffer;
+		Copy.Offset = ArrayOffset + (int64)Begin * Stride;
+		Copy.Size = (End >= SplatCount ? ArrayEnd : ArrayOffset + (int64)End * Stride) - Copy.Offset;
+	};
+
+	// Coarse levels are small and cover the whole asset, so they become renderable first
+	for (int32 LODIndex = LODLevels.Num() - 1; LODIndex >= 0; LODIndex--)
+	{
+		// The chunk padding after a level belongs to it, so the last level runs to the end of the buffers
+		const int32 LevelBegin = LODLevels[LODIndex].FirstSplat;
+		const int32 LevelEnd = LODLevels.IsValidIndex(LODIndex + 1) ? LODLevels[LODIndex + 1].FirstSplat : SplatCount;
+
+		for (int32 Begin = LevelBegin; Begin < LevelEnd; Begin += PageSplats)
+		{
+			const int32 End = FMath::Min(Begin + PageSplats, LevelEnd);
+
+			FGaussianSplatStreamingPage& Page = StreamingPages.AddDefaulted_GetRef();
+			Page.LODIndex = LODIndex;
+			Page.NumSplats = FMath::Max(0, FMath::Min(End, LevelBegin + LODLevels[LODIndex].NumSplats) - Begin);
+
+			AddSplatRange(Page, &SourceAsset->PositionBulkData, PositionBuffer, 0, PositionDataSize, PositionStride, Begin, End);
+			AddSplatRange(Page, &SourceAsset->OtherBulkData, OtherDataBuffer, 0, OtherDataSize, OtherStride, Begin, End);
+
+			if (SHBulkData && bClusteredSH)
+			{
+				AddSplatRange(Page, SHBulkData, SHBuffer, 0, SHBandOffsets[0], sizeof(uint16), Begin, End);
+			}
+			else if (SHBulkData)
+			{
+				for (int32 Band = 1; Band <= UploadedSHBands; Band++)
+				{
+					AddSplatRange(Page, SHBulkData, SHBuffer, SHBandOffsets[Band - 1], SHBandOffsets[Band],
+						UGaussianSplatAsset::GetSHBandStride(SHFormat, Band), Begin, End);
+				}
+			}
+		}
+	}
+
+	// Clustered SH palettes are shared by every splat and go with the first page
+	if (SHBulkData && bClusteredSH && StreamingPages.Num() > 0)
+	{
+		FGaussianSplatStreamingCopy& Copy = StreamingPages[0].Copies.AddDefaulted_GetRef();
+		Copy.BulkData = SHBulkData;
+		Copy.Buffer = SHBuffer;
+		Copy.Offset = SHBandOffsets[0];
+		Copy.Size = SHDataSize - SHBandOffsets[0];
+	}
+
+	// Drop ranges past the end of short or missing bulk data instead of reading out of bounds
+	for (FGaussianSplatStreamingPage& Page : StreamingPages)
+	{
+		Page.Copies.RemoveAll([](const FGaussianSplatStreamingCopy& Copy)
+		{
+			return !Copy.Buffer || Copy.Size <= 0 || Copy.Offset + Copy.Size > Copy.BulkData->GetBulkDataSize();
+		});
+	}
+
+	for (TArray<int32>& GPUResidentSplatCounts : ResidentSplatCounts)
+	{
+		GPUResidentSplatCounts.Init(0, LODLevels.Num());
+	}
+}
+
+void FGaussianSplatGPUResources::UpdateStreaming(FRHICommandListImmediate& RHICmdList)
+{
+	if (IsFullyResident() || LastStreamingFrame == GFrameCounterRenderThread)
+	{
+		return;
+	}
+	LastStreamingFrame = GFrameCounterRenderThread;
+
+	bool bAnyUploaded = false;
+
+	for (int32 PageIndex = 0; PageIndex < NextPageIndex && NumPagesInFlight > 0; PageIndex++)
+	{
+		FGaussianSplatStreamingPage& Page = StreamingPages[PageIndex];
+		if (!Page.bInFlight)
+		{
+			continue;
+		}
+
+		const bool bReadsComplete = Algo::AllOf(Page.Copies, [](const FGaussianSplatStreamingCopy& Copy)
+		{
+			return !Copy.Request || Copy.Request->PollCompletion();
+		});
+		if (!bReadsComplete)
+		{
+			continue;
+		}
+
+		// GPUs that joined while the reads were in flight get the page too
+		const uint32 UploadGPUBits = GetMissingGPUBits(Page);
+		for (FGaussianSplatStreamingCopy& Copy : Page.Copies)
+		{
+			UploadCopy(RHICmdList, Copy, MakeGPUMask(UploadGPUBits));
+		}
+		Page.UploadedGPUBits |= UploadGPUBits;
+		Page.bInFlight = false;
+		NumPagesInFlight--;
+		bAnyUploaded = true;
+	}
+
+	// Keep a bounded number of reads in flight so staging memory stays at a few pages
+	const int32 MaxPagesInFlight = FMath::Max(1, CVarGaussianSplatStreamingMaxPagesInFlight.GetValueOnRenderThread());
+	while (NumPagesInFlight < MaxPagesInFlight && NextPageIndex < StreamingPages.Num())
+	{
+		FGaussianSplatStreamingPage& Page = StreamingPages[NextPageIndex++];
+		if (GetMissingGPUBits(Page) == 0)
+		{
+			continue;
+		}
+		IssuePage(RHICmdList, Page);
+		if (Page.bInFlight)
+		{
+			NumPagesInFlight++;
+		}
+		else
+		{
+			bAnyUploaded = true;
+		}
+	}
+
+	// GPUs added during this pass still miss the pages issued before they joined, start another pass for them
+	if (NextPageIndex >= StreamingPages.Num() && NumPagesInFlight == 0)
+	{
+		NextPageIndex = StreamingPages.IndexOfByPredicate([this](const FGaussianSplatStreamingPage& Page)
+		{
+			return GetMissingGPUBits(Page) != 0;
+		});
+		if (NextPageIndex == INDEX_NONE)
+		{
+			NextPageIndex = StreamingPages.Num();
+		}
+	}
+
+	if (bAnyUploaded)
+	{
+		UpdateResidentSplatCounts();
+	}
+}
+
+void FGaussianSplatGPUResources::IssuePage(FRHICommandListImmediate& RHICmdList, FGaussianSplatStreamingPage& Page)
+{
+	bool bAnyRequest = false;
+	for (FGaussianSplatStreamingCopy& Copy : Page.Copies)
+	{
+		// Freshly imported or already loaded bulk data has no file to read from, it is copied directly
+		if (!Copy.BulkData->IsBulkDataLoaded() && Copy.BulkData->CanLoadFromDisk())
+		{
+			Copy.Request = Copy.BulkData->CreateStreamingRequest(Copy.Offset, Copy.Size, AIOP_Normal, nullptr, nullptr);
+		}
+		bAnyRequest |= Copy.Request != nullptr;
+	}
+
+	if (!bAnyRequest)
+	{
+		const uint32 UploadGPUBits = GetMissingGPUBits(Page);
+		for (FGaussianSplatStreamingCopy& Copy : Page.Copies)
+		{
+			UploadCopy(RHICmdList, Copy, MakeGPUMask(UploadGPUBits));
+		}
+		Page.UploadedGPUBits |= UploadGPUBits;
+	}
+	Page.bInFlight = bAnyRequest;
+}
+
+void FGaussianSplatGPUResources::AddViewGPUs(const FRHIGPUMask& InGPUMask)
+{
+	if (ViewGPUMask.IsSet() && ViewGPUMask->ContainsAll(InGPUMask))
+	{
+		return;
+	}
+	ViewGPUMask = ViewGPUMask.IsSet() ? (*ViewGPUMask | InGPUMask) : InGPUMask;
+
+	// The GPUs that already hold pages keep their residency, the added ones get every page in another pass,
+	// started here once streaming finished or at the end of the pass in progress
+	if (IsFullyResident())
+	{
+		NextPageIndex = 0;
+	}
+}
+
+uint32 FGaussianSplatGPUResources::GetMissingGPUBits(const FGaussianSplatStreamingPage& Page) const
+{
+	return ViewGPUMask.Get(FRHIGPUMask::All()).GetNative() & ~Page.UploadedGPUBits;
+}
+
+void FGaussianSplatGPUResources::UploadCopy(FRHICommandListImmediate& RHICmdList, FGaussianSplatStreamingCopy& Copy, const FRHIGPUMask& GPUMask)
+{
+	uint8* ReadResults = nullptr;
+	if (Copy.Request)
+	{
+		ReadResults = Copy.Request->GetReadResults();
+		delete Copy.Request;
+		Copy.Request = nullptr;
+
+		if (!ReadResults)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: Streaming read of %lld bytes failed, loading the bulk data instead"), Copy.Size);
+		}
+	}
+
+	const uint8* Src = ReadResults;
+	if (!ReadResults)
+	{
+		const uint8* BulkSrc = static_cast<const uint8*>(Copy.BulkData->LockReadOnly());
+		Src = BulkSrc ? BulkSrc + Copy.Offset : nullptr;
+	}
+
+	const uint32 Offset = static_cast<uint32>(Copy.Offset);
+	const uint32 Size = static_cast<uint32>(Copy.Size);
+	if (GPUMask == FRHIGPUMask::All())
+	{
+		void* Dest = RHICmdList.LockBuffer(Copy.Buffer, Offset, Size, RLM_WriteOnly);
+		if (Src)
+		{
+			FMemory::Memcpy(Dest, Src, Size);
+		}
+		else
+		{
+			FMemory::Memzero(Dest, Size);
+		}
+		RHICmdList.UnlockBuffer(Copy.Buffer);
+	}
+	else
+	{
+		// A lock writes every GPU the buffer exists on, a copy recorded under a GPU mask only the masked ones
+		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(TEXT("GaussianStreamingStagingBuffer"), Size, 0, BUF_Dynamic | BUF_SourceCopy)
+			.SetInitialState(ERHIAccess::CopySrc);
+		FBufferRHIRef StagingBuffer = RHICmdList.CreateBuffer(Desc);
+
+		void* Staging = RHICmdList.LockBuffer(StagingBuffer, 0, Size, RLM_WriteOnly);
+		if (Src)
+		{
+			FMemory::Memcpy(Staging, Src, Size);
+		}
+		else
+		{
+			FMemory::Memzero(Staging, Size);
+		}
+		RHICmdList.UnlockBuffer(StagingBuffer);
+
+		SCOPED_GPU_MASK(RHICmdList, GPUMask);
+		RHICmdList.Transition(FRHITransitionInfo(Copy.Buffer, ERHIAccess::SRVMask, ERHIAccess::CopyDest));
+		RHICmdList.CopyBufferRegion(Copy.Buffer, Offset, StagingBuffer, 0, Size);
+		RHICmdList.Transition(FRHITransitionInfo(Copy.Buffer, ERHIAccess::CopyDest, ERHIAccess::SRVMask));
+	}
+
+	if (ReadResults)
+	{
+		FMemory::Free(ReadResults);
+	}
+	else
+	{
+		Copy.BulkData->Unlock();
+	}
+}
+
+void FGaussianSplatGPUResources::UpdateResidentSplatCounts()
+{
+	// A level is renderable on a GPU up to its first page that is not uploaded there yet
+	for (uint32 GPUIndex = 0; GPUIndex < MAX_NUM_GPUS; GPUIndex++)
+	{
+		const uint32 GPUBit = 1u << GPUIndex;
+		int32 PageIndex = 0;
+		for (int32 LODIndex = LODLevels.Num() - 1; LODIndex >= 0; LODIndex--)
+		{
+			int32 ResidentCount = 0;
+			bool bContiguous = true;
+			for (; PageIndex < StreamingPages.Num() && StreamingPages[PageIndex].LODIndex == LODIndex; PageIndex++)
+			{
+				bContiguous &= (StreamingPages[PageIndex].UploadedGPUBits & GPUBit) != 0;
+				if (bContiguous)
+				{
+					ResidentCount += StreamingPages[PageIndex].NumSplats;
+				}
+			}
+			ResidentSplatCounts[GPUIndex][LODIndex] = ResidentCount;
+		}
+	}
+}
+
+int32 FGaussianSplatGPUResources::GetResidentSplatCount(int32 LODIndex, const FRHIGPUMask& GPUMask) const
+{
+	int32 ResidentCount = MAX_int32;
+	for (uint32 GPUIndex : GPUMask)
+	{
+		const TArray<int32>& GPUResidentSplatCounts = ResidentSplatCounts[GPUIndex];
+		ResidentCount = FMath::Min(ResidentCount, GPUResidentSplatCounts.IsValidIndex(LODIndex) ? GPUResidentSplatCounts[LODIndex] : 0);
+	}
+	return ResidentCount == MAX_int32 ? 0 : ResidentCount;
+}
+
+int64 FGaussianSplatGPUResources::GetGPUMemoryBytes() const
+{
+	int64 Bytes = 0;
+	for (const FBufferRHIRef& Buffer : { PositionBuffer, OtherDataBuffer, SHBuffer, ChunkBuffer, IndexBuffer, DynamicUploadBuffer })
+	{
+		Bytes += Buffer.IsValid() ? Buffer->GetSize() : 0;
+	}
+	for (const TRefCountPtr<FRDGPooledBuffer>& Buffer : { DynamicSplatBuffer, DeformedSplatBuffer })
+	{
+		Bytes += Buffer.IsValid() ? Buffer->Desc.GetSize() : 0;
+	}
+	return Bytes;
+}
+
+void FGaussianSplatGPUResources::TrackBufferMemory(int64 Bytes)
+{
+	INC_MEMORY_STAT_BY(STAT_GaussianSplatStaticBufferMemory, Bytes);
+	TrackedBufferMemory += Bytes;
+}
+
+void FGaussianSplatGPUResources::EnqueueDynamicUpdate(int32 FirstSplat, TArray<FGaussianSplatDynamicData>&& Splats)
+{
+	check(IsInRenderingThread());
+
+	if (!bDynamic || Splats.Num() == 0)
+	{
+		return;
+	}
+
+	FGaussianSplatDynamicUpdate& Update = PendingDynamicUpdates.AddDefaulted_GetRef();
+	Update.FirstSplat = FirstSplat;
+	Update.Splats = MoveTemp(Splats);
+}
+
+void FGaussianSplatGPUResources::SetDeformDelegate(const FGaussianSplatDeformDelegate& InDeformDelegate)
+{
+	check(IsInRenderingThread());
+
+	DeformDelegate = InDeformDelegate;
+	if (!DeformDelegate.IsBound() && DeformedSplatBuffer.IsValid())
+	{
+		// Back to the splats as last updated
+		TrackBufferMemory(-(int64)DeformedSplatBuffer->Desc.GetSize());
+		DeformedSplatBuffer.SafeRelease();
+		DynamicRevision++;
+	}
+}
+
+void FGaussianSplatGPUResources::UpdateDynamicSplats(FRDGBuilder& GraphBuilder, float WorldTimeSeconds)
+{
+	if (!bDynamic || !IsValid() || LastDynamicUpdateFrame == GFrameCounterRenderThread)
+	{
+		return;
+	}
+
+	// The full detail level has to be resident before it can be decoded
+	const int32 NumDynamicSplats = LODLevels[0].NumSplats;
+	if (!DynamicSplatBuffer.IsValid() && GetResidentSplatCount(0, FRHIGPUMask::All()) < NumDynamicSplats)
+	{
+		return;
+	}
+	LastDynamicUpdateFrame = GFrameCounterRenderThread;
+
+	// Runs once per frame for every view family, and partial updates cannot be replayed on a GPU that
+	// starts rendering the component later, so the result goes to every GPU (see Initialize)
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatDynamicUpdate");
+	RDG_GPU_MASK_SCOPE(GraphBuilder, FRHIGPUMask::All());
+
+	FRDGBufferRef SplatBuffer = nullptr;
+	if (DynamicSplatBuffer.IsValid())
+	{
+		SplatBuffer = GraphBuilder.RegisterExternalBuffer(DynamicSplatBuffer);
+	}
+	else
+	{
+		SplatBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FGaussianSplatDynamicData), NumDynamicSplats),
+			TEXT("GaussianDynamicSplatBuffer"));
+		AddInitDynamicSplatsPass(GraphBuilder, SplatBuffer);
+		DynamicSplatBuffer = GraphBuilder.ConvertToExternalBuffer(SplatBuffer);
+		TrackBufferMemory(DynamicSplatBuffer->Desc.GetSize());
+		DynamicRevision++;
+	}
+
+	if (PendingDynamicUpdates.Num() > 0)
+	{
+		AddDynamicUploadPass(GraphBuilder, SplatBuffer);
+		DynamicRevision++;
+	}
+
+	if (DeformDelegate.IsBound())
+	{
+		// The pass deforms a fresh copy every frame, so deformations never accumulate
+		FRDGBufferRef DeformedBuffer = nullptr;
+		if (DeformedSplatBuffer.IsValid())
+		{
+			DeformedBuffer = GraphBuilder.RegisterExternalBuffer(DeformedSplatBuffer);
 		}
 		else
 		{
-			FMemory::Memzero(Data, ChunkSize);  // Zero-initialize dummy entry
+			DeformedBuffer = GraphBuilder.CreateBuffer(SplatBuffer->Desc, TEXT("GaussianDeformedSplatBuffer"));
+			DeformedSplatBuffer = GraphBuilder.ConvertToExternalBuffer(DeformedBuffer);
+			TrackBufferMemory(DeformedSplatBuffer->Desc.GetSize());
 		}
-		RHICmdList.UnlockBuffer(ChunkBuffer);
+		AddCopyBufferPass(GraphBuilder, DeformedBuffer, SplatBuffer);
+
+		FGaussianSplatDeformContext Context;
+		Context.RestSplatBuffer = SplatBuffer;
+		Context.SplatBuffer = DeformedBuffer;
+		Context.NumSplats = NumDynamicSplats;
+		Context.WorldTimeSeconds = WorldTimeSeconds;
+		DeformDelegate.Execute(GraphBuilder, Context);
+		DynamicRevision++;
+	}
+}
 
-		ChunkBufferSRV = RHICmdList.CreateShaderResourceView(
-			ChunkBuffer, FRHIViewDesc::CreateBufferSRV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(FGaussianChunkInfo)));
+void FGaussianSplatGPUResources::AddInitDynamicSplatsPass(FRDGBuilder& GraphBuilder, FRDGBufferRef SplatBuffer)
+{
+	TShaderMapRef<FGaussianSplatInitDynamicSplatsCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	if (!ComputeShader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FGaussianSplatInitDynamicSplatsCS shader not valid"));
+		return;
 	}
 
-	// Clear cached data
-	CachedPositionData.Empty();
-	CachedOtherData.Empty();
-	CachedSHData.Empty();
-	CachedChunkData.Empty();
+	const uint32 NumSplats = SplatBuffer->Desc.NumElements;
+	FGaussianSplatInitDynamicSplatsCS::FParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatInitDynamicSplatsCS::FParameters>();
+	Parameters->PositionBuffer = PositionBufferSRV;
+	Parameters->OtherDataBuffer = OtherDataBufferSRV;
+	Parameters->ChunkBuffer = ChunkBufferSRV;
+	Parameters->ColorTexture = ColorTextureSRV;
+	Parameters->ColorSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	Parameters->DynamicSplatBuffer = GraphBuilder.CreateUAV(SplatBuffer);
+	Parameters->SplatCount = NumSplats;
+	Parameters->ColorTextureSize = ColorTexture->GetSizeXY();
+	Parameters->PositionFormat = GetPositionFormatUint();
+	Parameters->ScaleFormat = GetScaleFormatUint();
+
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("GaussianSplatInitDynamicSplats"),
+		ComputeShader,
+		Parameters,
+		FComputeShaderUtils::GetGroupCount((int32)NumSplats, 64));
 }
 
-void FGaussianSplatGPUResources::CreateDynamicBuffers(FRHICommandListBase& RHICmdList)
+void FGaussianSplatGPUResources::AddDynamicUploadPass(FRDGBuilder& GraphBuilder, FRDGBufferRef SplatBuffer)
 {
-	// Pad to power of 2 for bitonic sort
-	uint32 PaddedCount = FMath::RoundUpToPowerOfTwo(SplatCount);
+	constexpr uint32 SplatBytes = sizeof(FGaussianSplatDynamicData);
+	const uint32 RingBytes = (uint32)FMath::Clamp(CVarGaussianSplatDynamicUploadBufferMB.GetValueOnRenderThread(), 1, 1024) * 1024 * 1024;
+	const uint32 SliceSize = RingBytes / DynamicUploadRingSlices / SplatBytes * SplatBytes;
 
-	// View data buffer (per-frame computed data)
+	FRHICommandListBase& RHICmdList = GraphBuilder.RHICmdList;
+	if (!DynamicUploadBuffer.IsValid() || DynamicUploadSliceSize != SliceSize)
 	{
-		const uint32 BufferSize = SplatCount * sizeof(FGaussianSplatViewData);
-		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianViewDataBuffer"),
-			BufferSize,
-			sizeof(FGaussianSplatViewData),
-			BUF_UnorderedAccess | BUF_ShaderResource | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		ViewDataBuffer = RHICmdList.CreateBuffer(Desc);
-
-		ViewDataBufferUAV = RHICmdList.CreateUnorderedAccessView(
-			ViewDataBuffer, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(FGaussianSplatViewData)));
-		ViewDataBufferSRV = RHICmdList.CreateShaderResourceView(
-			ViewDataBuffer, FRHIViewDesc::CreateBufferSRV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(FGaussianSplatViewData)));
-	}
+		// Copies still reading the old ring keep it alive until they complete
+		if (DynamicUploadBuffer.IsValid())
+		{
+			TrackBufferMemory(-(int64)DynamicUploadBuffer->GetSize());
+		}
 
-	// Sort distance buffer - sized to PaddedCount for bitonic sort
-	{
-		const uint32 BufferSize = PaddedCount * sizeof(uint32);
 		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianSortDistanceBuffer"),
-			BufferSize,
-			sizeof(uint32),
-			BUF_UnorderedAccess | BUF_ShaderResource | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		SortDistanceBuffer = RHICmdList.CreateBuffer(Desc);
-
-		SortDistanceBufferUAV = RHICmdList.CreateUnorderedAccessView(
-			SortDistanceBuffer, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
-		SortDistanceBufferSRV = RHICmdList.CreateShaderResourceView(
-			SortDistanceBuffer, FRHIViewDesc::CreateBufferSRV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
+			TEXT("GaussianDynamicUploadBuffer"),
+			SliceSize * DynamicUploadRingSlices,
+			0,
+			BUF_Dynamic | BUF_SourceCopy)
+			.SetInitialState(ERHIAccess::CopySrc);
+		DynamicUploadBuffer = RHICmdList.CreateBuffer(Desc);
+		DynamicUploadSliceSize = SliceSize;
+		TrackBufferMemory(DynamicUploadBuffer->GetSize());
 	}
 
-	// Sort keys buffer - sized to PaddedCount for bitonic sort
+	struct FUploadCopy
 	{
-		const uint32 BufferSize = PaddedCount * sizeof(uint32);
-
-		FRHIBufferCreateDesc Desc1 = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianSortKeysBuffer"),
-			BufferSize,
-			sizeof(uint32),
-			BUF_UnorderedAccess | BUF_ShaderResource | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		SortKeysBuffer = RHICmdList.CreateBuffer(Desc1);
-		SortKeysBufferUAV = RHICmdList.CreateUnorderedAccessView(
-			SortKeysBuffer, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
-		SortKeysBufferSRV = RHICmdList.CreateShaderResourceView(
-			SortKeysBuffer, FRHIViewDesc::CreateBufferSRV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
-
-		FRHIBufferCreateDesc Desc2 = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianSortKeysBufferAlt"),
-			BufferSize,
-			sizeof(uint32),
-			BUF_UnorderedAccess | BUF_ShaderResource | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		SortKeysBufferAlt = RHICmdList.CreateBuffer(Desc2);
-		SortKeysBufferAltUAV = RHICmdList.CreateUnorderedAccessView(
-			SortKeysBufferAlt, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
-		SortKeysBufferAltSRV = RHICmdList.CreateShaderResourceView(
-			SortKeysBufferAlt, FRHIViewDesc::CreateBufferSRV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
+		uint32 SrcOffset = 0;
+		uint32 DestOffset = 0;
+		uint32 NumBytes = 0;
+	};
+	TArray<FUploadCopy> Copies;
+
+	// Stage the oldest updates first so later updates of the same splats win
+	const uint32 SliceOffset = (uint32)(GFrameCounterRenderThread % DynamicUploadRingSlices) * SliceSize;
+	uint8* Dest = static_cast<uint8*>(RHICmdList.LockBuffer(DynamicUploadBuffer, SliceOffset, SliceSize, RLM_WriteOnly_NoOverwrite));
+	uint32 UsedBytes = 0;
+	while (PendingDynamicUpdates.Num() > 0 && UsedBytes + SplatBytes <= SliceSize)
+	{
+		FGaussianSplatDynamicUpdate& Update = PendingDynamicUpdates[0];
+		const int32 NumSplats = FMath::Min(Update.Splats.Num() - Update.NumUploaded, (int32)((SliceSize - UsedBytes) / SplatBytes));
+
+		FUploadCopy& Copy = Copies.AddDefaulted_GetRef();
+		Copy.SrcOffset = SliceOffset + UsedBytes;
+		Copy.DestOffset = (uint32)(Update.FirstSplat + Update.NumUploaded) * SplatBytes;
+		Copy.NumBytes = (uint32)NumSplats * SplatBytes;
+		FMemory::Memcpy(Dest + UsedBytes, Update.Splats.GetData() + Update.NumUploaded, Copy.NumBytes);
+
+		UsedBytes += Copy.NumBytes;
+		Update.NumUploaded += NumSplats;
+		if (Update.NumUploaded >= Update.Splats.Num())
+		{
+			PendingDynamicUpdates.RemoveAt(0);
+		}
 	}
+	RHICmdList.UnlockBuffer(DynamicUploadBuffer);
+
+	FGaussianSplatDynamicUploadParameters* Parameters = GraphBuilder.AllocParameters<FGaussianSplatDynamicUploadParameters>();
+	Parameters->SplatBuffer = SplatBuffer;
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GaussianSplatDynamicUpload(%d bytes)", UsedBytes),
+		Parameters,
+		ERDGPassFlags::Copy,
+		[Parameters, UploadBuffer = DynamicUploadBuffer, Copies = MoveTemp(Copies)](FRHICommandList& RHICmdList)
+		{
+			for (const FUploadCopy& Copy : Copies)
+			{
+				RHICmdList.CopyBufferRegion(Parameters->SplatBuffer->GetRHI(), Copy.DestOffset, UploadBuffer, Copy.SrcOffset, Copy.NumBytes);
+			}
+		});
+}
 
-	// Sort distance buffer alt (for radix sort ping-pong)
+bool FGaussianSplatGPUResources::HasResidentSplats(const FRHIGPUMask& GPUMask) const
+{
+	for (int32 LODIndex = 0; LODIndex < LODLevels.Num(); LODIndex++)
 	{
-		const uint32 BufferSize = PaddedCount * sizeof(uint32);
-		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianSortDistanceBufferAlt"),
-			BufferSize,
-			sizeof(uint32),
-			BUF_UnorderedAccess | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		SortDistanceBufferAlt = RHICmdList.CreateBuffer(Desc);
-		SortDistanceBufferAltUAV = RHICmdList.CreateUnorderedAccessView(
-			SortDistanceBufferAlt, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
+		if (GetResidentSplatCount(LODIndex, GPUMask) > 0)
+		{
+			return true;
+		}
 	}
+	return false;
+}
 
-	// Radix sort histogram buffer: NumTiles * 256 entries
+void FGaussianSplatGPUResources::CancelStreaming()
+{
+	for (FGaussianSplatStreamingPage& Page : StreamingPages)
 	{
-		uint32 NumTiles = FMath::DivideAndRoundUp(PaddedCount, 1024u);
-		const uint32 BufferSize = NumTiles * 256 * sizeof(uint32);
-		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianRadixHistogramBuffer"),
-			BufferSize,
-			sizeof(uint32),
-			BUF_UnorderedAccess | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		RadixHistogramBuffer = RHICmdList.CreateBuffer(Desc);
-		RadixHistogramBufferUAV = RHICmdList.CreateUnorderedAccessView(
-			RadixHistogramBuffer, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
+		for (FGaussianSplatStreamingCopy& Copy : Page.Copies)
+		{
+			if (Copy.Request)
+			{
+				Copy.Request->Cancel();
+				Copy.Request->WaitCompletion();
+				FMemory::Free(Copy.Request->GetReadResults());
+				delete Copy.Request;
+				Copy.Request = nullptr;
+			}
+		}
 	}
 
-	// Radix sort digit offset buffer: 256 entries
+	StreamingPages.Empty();
+	for (TArray<int32>& GPUResidentSplatCounts : ResidentSplatCounts)
 	{
-		const uint32 BufferSize = 256 * sizeof(uint32);
-		FRHIBufferCreateDesc Desc = FRHIBufferCreateDesc::Create(
-			TEXT("GaussianRadixDigitOffsetBuffer"),
-			BufferSize,
-			sizeof(uint32),
-			BUF_UnorderedAccess | BUF_StructuredBuffer)
-			.SetInitialState(ERHIAccess::UAVCompute);
-		RadixDigitOffsetBuffer = RHICmdList.CreateBuffer(Desc);
-		RadixDigitOffsetBufferUAV = RHICmdList.CreateUnorderedAccessView(
-			RadixDigitOffsetBuffer, FRHIViewDesc::CreateBufferUAV()
-				.SetType(FRHIViewDesc::EBufferType::Structured)
-				.SetStride(sizeof(uint32)));
+		GPUResidentSplatCounts.Empty();
 	}
+	NextPageIndex = 0;
+	NumPagesInFlight = 0;
 }
 
 void FGaussianSplatGPUResources::CreateIndexBuffer(FRHICommandListBase& RHICmdList)
@@ -377,23 +1087,177 @@ void FGaussianSplatGPUResources::CreateDummyWhiteTexture(FRHICommandListBase& RH
 			.SetDimension(ETextureDimension::Texture2D));
 }
 
+//////////////////////////////////////////////////////////////////////////
+// FGaussianSplatGPUResourceCache
+
+TArray<FGaussianSplatGPUResourceCache::FEntry> FGaussianSplatGPUResourceCache::Entries;
+
+FGaussianSplatGPUResources* FGaussianSplatGPUResourceCache::Acquire(UGaussianSplatAsset* Asset, int32 MaxSHOrder, bool bDynamic)
+{
+	check(IsInRenderingThread());
+
+	if (!Asset || !Asset->IsValid())
+	{
+		return nullptr;
+	}
+
+	// Reimported data gets a new id, so proxies still holding the old upload keep it until they go away
+	const uint32 RenderDataId = Asset->GetRenderDataId();
+	const int32 SHBands = FMath::Clamp(FMath::Min(MaxSHOrder, Asset->SHBands), 0, GaussianSplattingConstants::MaxSHOrder);
+
+	// Dynamic resources are edited by their proxy, they are never handed to another one
+	if (FEntry* SharedEntry = bDynamic ? nullptr : FindShared(RenderDataId, SHBands))
+	{
+		SharedEntry->RefCount++;
+		return SharedEntry->Resources;
+	}
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.RenderDataId = RenderDataId;
+	Entry.SHBands = SHBands;
+	Entry.bDynamic = bDynamic;
+	Entry.RefCount = 1;
+	Entry.AssetPath = Asset->GetPathName();
+	Entry.Resources = new FGaussianSplatGPUResources();
+	Entry.Resources->Initialize(Asset, SHBands, bDynamic);
+	return Entry.Resources;
+}
+
+void FGaussianSplatGPUResourceCache::Release(FGaussianSplatGPUResources* Resources)
+{
+	check(IsInRenderingThread());
+
+	const int32 Index = Entries.IndexOfByPredicate([Resources](const FEntry& Entry) { return Entry.Resources == Resources; });
+	if (Index == INDEX_NONE || --Entries[Index].RefCount > 0)
+	{
+		return;
+	}
+
+	Resources->ReleaseResource();
+	delete Resources;
+	Entries.RemoveAtSwap(Index);
+}
+
+const FGaussianSplatGPUResources* FGaussianSplatGPUResourceCache::Find(const UGaussianSplatAsset* Asset, int32 MaxSHOrder)
+{
+	check(IsInRenderingThread());
+
+	if (!Asset || !Asset->IsValid())
+	{
+		return nullptr;
+	}
+
+	const int32 SHBands = FMath::Clamp(FMath::Min(MaxSHOrder, Asset->SHBands), 0, GaussianSplattingConstants::MaxSHOrder);
+	const FEntry* Entry = FindShared(Asset->GetRenderDataId(), SHBands);
+	return Entry ? Entry->Resources : nullptr;
+}
+
+void FGaussianSplatGPUResourceCache::DescribeEntries(TArray<FString>& OutLines)
+{
+	check(IsInRenderingThread());
+
+	int64 TotalBytes = 0;
+	for (const FEntry& Entry : Entries)
+	{
+		const int64 Bytes = Entry.Resources->GetGPUMemoryBytes();
+		TotalBytes += Bytes;
+		OutLines.Add(FString::Printf(TEXT("%10.2f MB  %s, SH %d%s, %d splats, %d proxies"),
+			Bytes / (1024.0 * 1024.0), *Entry.AssetPath, Entry.SHBands, Entry.bDynamic ? TEXT(", dynamic") : TEXT(""),
+			Entry.Resources->GetSplatCount(), Entry.RefCount));
+	}
+	OutLines.Add(FString::Printf(TEXT("%10.2f MB  static buffers of %d uploads"), TotalBytes / (1024.0 * 1024.0), Entries.Num()));
+}
+
+FGaussianSplatGPUResourceCache::FEntry* FGaussianSplatGPUResourceCache::FindShared(uint32 RenderDataId, int32 SHBands)
+{
+	return Entries.FindByPredicate([RenderDataId, SHBands](const FEntry& Entry)
+	{
+		return !Entry.bDynamic && Entry.RenderDataId == RenderDataId && Entry.SHBands == SHBands;
+	});
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FGaussianSplatShadowMesh
+
+FGaussianSplatShadowMesh::FGaussianSplatShadowMesh(ERHIFeatureLevel::Type FeatureLevel)
+	: VertexFactory(FeatureLevel, "FGaussianSplatShadowMesh")
+{
+}
+
+void FGaussianSplatShadowMesh::Init(TConstArrayView<FGaussianSplatShadowSplat> ShadowSplats)
+{
+	NumSplats = ShadowSplats.Num();
+
+	// Vertex 2 * Axis + 0/1 sits at the center +/- that axis
+	TArray<FDynamicMeshVertex> Vertices;
+	Vertices.Reserve(NumSplats * 6);
+	IndexBuffer.Indices.Reserve(NumSplats * 24);
+	for (const FGaussianSplatShadowSplat& Splat : ShadowSplats)
+	{
+		const uint32 BaseVertex = Vertices.Num();
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Vertices.Emplace(Splat.Position + Splat.Axes[Axis]);
+			Vertices.Emplace(Splat.Position - Splat.Axes[Axis]);
+		}
+
+		// One face per octant, wound the same way around the outside whichever way the octant's axes point
+		for (uint32 Octant = 0; Octant < 8; Octant++)
+		{
+			const uint32 X = BaseVertex + (Octant & 1);
+			const uint32 Y = BaseVertex + 2 + ((Octant >> 1) & 1);
+			const uint32 Z = BaseVertex + 4 + ((Octant >> 2) & 1);
+			const bool bFlipped = (FMath::CountBits(Octant) & 1) != 0;
+			IndexBuffer.Indices.Append({ X, bFlipped ? Z : Y, bFlipped ? Y : Z });
+		}
+	}
+
+	VertexBuffers.InitFromDynamicVertex(&VertexFactory, Vertices);
+	BeginInitResource(&IndexBuffer);
+}
+
+void FGaussianSplatShadowMesh::Release()
+{
+	VertexBuffers.PositionVertexBuffer.ReleaseResource();
+	VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
+	VertexBuffers.ColorVertexBuffer.ReleaseResource();
+	IndexBuffer.ReleaseResource();
+	VertexFactory.ReleaseResource();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // FGaussianSplatSceneProxy
 
 FGaussianSplatSceneProxy::FGaussianSplatSceneProxy(const UGaussianSplatComponent* InComponent)
 	: FPrimitiveSceneProxy(InComponent)
 	, CachedAsset(InComponent->SplatAsset)
-	, SplatCount(InComponent->SplatAsset ? InComponent->SplatAsset->GetSplatCount() : 0)
+	, LODLevels(InComponent->SplatAsset ? InComponent->SplatAsset->LODLevels : TArray<FGaussianSplatLODLevel>())
+	, SplatCount(InComponent->SplatAsset ? InComponent->SplatAsset->GetSourceSplatCount() : 0)
+	, MaxSplatsPerView(InComponent->MaxSplatsPerView)
 	, SHOrder(InComponent->SHOrder)
 	, OpacityScale(InComponent->OpacityScale)
 	, SplatScale(InComponent->SplatScale)
 	, bEnableFrustumCulling(InComponent->bEnableFrustumCulling)
+	, bAllowDynamicUpdates(InComponent->bAllowDynamicUpdates)
+	, DeformDelegate(InComponent->GetDeformDelegate())
 {
 	bWillEverBeLit = false;
+
+	// Dynamic splats move away from the imported ones, a shadow of the rest pose would not match them
+	if (CachedAsset && CachedAsset->ShadowSplats.Num() > 0 && !bAllowDynamicUpdates && InComponent->CastShadow)
+	{
+		ShadowMesh = MakeUnique<FGaussianSplatShadowMesh>(GetScene().GetFeatureLevel());
+		ShadowMesh->Init(CachedAsset->ShadowSplats);
+		ShadowMaterial = UMaterial::GetDefaultMaterial(MD_Surface)->GetRenderProxy();
+	}
 }
 
 FGaussianSplatSceneProxy::~FGaussianSplatSceneProxy()
 {
+	if (ShadowMesh)
+	{
+		ShadowMesh->Release();
+	}
 }
 
 SIZE_T FGaussianSplatSceneProxy::GetTypeHash() const
@@ -404,14 +1268,21 @@ SIZE_T FGaussianSplatSceneProxy::GetTypeHash() const
 
 uint32 FGaussianSplatSceneProxy::GetMemoryFootprint() const
 {
-	return sizeof(*this) + GetAllocatedSize();
+	// The per-view buffers and the resources of dynamic updates are this proxy's own,
+	// shared uploads are counted once per asset by STAT_GaussianSplatStaticBufferMemory
+	int64 GPUBytes = ViewResourceCache.GetGPUMemoryBytes();
+	if (GPUResources && GPUResources->IsDynamic())
+	{
+		GPUBytes += GPUResources->GetGPUMemoryBytes();
+	}
+	return sizeof(*this) + GetAllocatedSize() + (uint32)FMath::Min<int64>(GPUBytes, MAX_uint32);
 }
 
 FPrimitiveViewRelevance FGaussianSplatSceneProxy::GetViewRelevance(const FSceneView* View) const
 {
 	FPrimitiveViewRelevance Result;
 	Result.bDrawRelevance = IsShown(View);
-	Result.bShadowRelevance = false; // Gaussian splats don't cast shadows (yet)
+	Result.bShadowRelevance = ShadowMesh.IsValid() && IsShadowCast(View);
 	Result.bDynamicRelevance = true;
 	Result.bStaticRelevance = false;
 	Result.bRenderInMainPass = true;
@@ -428,74 +1299,75 @@ void FGaussianSplatSceneProxy::GetDynamicMeshElements(
 	FMeshElementCollector& Collector) const
 {
 	// Gaussian splatting uses custom rendering via PostOpaqueRender delegate
-	// Only draw debug bounds when selected
-	if (!IsSelected())
+	// Mesh elements are only the shadow stand-in, which draws in shadow depth passes alone, and the debug bounds
+	const int32 ShadowBudget = CVarGaussianSplatShadowSplatBudget.GetValueOnRenderThread();
+	const int32 NumShadowSplats = ShadowMesh ? (ShadowBudget < 0 ? ShadowMesh->GetNumSplats() : FMath::Min(ShadowBudget, ShadowMesh->GetNumSplats())) : 0;
+	if (!IsSelected() && NumShadowSplats == 0)
 	{
 		return;
 	}
 
 	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 	{
-		if (VisibilityMap & (1 << ViewIndex))
+		if (!(VisibilityMap & (1 << ViewIndex)))
+		{
+			continue;
+		}
+
+		if (NumShadowSplats > 0)
 		{
-			FPrimitiveDrawInterface* PDI = Collector.GetPDI(ViewIndex);
+			FMeshBatch& Mesh = Collector.AllocateMesh();
+			Mesh.VertexFactory = &ShadowMesh->VertexFactory;
+			Mesh.MaterialRenderProxy = ShadowMaterial;
+			Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+			Mesh.Type = PT_TriangleList;
+			Mesh.DepthPriorityGroup = SDPG_World;
+			Mesh.bCanApplyViewModeOverrides = false;
+			Mesh.CastShadow = true;
+			Mesh.bUseForMaterial = false;
+			Mesh.bUseForDepthPass = false;
+			Mesh.bUseAsOccluder = false;
+			Mesh.bSelectable = false;
+
+			FMeshBatchElement& BatchElement = Mesh.Elements[0];
+			BatchElement.IndexBuffer = &ShadowMesh->IndexBuffer;
+			BatchElement.PrimitiveUniformBuffer = GetUniformBuffer();
+			BatchElement.FirstIndex = 0;
+			BatchElement.NumPrimitives = NumShadowSplats * 8;
+			BatchElement.MinVertexIndex = 0;
+			BatchElement.MaxVertexIndex = NumShadowSplats * 6 - 1;
+			Collector.AddMesh(ViewIndex, Mesh);
+		}
 
-			// Draw bounds when selected
-			RenderBounds(PDI, ViewFamily.EngineShowFlags, GetBounds(), true);
+		// Draw bounds when selected
+		if (IsSelected())
+		{
+			RenderBounds(Collector.GetPDI(ViewIndex), ViewFamily.EngineShowFlags, GetBounds(), true);
 		}
 	}
 }
 
 void FGaussianSplatSceneProxy::CreateRenderThreadResources(FRHICommandListBase& RHICmdList)
 {
-	UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: CreateRenderThreadResources called! SplatCount=%d"), SplatCount);
-
 	if (CachedAsset && CachedAsset->IsValid())
 	{
-		GPUResources = new FGaussianSplatGPUResources();
-		GPUResources->Initialize(CachedAsset);
-
-		// Get color texture reference
-		if (CachedAsset->ColorTexture)
-		{
-			// If platform data exists but no resource, try to create it
-			FTextureResource* TextureResource = CachedAsset->ColorTexture->GetResource();
-			FTexturePlatformData* PlatformData = CachedAsset->ColorTexture->GetPlatformData();
-			int64 BulkDataSize = 0;
-			if (PlatformData && PlatformData->Mips.Num() > 0)
-			{
-				BulkDataSize = PlatformData->Mips[0].BulkData.GetBulkDataSize();
-			}
-
-			if (!TextureResource && PlatformData && BulkDataSize > 0)
-			{
-				CachedAsset->ColorTexture->UpdateResource();
-				TextureResource = CachedAsset->ColorTexture->GetResource();
-			}
+		AcquireGPUResources();
 
-			if (TextureResource && TextureResource->TextureRHI)
-			{
-				GPUResources->ColorTexture = TextureResource->TextureRHI;
-				GPUResources->ColorTextureSRV = RHICmdList.CreateShaderResourceView(
-					GPUResources->ColorTexture,
-					FRHIViewDesc::CreateTextureSRV()
-						.SetDimension(ETextureDimension::Texture2D));
-			}
-		}
-
-		// Register with view extension for rendering
+		// Register with view extension for rendering, it retries the color texture until its resource exists
 		FGaussianSplatViewExtension* ViewExtension = FGaussianSplatViewExtension::Get();
 		if (ViewExtension)
 		{
 			ViewExtension->RegisterProxy(const_cast<FGaussianSplatSceneProxy*>(this));
+			if (!TryInitializeColorTexture(RHICmdList))
+			{
+				ViewExtension->RequestColorTextureInit(const_cast<FGaussianSplatSceneProxy*>(this));
+			}
 		}
 	}
 }
 
 void FGaussianSplatSceneProxy::DestroyRenderThreadResources()
 {
-	UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: DestroyRenderThreadResources called!"));
-
 	// Unregister from view extension
 	FGaussianSplatViewExtension* ViewExtension = FGaussianSplatViewExtension::Get();
 	if (ViewExtension)
@@ -503,27 +1375,140 @@ void FGaussianSplatSceneProxy::DestroyRenderThreadResources()
 		ViewExtension->UnregisterProxy(const_cast<FGaussianSplatSceneProxy*>(this));
 	}
 
+	ViewResourceCache.Empty();
+
 	if (GPUResources)
 	{
-		GPUResources->ReleaseResource();
-		delete GPUResources;
+		FGaussianSplatGPUResourceCache::Release(GPUResources);
 		GPUResources = nullptr;
 	}
 }
 
-void FGaussianSplatSceneProxy::TryInitializeColorTexture(FRHICommandListBase& RHICmdList)
+void FGaussianSplatSceneProxy::AcquireGPUResources()
 {
-	if (!GPUResources || GPUResources->ColorTextureSRV.IsValid())
+	// Other proxies of the same asset may already have uploaded (or be streaming) the splat data.
+	// Dynamic resources are this proxy's alone and upload every SH band, so an SH order change never replaces them.
+	if (bAllowDynamicUpdates)
+	{
+		GPUResources = FGaussianSplatGPUResourceCache::Acquire(CachedAsset, GaussianSplattingConstants::MaxSHOrder, true);
+		if (GPUResources)
+		{
+			GPUResources->SetDeformDelegate(DeformDelegate);
+		}
+	}
+	else
+	{
+		GPUResources = FGaussianSplatGPUResourceCache::Acquire(CachedAsset, SHOrder);
+	}
+}
+
+void FGaussianSplatSceneProxy::SetBudgetDowngraded_RenderThread(bool bInDowngraded)
+{
+	if (bBudgetDowngraded != bInDowngraded)
+	{
+		FullDetailViewGPUMemoryBytes = bInDowngraded ? ViewResourceCache.GetGPUMemoryBytes() : 0;
+		bBudgetDowngraded = bInDowngraded;
+		ViewResourceCache.Empty();
+	}
+}
+
+void FGaussianSplatSceneProxy::EvictGPUResources_RenderThread()
+{
+	if (bEvicted || !GPUResources || bAllowDynamicUpdates)
 	{
-		// Already initialized or no resources
 		return;
 	}
 
-	if (!CachedAsset || !CachedAsset->ColorTexture)
+	EvictedGPUMemoryBytes = GPUResources->GetGPUMemoryBytes();
+	ViewResourceCache.Empty();
+	FGaussianSplatGPUResourceCache::Release(GPUResources);
+	GPUResources = nullptr;
+	bEvicted = true;
+}
+
+void FGaussianSplatSceneProxy::RestoreGPUResources_RenderThread(FRHICommandListBase& RHICmdList)
+{
+	if (!bEvicted)
 	{
 		return;
 	}
 
+	bEvicted = false;
+	EvictedGPUMemoryBytes = 0;
+	AcquireGPUResources();
+
+	// A fresh upload has no color texture SRV yet
+	FGaussianSplatViewExtension* ViewExtension = FGaussianSplatViewExtension::Get();
+	if (ViewExtension && !TryInitializeColorTexture(RHICmdList))
+	{
+		ViewExtension->RequestColorTextureInit(this);
+	}
+}
+
+FGaussianSplatViewResources* FGaussianSplatSceneProxy::FindOrAddViewResources(const FSceneView& View)
+{
+	if (!GPUResources || !GPUResources->IsValid())
+	{
+		return nullptr;
+	}
+
+	return ViewResourceCache.FindOrAdd(View);
+}
+
+void FGaussianSplatSceneProxy::SetRenderParameters_RenderThread(int32 InSHOrder, float InOpacityScale, float InSplatScale, int32 InMaxSplatsPerView, bool bInEnableFrustumCulling)
+{
+	// Fewer bands than uploaded are clamped in the shader; more need an upload that includes them
+	if (GPUResources && CachedAsset && InSHOrder > SHOrder && FMath::Min(InSHOrder, CachedAsset->SHBands) > GPUResources->UploadedSHBands)
+	{
+		FGaussianSplatGPUResources* NewResources = FGaussianSplatGPUResourceCache::Acquire(CachedAsset, InSHOrder);
+		FGaussianSplatGPUResourceCache::Release(GPUResources);
+		GPUResources = NewResources;
+		ViewResourceCache.Empty();
+
+		// A fresh upload has no color texture SRV yet
+		if (FGaussianSplatViewExtension* ViewExtension = FGaussianSplatViewExtension::Get())
+		{
+			ViewExtension->RequestColorTextureInit(this);
+		}
+	}
+
+	SHOrder = InSHOrder;
+	OpacityScale = InOpacityScale;
+	SplatScale = InSplatScale;
+	MaxSplatsPerView = InMaxSplatsPerView;
+	bEnableFrustumCulling = bInEnableFrustumCulling;
+}
+
+void FGaussianSplatSceneProxy::UpdateSplats_RenderThread(int32 FirstSplat, TArray<FGaussianSplatDynamicData>&& Splats)
+{
+	if (GPUResources)
+	{
+		GPUResources->EnqueueDynamicUpdate(FirstSplat, MoveTemp(Splats));
+	}
+}
+
+void FGaussianSplatSceneProxy::SetDeformDelegate_RenderThread(const FGaussianSplatDeformDelegate& InDeformDelegate)
+{
+	DeformDelegate = InDeformDelegate;
+	if (GPUResources && GPUResources->IsDynamic())
+	{
+		GPUResources->SetDeformDelegate(DeformDelegate);
+	}
+}
+
+bool FGaussianSplatSceneProxy::TryInitializeColorTexture(FRHICommandListBase& RHICmdList)
+{
+	if (!GPUResources || GPUResources->ColorTextureSRV.IsValid())
+	{
+		// Already initialized (possibly by another proxy sharing the resources) or no resources
+		return true;
+	}
+
+	if (!CachedAsset || !CachedAsset->ColorTexture)
+	{
+		return false;
+	}
+
 	FTextureResource* TextureResource = CachedAsset->ColorTexture->GetResource();
 
 	// If resource doesn't exist but platform data does, try to create it
@@ -550,5 +1535,98 @@ void FGaussianSplatSceneProxy::TryInitializeColorTexture(FRHICommandListBase& RH
 			GPUResources->ColorTexture,
 			FRHIViewDesc::CreateTextureSRV()
 				.SetDimension(ETextureDimension::Texture2D));
+		return true;
+	}
+
+	return false;
+}
+
+bool FGaussianSplatSceneProxy::IsRenderableInView(const FSceneView& View) const
+{
+	// Check if proxy is shown in this view (respects visibility flags)
+	if (!IsShown(&View))
+	{
+		return false;
+	}
+
+	// Require full validation, and at least part of one LOD level streamed in
+	if (!GPUResources || !GPUResources->IsValid() || !GPUResources->HasResidentSplats(View.GPUMask))
+	{
+		return false;
+	}
+
+	// Check visibility - frustum culling
+	const FBoxSphereBounds& Bounds = GetBounds();
+	return !bEnableFrustumCulling || View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent);
+}
+
+void FGaussianSplatSceneProxy::SelectLOD(const FSceneView& View, int32& OutSplatOffset, int32& OutSplatCount) const
+{
+	OutSplatOffset = 0;
+	OutSplatCount = SplatCount;
+
+	// Dynamic splats only exist at full detail
+	if (GPUResources && GPUResources->HasDynamicSplats())
+	{
+		return;
+	}
+	if (LODLevels.Num() == 0)
+	{
+		if (GPUResources)
+		{
+			OutSplatCount = FMath::Min(SplatCount, GPUResources->GetResidentSplatCount(0, View.GPUMask));
+		}
+		return;
+	}
+
+	int32 LODIndex = 0;
+	const int32 ForcedLOD = CVarGaussianSplatForceLOD.GetValueOnRenderThread();
+	if (ForcedLOD >= 0)
+	{
+		LODIndex = FMath::Min(ForcedLOD, LODLevels.Num() - 1);
+	}
+	else if (bBudgetDowngraded)
+	{
+		LODIndex = LODLevels.Num() - 1;
+	}
+	else
+	{
+		int64 MaxSplats = MAX_int64;
+
+		// More splats than a few per covered pixel cost sort and raster time without adding detail
+		const float SplatsPerPixel = CVarGaussianSplatLODSplatsPerPixel.GetValueOnRenderThread();
+		if (SplatsPerPixel > 0.0f)
+		{
+			const FBoxSphereBounds& Bounds = GetBounds();
+			const double ScreenSize = ComputeBoundsScreenSize(Bounds.Origin, Bounds.SphereRadius, View);
+			const double RadiusPixels = 0.5 * ScreenSize * FMath::Max(View.UnscaledViewRect.Width(), View.UnscaledViewRect.Height());
+			MaxSplats = (int64)FMath::Min(UE_PI * RadiusPixels * RadiusPixels * SplatsPerPixel, (double)MAX_int64);
+		}
+		if (MaxSplatsPerView > 0)
+		{
+			MaxSplats = FMath::Min(MaxSplats, (int64)MaxSplatsPerView);
+		}
+
+		// Finest level within the limit, the coarsest level when none fits
+		while (LODIndex < LODLevels.Num() - 1 && LODLevels[LODIndex].NumSplats > MaxSplats)
+		{
+			LODIndex++;
+		}
+	}
+
+	// While streaming, fall back to the finest coarser level that is complete, or else to the
+	// uploaded part of the coarsest level, which streams first
+	if (GPUResources && !GPUResources->IsFullyResident())
+	{
+		while (LODIndex < LODLevels.Num() - 1 && GPUResources->GetResidentSplatCount(LODIndex, View.GPUMask) < LODLevels[LODIndex].NumSplats)
+		{
+			LODIndex++;
+		}
+		OutSplatOffset = LODLevels[LODIndex].FirstSplat;
+		OutSplatCount = GPUResources->GetResidentSplatCount(LODIndex, View.GPUMask);
+		return;
 	}
+
+	OutSplatOffset = LODLevels[LODIndex].FirstSplat;
+	OutSplatCount = LODLevels[LODIndex].NumSplats;
 }
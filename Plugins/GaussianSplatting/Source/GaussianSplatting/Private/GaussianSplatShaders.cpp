@@ -6,10 +6,25 @@
 
 // Implement global shaders
 IMPLEMENT_GLOBAL_SHADER(FGaussianSplatCalcViewDataCS, "/Plugin/GaussianSplatting/Private/CalcViewData.usf", "MainCS", SF_Compute);
-IMPLEMENT_GLOBAL_SHADER(FGaussianSplatCalcDistancesCS, "/Plugin/GaussianSplatting/Private/CalcDistances.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatCullChunksCS, "/Plugin/GaussianSplatting/Private/CullChunks.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatRefineSortCS, "/Plugin/GaussianSplatting/Private/CalcDistances.usf", "RefineSortCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatBuildIndirectArgsCS, "/Plugin/GaussianSplatting/Private/CalcDistances.usf", "BuildIndirectArgsCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatTileCountCS, "/Plugin/GaussianSplatting/Private/TileRasterizer.usf", "TileCountCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatTileScanCS, "/Plugin/GaussianSplatting/Private/TileRasterizer.usf", "TileScanCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatTileEmitCS, "/Plugin/GaussianSplatting/Private/TileRasterizer.usf", "TileEmitCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatTileRangesCS, "/Plugin/GaussianSplatting/Private/TileRasterizer.usf", "TileRangesCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatTileRasterizeCS, "/Plugin/GaussianSplatting/Private/TileRasterizer.usf", "TileRasterizeCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatFoveationRateCS, "/Plugin/GaussianSplatting/Private/FoveatedShadingRate.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatHZBFromDepthCS, "/Plugin/GaussianSplatting/Private/OcclusionHZB.usf", "BuildFromDepthCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatHZBDownsampleCS, "/Plugin/GaussianSplatting/Private/OcclusionHZB.usf", "DownsampleCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatInitDynamicSplatsCS, "/Plugin/GaussianSplatting/Private/DynamicSplats.usf", "InitCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FGaussianSplatVS, "/Plugin/GaussianSplatting/Private/GaussianSplatRendering.usf", "MainVS", SF_Vertex);
 IMPLEMENT_GLOBAL_SHADER(FGaussianSplatPS, "/Plugin/GaussianSplatting/Private/GaussianSplatRendering.usf", "MainPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FGaussianSplatDepthPS, "/Plugin/GaussianSplatting/Private/GaussianSplatRendering.usf", "DepthPS", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FRadixSortCountCS, "/Plugin/GaussianSplatting/Private/RadixSort.usf", "CountCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FRadixSortPrefixSumCS, "/Plugin/GaussianSplatting/Private/RadixSort.usf", "PrefixSumCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FRadixSortDigitPrefixSumCS, "/Plugin/GaussianSplatting/Private/RadixSort.usf", "DigitPrefixSumCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FRadixSortScatterCS, "/Plugin/GaussianSplatting/Private/RadixSort.usf", "ScatterCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FRadixSortOneSweepHistogramCS, "/Plugin/GaussianSplatting/Private/RadixSortOneSweep.usf", "HistogramCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FRadixSortOneSweepHistogramScanCS, "/Plugin/GaussianSplatting/Private/RadixSortOneSweep.usf", "HistogramScanCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FRadixSortOneSweepScatterCS, "/Plugin/GaussianSplatting/Private/RadixSortOneSweep.usf", "ScatterCS", SF_Compute);
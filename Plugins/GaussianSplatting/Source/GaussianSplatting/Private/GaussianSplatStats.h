@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/RealtimeGPUProfiler.h"
+
+/**
+ * Stats of the splat pipeline ("stat GaussianSplatting"), defined in GaussianSplatting.cpp.
+ * Counters are per frame and summed over views; the same values are written to the GaussianSplatting CSV category.
+ */
+DECLARE_STATS_GROUP(TEXT("GaussianSplatting"), STATGROUP_GaussianSplatting, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Add Compute Passes"), STAT_GaussianSplatAddComputePasses, STATGROUP_GaussianSplatting, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Render"), STAT_GaussianSplatRender, STATGROUP_GaussianSplatting, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Views"), STAT_GaussianSplatViews, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Submitted Splats"), STAT_GaussianSplatSubmittedSplats, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visible Splats"), STAT_GaussianSplatVisibleSplats, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Culled Splats"), STAT_GaussianSplatCulledSplats, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Full Sorts"), STAT_GaussianSplatSortFull, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Reused Sorts"), STAT_GaussianSplatSortReused, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Sorts (Camera Static)"), STAT_GaussianSplatSortSkipped, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shared Sorts (Stereo)"), STAT_GaussianSplatSortShared, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Dropped Tile Raster Entries"), STAT_GaussianSplatTileRasterDroppedEntries, STATGROUP_GaussianSplatting, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Downgraded Proxies (Budget)"), STAT_GaussianSplatBudgetDowngraded, STATGROUP_GaussianSplatting, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Evicted Proxies (Budget)"), STAT_GaussianSplatBudgetEvicted, STATGROUP_GaussianSplatting, );
+
+/** GPU memory per buffer class: shared splat buffers of each asset, per-view buffers, and the transient sort buffers of the frame */
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Static Buffer Memory"), STAT_GaussianSplatStaticBufferMemory, STATGROUP_GaussianSplatting, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("View Buffer Memory"), STAT_GaussianSplatViewBufferMemory, STATGROUP_GaussianSplatting, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Sort Scratch Memory"), STAT_GaussianSplatSortScratchMemory, STATGROUP_GaussianSplatting, );
+
+DECLARE_GPU_STAT_NAMED_EXTERN(GaussianSplatViewData, TEXT("Gaussian Splat View Data"));
+DECLARE_GPU_STAT_NAMED_EXTERN(GaussianSplatSort, TEXT("Gaussian Splat Sort"));
+DECLARE_GPU_STAT_NAMED_EXTERN(GaussianSplatTileSort, TEXT("Gaussian Splat Tile Sort"));
+DECLARE_GPU_STAT_NAMED_EXTERN(GaussianSplatDraw, TEXT("Gaussian Splat Draw"));
+
+CSV_DECLARE_CATEGORY_EXTERN(GaussianSplatting);
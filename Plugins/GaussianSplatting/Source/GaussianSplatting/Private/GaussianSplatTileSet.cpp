@@ -0,0 +1,14 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GaussianSplatTileSet.h"
+#include "GaussianSplatAsset.h"
+
+int64 UGaussianSplatTileSet::GetMemoryUsage() const
+{
+	int64 Total = 0;
+	for (const FGaussianSplatTile& Tile : Tiles)
+	{
+		Total += Tile.MemoryBytes;
+	}
+	return Total;
+}
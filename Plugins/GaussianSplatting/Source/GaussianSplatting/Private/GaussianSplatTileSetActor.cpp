@@ -0,0 +1,10 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GaussianSplatTileSetActor.h"
+#include "GaussianSplatTileSetComponent.h"
+
+AGaussianSplatTileSetActor::AGaussianSplatTileSetActor()
+{
+	TileSetComponent = CreateDefaultSubobject<UGaussianSplatTileSetComponent>(TEXT("TileSetComponent"));
+	RootComponent = TileSetComponent;
+}
@@ -0,0 +1,273 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GaussianSplatTileSetComponent.h"
+#include "GaussianSplatTileSet.h"
+#include "GaussianSplatAsset.h"
+#include "GaussianSplatComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatTileStreamingMaxLoads(
+	TEXT("gs.TileStreamingMaxLoads"),
+	4,
+	TEXT("Tile packages per tile set component that may load at once, nearest tiles first."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGaussianSplatTileStreamingHysteresis(
+	TEXT("gs.TileStreamingHysteresis"),
+	0.1f,
+	TEXT("Fraction by which resident tiles count as nearer than they are when tiles are ranked,\n")
+	TEXT("so tiles at the streaming distance or the edge of the budget don't load and release on alternate frames."),
+	ECVF_Default);
+
+UGaussianSplatTileSetComponent::UGaussianSplatTileSetComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Streaming follows the cameras in editor viewports too
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	bTickInEditor = true;
+
+	Mobility = EComponentMobility::Movable;
+}
+
+#if WITH_EDITOR
+void UGaussianSplatTileSetComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
+
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatTileSetComponent, TileSet))
+	{
+		ReleaseAllTiles();
+		UpdateBounds();
+	}
+	else if (PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatTileSetComponent, SHOrder) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatTileSetComponent, OpacityScale) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatTileSetComponent, SplatScale) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatTileSetComponent, MaxSplatsPerView) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(UGaussianSplatTileSetComponent, bCastShadow))
+	{
+		for (UGaussianSplatComponent* Component : TileComponents)
+		{
+			if (Component)
+			{
+				ApplyTileSettings(Component);
+				Component->MarkRenderDynamicDataDirty();
+			}
+		}
+	}
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UGaussianSplatTileSetComponent::OnUnregister()
+{
+	ReleaseAllTiles();
+	Super::OnUnregister();
+}
+
+void UGaussianSplatTileSetComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	UpdateStreaming();
+}
+
+FBoxSphereBounds UGaussianSplatTileSetComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+	if (TileSet && TileSet->GetBounds().IsValid)
+	{
+		return FBoxSphereBounds(TileSet->GetBounds().TransformBy(LocalToWorld));
+	}
+	return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector(100.0f), 100.0f);
+}
+
+void UGaussianSplatTileSetComponent::SetTileSet(UGaussianSplatTileSet* NewTileSet)
+{
+	if (TileSet != NewTileSet)
+	{
+		ReleaseAllTiles();
+		TileSet = NewTileSet;
+		UpdateBounds();
+	}
+}
+
+int32 UGaussianSplatTileSetComponent::GetNumResidentTiles() const
+{
+	int32 NumResident = 0;
+	for (const UGaussianSplatComponent* Component : TileComponents)
+	{
+		NumResident += Component ? 1 : 0;
+	}
+	return NumResident;
+}
+
+int64 UGaussianSplatTileSetComponent::GetResidentMemoryBytes() const
+{
+	int64 Total = 0;
+	for (int32 TileIndex = 0; TileSet && TileIndex < TileComponents.Num(); TileIndex++)
+	{
+		if (TileComponents[TileIndex] && TileSet->Tiles.IsValidIndex(TileIndex))
+		{
+			Total += TileSet->Tiles[TileIndex].MemoryBytes;
+		}
+	}
+	return Total;
+}
+
+void UGaussianSplatTileSetComponent::UpdateStreaming()
+{
+	UWorld* World = GetWorld();
+	if (!TileSet || !World || !GetOwner())
+	{
+		return;
+	}
+
+	// Views of the last frame, nothing changes until the world was rendered
+	const TArray<FVector>& ViewLocations = World->ViewLocationsRenderedLastFrame;
+	if (ViewLocations.Num() == 0)
+	{
+		return;
+	}
+
+	const TArray<FGaussianSplatTile>& Tiles = TileSet->Tiles;
+	TileComponents.SetNum(Tiles.Num());
+	LoadedTileAssets.SetNum(Tiles.Num());
+
+	// Distance from the nearest camera to each tile's bounds, resident tiles count as slightly nearer
+	const float Hysteresis = 1.0f + FMath::Max(0.0f, CVarGaussianSplatTileStreamingHysteresis.GetValueOnGameThread());
+	const FTransform& ComponentTransform = GetComponentTransform();
+	struct FRankedTile
+	{
+		int32 TileIndex = 0;
+		double Distance = 0.0;
+	};
+	TArray<FRankedTile> Ranked;
+	Ranked.Reserve(Tiles.Num());
+	for (int32 TileIndex = 0; TileIndex < Tiles.Num(); TileIndex++)
+	{
+		const FBox WorldBounds = Tiles[TileIndex].Bounds.TransformBy(ComponentTransform);
+		double MinDistanceSquared = UE_DOUBLE_BIG_NUMBER;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, WorldBounds.ComputeSquaredDistanceToPoint(ViewLocation));
+		}
+		const bool bResident = TileComponents[TileIndex] != nullptr || LoadedTileAssets[TileIndex] != nullptr || PendingLoads.Contains(TileIndex);
+		Ranked.Add({ TileIndex, FMath::Sqrt(MinDistanceSquared) / (bResident ? Hysteresis : 1.0f) });
+	}
+	Ranked.Sort([](const FRankedTile& A, const FRankedTile& B) { return A.Distance < B.Distance; });
+
+	// Nearest first until the distance or the budget runs out, so residency stays bounded
+	const int64 BudgetBytes = (int64)StreamingBudgetMB * 1024 * 1024;
+	int64 UsedBytes = 0;
+	TBitArray<> Wanted(false, Tiles.Num());
+	for (const FRankedTile& Tile : Ranked)
+	{
+		if (StreamingDistance > 0.0f && Tile.Distance > StreamingDistance)
+		{
+			break;
+		}
+		if (BudgetBytes > 0 && UsedBytes + Tiles[Tile.TileIndex].MemoryBytes > BudgetBytes)
+		{
+			break;
+		}
+		UsedBytes += Tiles[Tile.TileIndex].MemoryBytes;
+		Wanted[Tile.TileIndex] = true;
+	}
+
+	// Release before loading, the budget holds while tiles swap
+	for (int32 TileIndex = 0; TileIndex < Tiles.Num(); TileIndex++)
+	{
+		if (!Wanted[TileIndex])
+		{
+			ReleaseTile(TileIndex);
+			LoadedTileAssets[TileIndex] = nullptr;
+		}
+	}
+
+	const int32 MaxLoads = FMath::Max(1, CVarGaussianSplatTileStreamingMaxLoads.GetValueOnGameThread());
+	for (const FRankedTile& Ranking : Ranked)
+	{
+		const int32 TileIndex = Ranking.TileIndex;
+		if (!Wanted[TileIndex] || TileComponents[TileIndex] || PendingLoads.Contains(TileIndex))
+		{
+			continue;
+		}
+
+		const FGaussianSplatTile& Tile = Tiles[TileIndex];
+		if (UGaussianSplatAsset* Asset = LoadedTileAssets[TileIndex] ? LoadedTileAssets[TileIndex].Get() : Tile.Asset.Get())
+		{
+			AddTileComponent(TileIndex, Asset);
+			continue;
+		}
+		if (Tile.Asset.IsNull() || PendingLoads.Num() >= MaxLoads)
+		{
+			continue;
+		}
+
+		// The loaded asset is held until the next update attaches the tile, or drops it if the tile is no longer wanted
+		const FSoftObjectPath AssetPath = Tile.Asset.ToSoftObjectPath();
+		PendingLoads.Add(TileIndex);
+		LoadPackageAsync(AssetPath.GetLongPackageName(), FLoadPackageAsyncDelegate::CreateWeakLambda(this,
+			[this, TileIndex, AssetPath](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+			{
+				PendingLoads.Remove(TileIndex);
+				if (Result != EAsyncLoadingResult::Succeeded)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("GaussianSplat: failed to load tile %s"), *PackageName.ToString());
+					return;
+				}
+
+				// The tile set may have changed while the load was in flight
+				if (TileSet && TileSet->Tiles.IsValidIndex(TileIndex) && LoadedTileAssets.IsValidIndex(TileIndex)
+					&& TileSet->Tiles[TileIndex].Asset.ToSoftObjectPath() == AssetPath)
+				{
+					LoadedTileAssets[TileIndex] = Cast<UGaussianSplatAsset>(AssetPath.ResolveObject());
+				}
+			}));
+	}
+}
+
+void UGaussianSplatTileSetComponent::AddTileComponent(int32 TileIndex, UGaussianSplatAsset* Asset)
+{
+	UGaussianSplatComponent* Component = NewObject<UGaussianSplatComponent>(GetOwner(), NAME_None, RF_Transient | RF_TextExportTransient);
+	Component->SetupAttachment(this);
+	Component->SetSplatAsset(Asset);
+	ApplyTileSettings(Component);
+	Component->RegisterComponent();
+	TileComponents[TileIndex] = Component;
+	LoadedTileAssets[TileIndex] = nullptr;
+}
+
+void UGaussianSplatTileSetComponent::ReleaseTile(int32 TileIndex)
+{
+	if (UGaussianSplatComponent* Component = TileComponents[TileIndex])
+	{
+		Component->DestroyComponent();
+		TileComponents[TileIndex] = nullptr;
+	}
+}
+
+void UGaussianSplatTileSetComponent::ReleaseAllTiles()
+{
+	for (int32 TileIndex = 0; TileIndex < TileComponents.Num(); TileIndex++)
+	{
+		ReleaseTile(TileIndex);
+	}
+	TileComponents.Reset();
+	LoadedTileAssets.Reset();
+
+	// Loads in flight complete on their own, their tiles are attached only if the next tile set wants them
+	PendingLoads.Reset();
+}
+
+void UGaussianSplatTileSetComponent::ApplyTileSettings(UGaussianSplatComponent* Component) const
+{
+	Component->SHOrder = SHOrder;
+	Component->OpacityScale = OpacityScale;
+	Component->SplatScale = SplatScale;
+	Component->MaxSplatsPerView = MaxSplatsPerView;
+	Component->SetCastShadow(bCastShadow);
+}
@@ -2,12 +2,49 @@
 
 #include "GaussianSplatViewExtension.h"
 #include "GaussianSplatSceneProxy.h"
+#include "GaussianSplatRenderer.h"
+#include "GaussianSplatAsset.h"
+#include "GaussianSplatStats.h"
 #include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGaussianSplatGPUMemoryBudgetMB(
+	TEXT("gs.GPUMemoryBudgetMB"),
+	0,
+	TEXT("GPU memory the splat buffers of all splat actors may take together, nearest actors first.\n")
+	TEXT("Actors beyond it render their coarsest LOD level when their upload is shared with a nearer actor, and release their upload otherwise.\n")
+	TEXT("0 = no budget (default)"),
+	ECVF_RenderThreadSafe);
+
+static FAutoConsoleCommandWithOutputDevice GaussianSplatListResourcesCommand(
+	TEXT("gs.ListResources"),
+	TEXT("List the GPU memory of every splat upload and splat actor by buffer class (static, view, sort scratch)."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		// The resources are owned by the render thread, describe them there and print here so memreport captures the lines
+		TArray<FString> Lines;
+		ENQUEUE_RENDER_COMMAND(GaussianSplatListResources)(
+			[&Lines](FRHICommandListImmediate& RHICmdList)
+			{
+				if (const FGaussianSplatViewExtension* ViewExtension = FGaussianSplatViewExtension::Get())
+				{
+					ViewExtension->DescribeResources(Lines);
+				}
+			});
+		FlushRenderingCommands();
+
+		for (const FString& Line : Lines)
+		{
+			Ar.Log(Line);
+		}
+	}));
 
 FGaussianSplatViewExtension* FGaussianSplatViewExtension::Instance = nullptr;
 
 FGaussianSplatViewExtension::FGaussianSplatViewExtension(const FAutoRegister& AutoRegister)
 	: FSceneViewExtensionBase(AutoRegister)
+	, BatchViewResources(MakeUnique<FGaussianSplatViewResourceCache>())
 {
 	Instance = this;
 }
@@ -18,6 +55,25 @@ FGaussianSplatViewExtension::~FGaussianSplatViewExtension()
 	{
 		Instance = nullptr;
 	}
+
+	// Pooled buffers must be released on the render thread
+	if (BatchViewResources.IsValid())
+	{
+		ENQUEUE_RENDER_COMMAND(ReleaseGaussianSplatBatchResources)(
+			[Cache = MoveTemp(BatchViewResources)](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				Cache->Empty();
+				Cache.Reset();
+			});
+	}
+	if (OcclusionHZBs.Num() > 0)
+	{
+		ENQUEUE_RENDER_COMMAND(ReleaseGaussianSplatOcclusionHZBs)(
+			[HZBs = MoveTemp(OcclusionHZBs)](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				HZBs.Empty();
+			});
+	}
 }
 
 FGaussianSplatViewExtension* FGaussianSplatViewExtension::Get()
@@ -25,16 +81,66 @@ FGaussianSplatViewExtension* FGaussianSplatViewExtension::Get()
 	return Instance;
 }
 
-void FGaussianSplatViewExtension::GetRegisteredProxies(TArray<FGaussianSplatSceneProxy*>& OutProxies) const
+TConstArrayView<FGaussianSplatSceneProxy*> FGaussianSplatViewExtension::GetRegisteredProxies() const
+{
+	check(IsInRenderingThread());
+	return RegisteredProxies;
+}
+
+FGaussianSplatViewResources* FGaussianSplatViewExtension::FindOrAddBatchViewResources(const FSceneView& View)
+{
+	check(IsInRenderingThread());
+	return BatchViewResources.IsValid() ? BatchViewResources->FindOrAdd(View) : nullptr;
+}
+
+FGaussianSplatOcclusionHZB& FGaussianSplatViewExtension::FindOrAddOcclusionHZB(const FSceneView& View)
+{
+	check(IsInRenderingThread());
+	return OcclusionHZBs.FindOrAdd(View.GetViewKey());
+}
+
+const FGaussianSplatOcclusionHZB* FGaussianSplatViewExtension::FindOcclusionHZB(const FSceneView& View) const
+{
+	check(IsInRenderingThread());
+	const FGaussianSplatOcclusionHZB* HZB = OcclusionHZBs.Find(View.GetViewKey());
+	const uint32 FrameNumber = View.Family ? View.Family->FrameNumber : 0;
+	return HZB && HZB->Texture.IsValid() && FrameNumber - HZB->FrameNumber <= 1 && HZB->GPUMask == View.GPUMask ? HZB : nullptr;
+}
+
+void FGaussianSplatViewExtension::DescribeResources(TArray<FString>& OutLines) const
 {
-	FScopeLock Lock(&ProxyLock);
-	OutProxies = RegisteredProxies;
+	check(IsInRenderingThread());
+
+	OutLines.Add(TEXT("Gaussian splat static buffers:"));
+	FGaussianSplatGPUResourceCache::DescribeEntries(OutLines);
+
+	OutLines.Add(TEXT("Gaussian splat view buffers:"));
+	int64 ViewBytes = 0;
+	for (const FGaussianSplatSceneProxy* Proxy : RegisteredProxies)
+	{
+		const int64 Bytes = Proxy->GetViewGPUMemoryBytes();
+		ViewBytes += Bytes;
+		OutLines.Add(FString::Printf(TEXT("%10.2f MB  %s%s"), Bytes / (1024.0 * 1024.0),
+			Proxy->GetAsset() ? *Proxy->GetAsset()->GetPathName() : TEXT("None"),
+			Proxy->IsEvicted() ? TEXT(" (evicted)") : (Proxy->IsBudgetDowngraded() ? TEXT(" (downgraded)") : TEXT(""))));
+	}
+	const int64 BatchBytes = BatchViewResources.IsValid() ? BatchViewResources->GetGPUMemoryBytes() : 0;
+	OutLines.Add(FString::Printf(TEXT("%10.2f MB  batched views"), BatchBytes / (1024.0 * 1024.0)));
+	OutLines.Add(FString::Printf(TEXT("%10.2f MB  view buffers of %d proxies"), (ViewBytes + BatchBytes) / (1024.0 * 1024.0), RegisteredProxies.Num()));
+
+	OutLines.Add(FString::Printf(TEXT("Gaussian splat sort scratch: %.2f MB requested by the last frame that sorted, from the RDG transient pool"),
+		FGaussianSplatRenderer::GetSortScratchBytes() / (1024.0 * 1024.0)));
+
+	const int32 BudgetMB = CVarGaussianSplatGPUMemoryBudgetMB.GetValueOnRenderThread();
+	if (BudgetMB > 0)
+	{
+		OutLines.Add(FString::Printf(TEXT("Gaussian splat GPU memory budget: %d MB"), BudgetMB));
+	}
 }
 
 bool FGaussianSplatViewExtension::IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const
 {
-	FScopeLock Lock(&ProxyLock);
-	return RegisteredProxies.Num() > 0;
+	return NumRegisteredProxies.load(std::memory_order_relaxed) > 0;
 }
 
 void FGaussianSplatViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
@@ -47,28 +153,231 @@ void FGaussianSplatViewExtension::BeginRenderViewFamily(FSceneViewFamily& InView
 
 void FGaussianSplatViewExtension::RegisterProxy(FGaussianSplatSceneProxy* Proxy)
 {
+	check(IsInRenderingThread());
 	if (Proxy)
 	{
-		FScopeLock Lock(&ProxyLock);
 		RegisteredProxies.AddUnique(Proxy);
+		NumRegisteredProxies.store(RegisteredProxies.Num(), std::memory_order_relaxed);
 	}
 }
 
 void FGaussianSplatViewExtension::UnregisterProxy(FGaussianSplatSceneProxy* Proxy)
 {
+	check(IsInRenderingThread());
 	if (Proxy)
 	{
-		FScopeLock Lock(&ProxyLock);
 		RegisteredProxies.Remove(Proxy);
+		PendingColorTextureProxies.RemoveSwap(Proxy);
+		NumRegisteredProxies.store(RegisteredProxies.Num(), std::memory_order_relaxed);
+	}
+}
+
+void FGaussianSplatViewExtension::RequestColorTextureInit(FGaussianSplatSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+	if (Proxy)
+	{
+		PendingColorTextureProxies.AddUnique(Proxy);
+	}
+}
+
+void FGaussianSplatViewExtension::InitializePendingColorTextures(FRHICommandListBase& RHICmdList)
+{
+	for (int32 Index = PendingColorTextureProxies.Num() - 1; Index >= 0; Index--)
+	{
+		if (PendingColorTextureProxies[Index]->TryInitializeColorTexture(RHICmdList))
+		{
+			PendingColorTextureProxies.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
 	}
 }
 
 void FGaussianSplatViewExtension::PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView)
 {
+	// Queue view data and sort passes early so they can overlap the base pass on async compute.
+	// The post-opaque draw consumes the results, RDG handles the cross-pipe synchronization.
+	const TConstArrayView<FGaussianSplatSceneProxy*> Proxies = RegisteredProxies;
+
+	if (Proxies.Num() == 0)
+	{
+		return;
+	}
+
+	const ERDGPassFlags ComputePassFlags = FGaussianSplatRenderer::GetComputePassFlags();
+
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatPreRenderView");
+	RDG_GPU_MASK_SCOPE(GraphBuilder, InView.GPUMask);
+
+	// A secondary stereo eye reuses the sort its primary eye set up earlier this frame
+	const FSceneView* StereoPrimaryView = FGaussianSplatRenderer::GetStereoPrimaryView(InView);
+
+	if (FGaussianSplatRenderer::IsBatchingEnabled())
+	{
+		TArray<FGaussianSplatBatchItem> Items;
+		FGaussianSplatRenderer::GatherBatchItems(InView, Proxies, Items);
+		if (Items.Num() > 0)
+		{
+			FGaussianSplatRenderer::AddBatchedComputePasses(GraphBuilder, InView, FindOrAddBatchViewResources(InView),
+				StereoPrimaryView ? FindOrAddBatchViewResources(*StereoPrimaryView) : nullptr, Items, ComputePassFlags);
+		}
+		return;
+	}
+
+	for (FGaussianSplatSceneProxy* Proxy : Proxies)
+	{
+		if (!Proxy->IsRenderableInView(InView))
+		{
+			continue;
+		}
+
+		int32 SplatOffset = 0;
+		int32 SplatCount = 0;
+		Proxy->SelectLOD(InView, SplatOffset, SplatCount);
+
+		FGaussianSplatRenderer::AddComputePasses(
+			GraphBuilder,
+			InView,
+			Proxy->GetGPUResources(),
+			Proxy->FindOrAddViewResources(InView),
+			StereoPrimaryView ? Proxy->FindOrAddViewResources(*StereoPrimaryView) : nullptr,
+			Proxy->GetLocalToWorld(),
+			Proxy->GetBounds(),
+			SplatOffset,
+			SplatCount,
+			Proxy->GetSHOrder(),
+			Proxy->GetOpacityScale(),
+			Proxy->GetSplatScale(),
+			ComputePassFlags
+		);
+	}
+}
+
+void FGaussianSplatViewExtension::EnforceMemoryBudget(FRHICommandListBase& RHICmdList, const FSceneViewFamily& ViewFamily)
+{
+	// Ranked against the first view family of the frame, so families of one frame can't undo each other
+	if (LastMemoryBudgetFrame == GFrameCounterRenderThread || ViewFamily.Views.Num() == 0)
+	{
+		return;
+	}
+	LastMemoryBudgetFrame = GFrameCounterRenderThread;
+
+	const int64 BudgetBytes = (int64)CVarGaussianSplatGPUMemoryBudgetMB.GetValueOnRenderThread() * 1024 * 1024;
+	if (BudgetBytes <= 0)
+	{
+		for (FGaussianSplatSceneProxy* Proxy : RegisteredProxies)
+		{
+			Proxy->RestoreGPUResources_RenderThread(RHICmdList);
+			Proxy->SetBudgetDowngraded_RenderThread(false);
+		}
+		return;
+	}
+
+	// Distance from each proxy's bounds to the nearest view
+	struct FRankedProxy
+	{
+		FGaussianSplatSceneProxy* Proxy = nullptr;
+		double DistanceSquared = 0.0;
+	};
+	TArray<FRankedProxy> Ranked;
+	Ranked.Reserve(RegisteredProxies.Num());
+	for (FGaussianSplatSceneProxy* Proxy : RegisteredProxies)
+	{
+		const FBox Box = Proxy->GetBounds().GetBox();
+		double MinDistanceSquared = UE_DOUBLE_BIG_NUMBER;
+		for (const FSceneView* View : ViewFamily.Views)
+		{
+			MinDistanceSquared = FMath::Min(MinDistanceSquared, Box.ComputeSquaredDistanceToPoint(View->ViewMatrices.GetViewOrigin()));
+		}
+		Ranked.Add({ Proxy, MinDistanceSquared });
+	}
+	Ranked.Sort([](const FRankedProxy& A, const FRankedProxy& B) { return A.DistanceSquared < B.DistanceSquared; });
+
+	// The batched view buffers serve every proxy, they come off the budget first
+	int64 UsedBytes = BatchViewResources.IsValid() ? BatchViewResources->GetGPUMemoryBytes() : 0;
+	TSet<const FGaussianSplatGPUResources*> CountedResources;
+	bool bStateChanged = false;
+	for (int32 RankIndex = 0; RankIndex < Ranked.Num(); RankIndex++)
+	{
+		FGaussianSplatSceneProxy* Proxy = Ranked[RankIndex].Proxy;
+		const bool bWasEvicted = Proxy->IsEvicted();
+		const bool bWasDowngraded = Proxy->IsBudgetDowngraded();
+
+		// An upload a nearer proxy renders is paid for already, an evicted one costs what it held
+		const FGaussianSplatGPUResources* Resources = Proxy->IsEvicted()
+			? FGaussianSplatGPUResourceCache::Find(Proxy->GetAsset(), Proxy->GetSHOrder())
+			: Proxy->GetGPUResources();
+		const int64 StaticBytes = !Resources ? Proxy->GetEvictedGPUMemoryBytes() : (CountedResources.Contains(Resources) ? 0 : Resources->GetGPUMemoryBytes());
+
+		// The nearest proxy always renders in full
+		if (RankIndex == 0 || UsedBytes + StaticBytes + Proxy->GetFullDetailViewGPUMemoryBytes() <= BudgetBytes)
+		{
+			Proxy->RestoreGPUResources_RenderThread(RHICmdList);
+			Proxy->SetBudgetDowngraded_RenderThread(false);
+			UsedBytes += StaticBytes + Proxy->GetFullDetailViewGPUMemoryBytes();
+		}
+		// Releasing a shared upload frees nothing, and dynamic splats would lose their updates, so those only shrink their view buffers
+		else if (StaticBytes == 0 || Proxy->AllowsDynamicUpdates())
+		{
+			Proxy->RestoreGPUResources_RenderThread(RHICmdList);
+			Proxy->SetBudgetDowngraded_RenderThread(true);
+			UsedBytes += StaticBytes + Proxy->GetViewGPUMemoryBytes();
+			INC_DWORD_STAT(STAT_GaussianSplatBudgetDowngraded);
+		}
+		else
+		{
+			Proxy->EvictGPUResources_RenderThread();
+			INC_DWORD_STAT(STAT_GaussianSplatBudgetEvicted);
+		}
+
+		if (const FGaussianSplatGPUResources* KeptResources = Proxy->GetGPUResources())
+		{
+			CountedResources.Add(KeptResources);
+		}
+		bStateChanged |= bWasEvicted != Proxy->IsEvicted() || bWasDowngraded != Proxy->IsBudgetDowngraded();
+	}
+
+	// Batched buffers are only reallocated when they grow, recreate them at the size of what still renders
+	if (bStateChanged && BatchViewResources.IsValid())
+	{
+		BatchViewResources->Empty();
+	}
 }
 
 void FGaussianSplatViewExtension::PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
 {
+	EnforceMemoryBudget(GraphBuilder.RHICmdList, InViewFamily);
+	InitializePendingColorTextures(GraphBuilder.RHICmdList);
+
+	// Streaming uploads only go to the GPUs this family's views render on
+	TOptional<FRHIGPUMask> FamilyGPUMask;
+	for (const FSceneView* View : InViewFamily.Views)
+	{
+		FamilyGPUMask = FamilyGPUMask.IsSet() ? (*FamilyGPUMask | View->GPUMask) : View->GPUMask;
+	}
+
+	// Upload the splat pages that finished streaming before any view selects its LOD,
+	// and bring dynamic splats up to date before any view data is computed from them
+	for (FGaussianSplatSceneProxy* Proxy : RegisteredProxies)
+	{
+		if (FGaussianSplatGPUResources* GPUResources = Proxy->GetGPUResources())
+		{
+			if (FamilyGPUMask.IsSet())
+			{
+				GPUResources->AddViewGPUs(*FamilyGPUMask);
+			}
+			GPUResources->UpdateStreaming(GraphBuilder.RHICmdList);
+			GPUResources->UpdateDynamicSplats(GraphBuilder, InViewFamily.Time.GetWorldTimeSeconds());
+		}
+	}
+
+	// HZBs of views that stopped rendering are too old to cull against, free them
+	for (auto It = OcclusionHZBs.CreateIterator(); It; ++It)
+	{
+		if (InViewFamily.FrameNumber - It.Value().FrameNumber > 1)
+		{
+			It.RemoveCurrent();
+		}
+	}
 }
 
 void FGaussianSplatViewExtension::PostRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
@@ -4,6 +4,7 @@
 #include "GaussianSplatViewExtension.h"
 #include "GaussianSplatRenderer.h"
 #include "GaussianSplatSceneProxy.h"
+#include "GaussianSplatStats.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
 #include "ShaderCore.h"
@@ -17,6 +18,30 @@
 
 #define LOCTEXT_NAMESPACE "FGaussianSplattingModule"
 
+DEFINE_STAT(STAT_GaussianSplatAddComputePasses);
+DEFINE_STAT(STAT_GaussianSplatRender);
+DEFINE_STAT(STAT_GaussianSplatViews);
+DEFINE_STAT(STAT_GaussianSplatSubmittedSplats);
+DEFINE_STAT(STAT_GaussianSplatVisibleSplats);
+DEFINE_STAT(STAT_GaussianSplatCulledSplats);
+DEFINE_STAT(STAT_GaussianSplatSortFull);
+DEFINE_STAT(STAT_GaussianSplatSortReused);
+DEFINE_STAT(STAT_GaussianSplatSortSkipped);
+DEFINE_STAT(STAT_GaussianSplatSortShared);
+DEFINE_STAT(STAT_GaussianSplatTileRasterDroppedEntries);
+DEFINE_STAT(STAT_GaussianSplatBudgetDowngraded);
+DEFINE_STAT(STAT_GaussianSplatBudgetEvicted);
+DEFINE_STAT(STAT_GaussianSplatStaticBufferMemory);
+DEFINE_STAT(STAT_GaussianSplatViewBufferMemory);
+DEFINE_STAT(STAT_GaussianSplatSortScratchMemory);
+
+DEFINE_GPU_STAT(GaussianSplatViewData);
+DEFINE_GPU_STAT(GaussianSplatSort);
+DEFINE_GPU_STAT(GaussianSplatTileSort);
+DEFINE_GPU_STAT(GaussianSplatDraw);
+
+CSV_DEFINE_CATEGORY(GaussianSplatting, true);
+
 // Helper to get the renderer module
 static IRendererModule& GetRendererModuleRef()
 {
@@ -62,16 +87,15 @@ void FGaussianSplattingModule::OnPostOpaqueRender_RenderThread(FPostOpaqueRender
 	FRDGBuilder& GraphBuilder = *Parameters.GraphBuilder;
 	const FViewInfo& View = *Parameters.View;
 
-	// Get registered proxies
-	TArray<FGaussianSplatSceneProxy*> Proxies;
-	Ext->GetRegisteredProxies(Proxies);
+	// Registered proxies, read in place on the render thread
+	const TConstArrayView<FGaussianSplatSceneProxy*> Proxies = Ext->GetRegisteredProxies();
 
 	if (Proxies.Num() == 0)
 	{
 		return;
 	}
 
-	// Store view pointer for lambda capture (FViewInfo inherits from FSceneView)
+	// FViewInfo inherits from FSceneView
 	const FSceneView* SceneView = reinterpret_cast<const FSceneView*>(Parameters.View);
 
 	// Get the color texture from parameters - we need to render to this
@@ -83,12 +107,12 @@ void FGaussianSplattingModule::OnPostOpaqueRender_RenderThread(FPostOpaqueRender
 		return;
 	}
 
-	// Create render pass parameters with the scene color as render target
-	FRenderTargetParameters* PassParameters = GraphBuilder.AllocParameters<FRenderTargetParameters>();
-	PassParameters->RenderTargets[0] = FRenderTargetBinding(ColorTexture, ERenderTargetLoadAction::ELoad);
+	// Scene color as render target, depth bound read-only for the depth test
+	FRenderTargetBindingSlots RenderTargets;
+	RenderTargets[0] = FRenderTargetBinding(ColorTexture, ERenderTargetLoadAction::ELoad);
 	if (DepthTexture)
 	{
-		PassParameters->RenderTargets.DepthStencil = FDepthStencilBinding(
+		RenderTargets.DepthStencil = FDepthStencilBinding(
 			DepthTexture,
 			ERenderTargetLoadAction::ELoad,
 			ERenderTargetLoadAction::ELoad,
@@ -96,68 +120,63 @@ void FGaussianSplattingModule::OnPostOpaqueRender_RenderThread(FPostOpaqueRender
 		);
 	}
 
-	// Add a render pass for Gaussian splats with proper render target binding
-	GraphBuilder.AddPass(
-		RDG_EVENT_NAME("GaussianSplatRendering"),
-		PassParameters,
-		ERDGPassFlags::Raster,
-		[SceneView, Proxies](FRHICommandListImmediate& RHICmdList)
+	RDG_EVENT_SCOPE(GraphBuilder, "GaussianSplatRendering");
+	RDG_GPU_MASK_SCOPE(GraphBuilder, SceneView->GPUMask);
+	INC_DWORD_STAT(STAT_GaussianSplatViews);
+	CSV_CUSTOM_STAT(GaussianSplatting, Views, 1, ECsvCustomStatOp::Accumulate);
+
+	// Occlusion HZB for the next frame's culling, from the opaque depth before any splat depth is written
+	if (DepthTexture && FGaussianSplatRenderer::UseOcclusionCulling(*SceneView))
+	{
+		FGaussianSplatRenderer::BuildOcclusionHZB(GraphBuilder, *SceneView, DepthTexture, Ext->FindOrAddOcclusionHZB(*SceneView));
+	}
+
+	// A secondary stereo eye draws in the primary eye's sort order when both share it
+	const FSceneView* StereoPrimaryView = FGaussianSplatRenderer::GetStereoPrimaryView(*SceneView);
+
+	// Batched: one shared sort and one draw for every visible proxy
+	if (FGaussianSplatRenderer::IsBatchingEnabled())
+	{
+		TArray<FGaussianSplatBatchItem> Items;
+		FGaussianSplatRenderer::GatherBatchItems(*SceneView, Proxies, Items);
+		if (Items.Num() > 0)
+		{
+			FGaussianSplatRenderer::RenderBatched(GraphBuilder, *SceneView, Ext->FindOrAddBatchViewResources(*SceneView),
+				StereoPrimaryView ? Ext->FindOrAddBatchViewResources(*StereoPrimaryView) : nullptr, Items, RenderTargets);
+		}
+		return;
+	}
+
+	// One raster pass per proxy; RDG merges consecutive passes on the same targets into one render pass
+	for (FGaussianSplatSceneProxy* Proxy : Proxies)
+	{
+		if (!Proxy->IsRenderableInView(*SceneView))
 		{
-			if (!SceneView)
-			{
-				return;
-			}
-
-			SCOPED_DRAW_EVENT(RHICmdList, GaussianSplatRendering);
-
-			for (FGaussianSplatSceneProxy* Proxy : Proxies)
-			{
-				if (!Proxy)
-				{
-					continue;
-				}
-
-				// Check if proxy is shown in this view (respects visibility flags)
-				if (!Proxy->IsShown(SceneView))
-				{
-					continue;
-				}
-
-				// Try to initialize color texture SRV if not already done (deferred init)
-				Proxy->TryInitializeColorTexture(RHICmdList);
-
-				FGaussianSplatGPUResources* GPUResources = Proxy->GetGPUResources();
-
-				// Require full validation
-				if (!GPUResources || !GPUResources->IsValid())
-				{
-					continue;
-				}
-
-				// Check visibility - frustum culling
-				const FBoxSphereBounds& Bounds = Proxy->GetBounds();
-				if (!SceneView->ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent))
-				{
-					continue;
-				}
-
-				// Get transform
-				FMatrix LocalToWorld = Proxy->GetLocalToWorld();
-
-				// Render this proxy
-				FGaussianSplatRenderer::Render(
-					RHICmdList,
-					*SceneView,
-					GPUResources,
-					LocalToWorld,
-					Proxy->GetSplatCount(),
-					Proxy->GetSHOrder(),
-					Proxy->GetOpacityScale(),
-					Proxy->GetSplatScale()
-				);
-			}
+			continue;
 		}
-	);
+
+		// Same LOD as PreRenderView picked for this view
+		int32 SplatOffset = 0;
+		int32 SplatCount = 0;
+		Proxy->SelectLOD(*SceneView, SplatOffset, SplatCount);
+
+		// Render this proxy (compute was queued in PreRenderView unless this view skipped it)
+		FGaussianSplatRenderer::Render(
+			GraphBuilder,
+			*SceneView,
+			Proxy->GetGPUResources(),
+			Proxy->FindOrAddViewResources(*SceneView),
+			StereoPrimaryView ? Proxy->FindOrAddViewResources(*StereoPrimaryView) : nullptr,
+			Proxy->GetLocalToWorld(),
+			Proxy->GetBounds(),
+			SplatOffset,
+			SplatCount,
+			Proxy->GetSHOrder(),
+			Proxy->GetOpacityScale(),
+			Proxy->GetSplatScale(),
+			RenderTargets
+		);
+	}
 }
 
 void FGaussianSplattingModule::ShutdownModule()
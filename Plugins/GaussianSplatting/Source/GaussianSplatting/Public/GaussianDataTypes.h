@@ -98,15 +98,18 @@ struct FGaussianSplatData
 /**
  * Per-frame view data computed by compute shader, used by vertex shader
  * This structure must match the HLSL definition in GaussianDataTypes.ush
- * Total: 32 bytes per splat
+ * Total: 24 bytes per splat
  */
 USTRUCT()
 struct FGaussianSplatViewData
 {
 	GENERATED_BODY()
 
-	/** Clip space position (xyz/w) */
-	FVector4f ClipPosition = FVector4f::Zero();
+	/** NDC center x,y as 16-bit unorms over +-VIEW_DATA_NDC_RANGE (see GaussianDataTypes.ush) */
+	uint32 PackedCenter = 0;
+
+	/** Device depth (clip z/w), negative for culled splats */
+	float DeviceZ = 0.0f;
 
 	/** Half-float packed R,G channels */
 	uint32 PackedColorRG = 0;
@@ -114,11 +117,41 @@ struct FGaussianSplatViewData
 	/** Half-float packed B,A channels */
 	uint32 PackedColorBA = 0;
 
-	/** 2D covariance principal axis 1 (screen space) */
-	FVector2f Axis1 = FVector2f::ZeroVector;
+	/** Half-float packed 2D covariance principal axis 1 (NDC) */
+	uint32 PackedAxis1 = 0;
 
-	/** 2D covariance principal axis 2 (screen space) */
-	FVector2f Axis2 = FVector2f::ZeroVector;
+	/** Half-float packed 2D covariance principal axis 2 (NDC) */
+	uint32 PackedAxis2 = 0;
+};
+
+/**
+ * Decoded splat of a component with dynamic updates (see UGaussianSplatComponent::UpdateSplats)
+ * Replaces the compressed streams of the full detail level, higher SH bands are still read from the asset.
+ * This structure must match the HLSL definition in GaussianDataTypes.ush
+ * Total: 40 bytes per splat
+ */
+USTRUCT()
+struct FGaussianSplatDynamicData
+{
+	GENERATED_BODY()
+
+	/** Local space position */
+	FVector3f Position = FVector3f::ZeroVector;
+
+	/** Half-float packed rotation quaternion X,Y */
+	uint32 PackedRotationXY = 0;
+
+	/** Half-float packed rotation quaternion Z,W */
+	uint32 PackedRotationZW = 0;
+
+	/** Linear 3D scale */
+	FVector3f Scale = FVector3f::OneVector;
+
+	/** Half-float packed base color R,G (SH DC as color) */
+	uint32 PackedColorRG = 0;
+
+	/** Half-float packed base color B and opacity */
+	uint32 PackedColorBA = 0;
 };
 
 /**
@@ -172,6 +205,53 @@ struct FGaussianChunkInfo
 	}
 };
 
+/**
+ * One level of detail: a range of the asset's splats
+ * Level 0 holds the imported splats, coarser levels hold merged splats appended after it.
+ * Every level starts on a chunk boundary so it has its own chunk bounds.
+ */
+USTRUCT(BlueprintType)
+struct FGaussianSplatLODLevel
+{
+	GENERATED_BODY()
+
+	/** First splat of this level in the asset's splat buffers */
+	UPROPERTY(VisibleAnywhere, Category = "LOD")
+	int32 FirstSplat = 0;
+
+	/** Number of splats in this level */
+	UPROPERTY(VisibleAnywhere, Category = "LOD")
+	int32 NumSplats = 0;
+
+	/** Serialization */
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplatLODLevel& Level)
+	{
+		Ar << Level.FirstSplat;
+		Ar << Level.NumSplats;
+		return Ar;
+	}
+};
+
+/**
+ * One splat of an asset's shadow proxy, cast into shadow depths as an octahedron around the splat
+ * The axes are the splat's principal axes scaled to where its alpha falls to ShadowAlphaThreshold.
+ */
+struct FGaussianSplatShadowSplat
+{
+	FVector3f Position = FVector3f::ZeroVector;
+	FVector3f Axes[3] = { FVector3f::ZeroVector, FVector3f::ZeroVector, FVector3f::ZeroVector };
+
+	/** Serialization */
+	friend FArchive& operator<<(FArchive& Ar, FGaussianSplatShadowSplat& Splat)
+	{
+		Ar << Splat.Position;
+		Ar << Splat.Axes[0];
+		Ar << Splat.Axes[1];
+		Ar << Splat.Axes[2];
+		return Ar;
+	}
+};
+
 /**
  * Constants for Gaussian Splatting
  */
@@ -194,6 +274,15 @@ namespace GaussianSplattingConstants
 
 	/** Maximum supported SH order (0-3) */
 	constexpr int32 MaxSHOrder = 3;
+
+	/** Maximum number of LOD levels, level 0 included */
+	constexpr int32 MaxLODLevels = 8;
+
+	/** Splats merged into one splat per LOD level */
+	constexpr int32 LODMergeFactor = 4;
+
+	/** Alpha at which shadow proxy splats are cut off, fainter splats cast no shadow */
+	constexpr float ShadowAlphaThreshold = 0.5f;
 }
 
 /**
@@ -260,6 +349,23 @@ namespace GaussianSplattingUtils
 		OutY = Y;
 	}
 
+	/** Spread the low 10 bits of X so there are two zero bits between each of them */
+	inline uint32 Part1By2(uint32 X)
+	{
+		X &= 0x3FF;
+		X = (X | (X << 16)) & 0x030000FF;
+		X = (X | (X << 8)) & 0x0300F00F;
+		X = (X | (X << 4)) & 0x030C30C3;
+		X = (X | (X << 2)) & 0x09249249;
+		return X;
+	}
+
+	/** Encode a 3D coordinate (10 bits per axis) to a 30-bit Morton code */
+	inline uint32 EncodeMorton3D(uint32 X, uint32 Y, uint32 Z)
+	{
+		return Part1By2(X) | (Part1By2(Y) << 1) | (Part1By2(Z) << 2);
+	}
+
 	/** Convert splat index to pixel coordinates in color texture (Morton-swizzled) */
 	inline void SplatIndexToTextureCoord(int32 SplatIndex, int32 TextureWidth, int32& OutX, int32& OutY)
 	{
@@ -279,6 +385,16 @@ namespace GaussianSplattingUtils
 		OutY = TileY * TileSize + LocalY;
 	}
 
+	/**
+	 * Color texture rows needed for a splat count
+	 * Morton tiles are 16 rows tall and filled tile by tile, so the height is a whole number of tile rows
+	 */
+	inline int32 GetColorTextureHeight(int32 SplatCount, int32 TextureWidth)
+	{
+		const int32 TileSize = GaussianSplattingConstants::MortonTileSize;
+		return FMath::DivideAndRoundUp(SplatCount, TextureWidth * TileSize) * TileSize;
+	}
+
 	/** Apply sigmoid function: 1 / (1 + exp(-x)) */
 	inline float Sigmoid(float X)
 	{
@@ -295,6 +411,92 @@ namespace GaussianSplattingUtils
 		);
 	}
 
+	/** Encode an imported splat for the dynamic splat buffer */
+	inline FGaussianSplatDynamicData MakeDynamicSplatData(const FGaussianSplatData& Splat)
+	{
+		FQuat4f Rotation = Splat.Rotation;
+		Rotation.Normalize();
+		const FVector3f Color = SHDCToColor(Splat.SH_DC);
+
+		FGaussianSplatDynamicData Data;
+		Data.Position = Splat.Position;
+		Data.PackedRotationXY = PackHalf2x16(Rotation.X, Rotation.Y);
+		Data.PackedRotationZW = PackHalf2x16(Rotation.Z, Rotation.W);
+		Data.Scale = Splat.Scale;
+		Data.PackedColorRG = PackHalf2x16(Color.X, Color.Y);
+		Data.PackedColorBA = PackHalf2x16(Color.Z, FMath::Clamp(Splat.Opacity, 0.0f, 1.0f));
+		return Data;
+	}
+
+	/** Pack a [0,1] vector as 11.10.11 bits */
+	inline uint32 EncodeFloat3ToNorm11(const FVector3f& V)
+	{
+		return static_cast<uint32>(FMath::Clamp(V.X, 0.0f, 1.0f) * 2047.5f)
+			| (static_cast<uint32>(FMath::Clamp(V.Y, 0.0f, 1.0f) * 1023.5f) << 11)
+			| (static_cast<uint32>(FMath::Clamp(V.Z, 0.0f, 1.0f) * 2047.5f) << 21);
+	}
+
+	/** Pack a [0,1] vector as 6.5.5 bits */
+	inline uint16 EncodeFloat3ToNorm655(const FVector3f& V)
+	{
+		return static_cast<uint16>(static_cast<uint32>(FMath::Clamp(V.X, 0.0f, 1.0f) * 63.5f)
+			| (static_cast<uint32>(FMath::Clamp(V.Y, 0.0f, 1.0f) * 31.5f) << 6)
+			| (static_cast<uint32>(FMath::Clamp(V.Z, 0.0f, 1.0f) * 31.5f) << 11));
+	}
+
+	/** Pack a [0,1] vector as 5.6.5 bits */
+	inline uint16 EncodeFloat3ToNorm565(const FVector3f& V)
+	{
+		return static_cast<uint16>(static_cast<uint32>(FMath::Clamp(V.X, 0.0f, 1.0f) * 31.5f)
+			| (static_cast<uint32>(FMath::Clamp(V.Y, 0.0f, 1.0f) * 63.5f) << 5)
+			| (static_cast<uint32>(FMath::Clamp(V.Z, 0.0f, 1.0f) * 31.5f) << 11));
+	}
+
+	/** Pack a [0,1] vector as 16.16.16 bits (written as three consecutive uint16) */
+	inline void EncodeFloat3ToNorm16(const FVector3f& V, uint16 Out[3])
+	{
+		Out[0] = static_cast<uint16>(FMath::Clamp(V.X, 0.0f, 1.0f) * 65535.5f);
+		Out[1] = static_cast<uint16>(FMath::Clamp(V.Y, 0.0f, 1.0f) * 65535.5f);
+		Out[2] = static_cast<uint16>(FMath::Clamp(V.Z, 0.0f, 1.0f) * 65535.5f);
+	}
+
+	/**
+	 * Pack a unit quaternion as "smallest three" 10.10.10.2 bits
+	 * The largest component is dropped (its index goes in the top 2 bits) and the other three,
+	 * which lie in [-1/sqrt2, 1/sqrt2], are remapped to [0,1]. Matches DecodeRotation in GaussianSplatting.ush.
+	 */
+	inline uint32 PackSmallest3Rotation(const FQuat4f& Q)
+	{
+		float Comp[4] = { Q.X, Q.Y, Q.Z, Q.W };
+
+		int32 LargestIndex = 0;
+		for (int32 i = 1; i < 4; i++)
+		{
+			if (FMath::Abs(Comp[i]) > FMath::Abs(Comp[LargestIndex]))
+			{
+				LargestIndex = i;
+			}
+		}
+
+		// q and -q are the same rotation, flip so the dropped component is positive
+		const float Sign = Comp[LargestIndex] >= 0.0f ? 1.0f : -1.0f;
+
+		uint32 Packed = 0;
+		int32 OutIndex = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			if (i == LargestIndex)
+			{
+				continue;
+			}
+			const float Norm = FMath::Clamp(Comp[i] * Sign * UE_SQRT_2 * 0.5f + 0.5f, 0.0f, 1.0f);
+			Packed |= static_cast<uint32>(Norm * 1023.5f) << (OutIndex * 10);
+			OutIndex++;
+		}
+
+		return Packed | (static_cast<uint32>(LargestIndex) << 30);
+	}
+
 	/** Normalize quaternion */
 	inline FQuat4f NormalizeQuat(const FQuat4f& Q)
 	{
@@ -9,10 +9,15 @@
 #include "GaussianSplatAsset.generated.h"
 
 // Asset version for backward compatibility
-#define GAUSSIAN_SPLAT_ASSET_VERSION 2
+#define GAUSSIAN_SPLAT_ASSET_VERSION 7
 #define GAUSSIAN_SPLAT_ASSET_MAGIC 0x47535056  // "GSPV" - Gaussian Splat Version marker
 // Version 1: Original TArray<uint8> serialization (no magic/version header)
 // Version 2: FByteBulkData for large arrays (positions, other, SH, color texture)
+// Version 3: Chunk-quantized positions/scales, smallest-three packed rotations (ScaleFormat added)
+// Version 4: Band-planar SH layout with Norm11/Norm6/clustered encodings (SHPaletteSize added)
+// Version 5: Merged LOD levels appended after the imported splats (LODLevels added)
+// Version 6: Optional precomputed 3D covariance layout for the other data (bPrecomputedCovariance added)
+// Version 7: Alpha-tested shadow proxy splats (ShadowSplats, ShadowSplatBudget added)
 
 /**
  * Asset containing Gaussian Splatting data loaded from PLY files
@@ -29,32 +34,52 @@ public:
 	//~ Begin UObject Interface
 	virtual void Serialize(FArchive& Ar) override;
 	virtual void PostLoad() override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
 	//~ End UObject Interface
 
-	/** Get the number of splats in this asset */
+	/** Get the number of splats stored in this asset, LOD levels included */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	int32 GetSplatCount() const { return SplatCount; }
 
+	/** Get the number of imported (full detail, LOD 0) splats */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int32 GetSourceSplatCount() const { return LODLevels.Num() > 0 ? LODLevels[0].NumSplats : SplatCount; }
+
+	/** Get the number of LOD levels, level 0 included */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int32 GetNumLODs() const { return LODLevels.Num(); }
+
 	/** Get the bounding box of all splats */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	FBox GetBounds() const { return BoundingBox; }
 
-	/** Get estimated memory usage in bytes */
+	/** Get estimated memory usage in bytes: the splat data and color texture as stored, not their GPU uploads */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	int64 GetMemoryUsage() const;
 
+	/** Get the GPU bytes of one upload of the splat data with every SH band, as shared by the components rendering the asset */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int64 GetGPUMemoryUsage() const;
+
 	/** Check if asset has valid data */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	bool IsValid() const { return SplatCount > 0 && PositionBulkData.GetBulkDataSize() > 0; }
 
+	/** Process-unique id of the current splat data, changes on every (re)import; keys the shared GPU resources */
+	uint32 GetRenderDataId() const { return RenderDataId; }
+
 public:
-	/** Total number of splats */
+	/** Total number of splats stored, LOD levels included */
 	UPROPERTY(VisibleAnywhere, Category = "Info")
 	int32 SplatCount = 0;
 
+	/** Splat range of each level of detail, finest first */
+	UPROPERTY(VisibleAnywhere, Category = "Info")
+	TArray<FGaussianSplatLODLevel> LODLevels;
+
 	/** World-space bounding box of all splats */
 	UPROPERTY(VisibleAnywhere, Category = "Info")
 	FBox BoundingBox;
@@ -63,6 +88,14 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Format")
 	EGaussianPositionFormat PositionFormat = EGaussianPositionFormat::Float32;
 
+	/** Scale compression format (uses the same vector encodings as positions) */
+	UPROPERTY(VisibleAnywhere, Category = "Format")
+	EGaussianPositionFormat ScaleFormat = EGaussianPositionFormat::Float32;
+
+	/** Other data holds the 3D covariance (6 halfs relative to the chunk's largest scale) instead of rotation and scale */
+	UPROPERTY(VisibleAnywhere, Category = "Format")
+	bool bPrecomputedCovariance = false;
+
 	/** Color compression format */
 	UPROPERTY(VisibleAnywhere, Category = "Format")
 	EGaussianColorFormat ColorFormat = EGaussianColorFormat::Float16x4;
@@ -75,15 +108,29 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Format")
 	int32 SHBands = 3;
 
+	/** Number of palette entries for clustered SH formats (0 for per-splat formats) */
+	UPROPERTY(VisibleAnywhere, Category = "Format")
+	int32 SHPaletteSize = 0;
+
 	/** Compressed position data (stored as bulk data for fast loading) */
 	FByteBulkData PositionBulkData;
 
-	/** Compressed rotation + scale data (stored as bulk data for fast loading) */
+	/** Compressed rotation (10.10.10.2) + scale data, or the precomputed covariance (stored as bulk data for fast loading) */
 	FByteBulkData OtherBulkData;
 
-	/** Compressed spherical harmonics data (stored as bulk data for fast loading) */
+	/**
+	 * Compressed spherical harmonics data (stored as bulk data for fast loading)
+	 * Layout: [uint16 palette index per splat, clustered formats only][band 1 block][band 2 block][band 3 block]
+	 * so that any prefix ending on a band boundary holds every band up to that order (see GetSHBandOffsets)
+	 */
 	FByteBulkData SHBulkData;
 
+	/**
+	 * Decimated, alpha-tested subset of a coarse LOD level that casts the asset's shadows, largest splats first
+	 * Kept on the CPU, the scene proxy builds its shadow mesh from it.
+	 */
+	TArray<FGaussianSplatShadowSplat> ShadowSplats;
+
 	/** Chunk quantization info (one per 256 splats) - kept as TArray since it's small */
 	UPROPERTY()
 	TArray<FGaussianChunkInfo> ChunkData;
@@ -107,17 +154,55 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Import")
 	FString SourceFilePath;
 
-	/** Quality level used during import */
+	/** Hash of the source file contents at import, keys the encoded streams in the derived data cache */
 	UPROPERTY(VisibleAnywhere, Category = "Import")
+	FString SourceFileHash;
+
+	/** Quality level used during import (applied on reimport) */
+	UPROPERTY(EditAnywhere, Category = "Import")
 	EGaussianQualityLevel ImportQuality = EGaussianQualityLevel::Medium;
 
+	/**
+	 * Levels of detail built at import (applied on reimport), level 0 included. 1 = no LODs.
+	 * Each coarser level merges every 4 neighbouring splats into one and adds about a third of the memory in total.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Import", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 NumLODLevels = 4;
+
+	/**
+	 * Store each splat's 3D covariance instead of rotation and scale (applied on reimport).
+	 * Saves the covariance math per splat and view; 12 bytes per splat, more than rotation + scale below High quality.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Import")
+	bool bPrecomputeCovariance = false;
+
+	/**
+	 * Splats of the shadow proxy built at import (applied on reimport), 0 = the asset casts no shadows.
+	 * Taken from the finest LOD level within the budget, each costs one 8-triangle octahedron per shadow view.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Import", meta = (ClampMin = "0"))
+	int32 ShadowSplatBudget = 16384;
+
 public:
 	/**
-	 * Initialize asset from raw splat data
-	 * @param InSplats Raw splat data from PLY file
+	 * Initialize asset from raw splat data, building NumLODLevels levels of detail
+	 * @param InSourceSplats Raw splat data from PLY file, spatially coherent (the importer Morton-orders it) for good LODs
 	 * @param InQuality Compression quality level
 	 */
-	void InitializeFromSplatData(const TArray<FGaussianSplatData>& InSplats, EGaussianQualityLevel InQuality);
+	void InitializeFromSplatData(const TArray<FGaussianSplatData>& InSourceSplats, EGaussianQualityLevel InQuality);
+
+#if WITH_EDITOR
+	/**
+	 * Initialize asset from the streams a previous import of the same source with the same settings left in the derived data cache
+	 * @param InSourceHash Hash of the source file contents
+	 * @param InQuality Compression quality level
+	 * @return False on a cache miss, the asset then still needs InitializeFromSplatData
+	 */
+	bool InitializeFromDerivedDataCache(const FString& InSourceHash, EGaussianQualityLevel InQuality);
+
+	/** Store the encoded streams in the derived data cache, keyed by SourceFileHash and the import settings */
+	void SaveToDerivedDataCache();
+#endif
 
 	/**
 	 * Decompress and return all splat positions (for debugging)
@@ -129,12 +214,43 @@ public:
 	/** Get bytes per splat for position data based on format */
 	static int32 GetPositionBytesPerSplat(EGaussianPositionFormat Format);
 
+	/** Get bytes per splat for rotation + scale data based on scale format, or for the precomputed covariance */
+	static int32 GetOtherBytesPerSplat(EGaussianPositionFormat InScaleFormat, bool bInPrecomputedCovariance = false);
+
+	/** Get the position and scale formats used for a quality level */
+	static void GetVectorFormatsForQuality(EGaussianQualityLevel Quality, EGaussianPositionFormat& OutPositionFormat, EGaussianPositionFormat& OutScaleFormat);
+
 	/** Get bytes per splat for color data based on format */
 	static int32 GetColorBytesPerSplat(EGaussianColorFormat Format);
 
-	/** Get bytes per splat for SH data based on format */
+	/** Get bytes per splat for SH data based on format (clustered formats: index only, palette excluded) */
 	static int32 GetSHBytesPerSplat(EGaussianSHFormat Format, int32 Bands);
 
+	/** Get the color texture format used for a quality level */
+	static EGaussianColorFormat GetColorFormatForQuality(EGaussianQualityLevel Quality);
+
+	/** Get the SH format used for a quality level */
+	static EGaussianSHFormat GetSHFormatForQuality(EGaussianQualityLevel Quality);
+
+	/** True for the palette (k-means clustered) SH formats */
+	static bool IsClusteredSHFormat(EGaussianSHFormat Format) { return Format >= EGaussianSHFormat::Cluster4k; }
+
+	/** Number of palette entries for a clustered SH format */
+	static int32 GetSHPaletteSizeForFormat(EGaussianSHFormat Format);
+
+	/** Bytes of one SH coefficient (RGB) in the given format */
+	static int32 GetSHCoefficientBytes(EGaussianSHFormat Format);
+
+	/** Bytes of one entry (splat or palette entry) in an SH band block, padded to 4 bytes */
+	static int32 GetSHBandStride(EGaussianSHFormat Format, int32 Band);
+
+	/**
+	 * Byte offsets of the SH band blocks in SHBulkData
+	 * OutBandOffsets[b - 1] is the start of band b (1-3), OutBandOffsets[3] is the total size,
+	 * so OutBandOffsets[Order] is the number of bytes needed to evaluate SH up to Order.
+	 */
+	void GetSHBandOffsets(uint32 OutBandOffsets[4]) const;
+
 	/**
 	 * Copy position bulk data to a TArray (for GPU upload)
 	 * @param OutData Array to copy data into
@@ -150,8 +266,9 @@ public:
 	/**
 	 * Copy SH bulk data to a TArray (for GPU upload)
 	 * @param OutData Array to copy data into
+	 * @param MaxBands Only copy the bands up to this order, higher bands are never sampled
 	 */
-	void GetSHData(TArray<uint8>& OutData) const;
+	void GetSHData(TArray<uint8>& OutData, int32 MaxBands = GaussianSplattingConstants::MaxSHOrder) const;
 
 	/**
 	 * Copy color texture bulk data to a TArray
@@ -172,24 +289,47 @@ public:
 	int64 GetColorTextureDataSize() const { return ColorTextureBulkData.GetBulkDataSize(); }
 
 private:
-	/** Compress and store position data */
-	void CompressPositions(const TArray<FGaussianSplatData>& InSplats);
+	/**
+	 * Calculate the bounds and chunk quantization bounds, and compress the position, rotation/scale,
+	 * color texture (Morton swizzled, stored raw for serialization) and SH streams.
+	 * One ParallelFor over chunks computes each chunk's bounds and encodes its splats while they are in cache.
+	 */
+	void BuildStreams(const TArray<FGaussianSplatData>& InSplats);
+
+	/** Cluster the gathered per-splat SH (SplatCount x coefficients x 3) into a palette and store it */
+	void CompressClusteredSH(const TArray<float>& Values);
 
-	/** Compress and store rotation/scale data */
-	void CompressRotationScale(const TArray<FGaussianSplatData>& InSplats);
+	/** Repack pre-version-3 rotation/scale data (28 bytes of floats) into the packed rotation layout */
+	void ConvertLegacyRotationScale();
 
-	/** Create color texture data with Morton swizzling (stores raw data for serialization) */
-	void CreateColorTextureData(const TArray<FGaussianSplatData>& InSplats);
+	/** Repack pre-version-4 SH data (Float16, all coefficients interleaved per splat) into the band-planar layout */
+	void ConvertLegacySH();
 
 	/** Create UTexture2D from stored ColorTextureData (called after load or import) */
 	void CreateColorTextureFromData();
 
-	/** Compress and store SH data */
-	void CompressSH(const TArray<FGaussianSplatData>& InSplats);
+	/**
+	 * Merge splats into coarser levels of detail
+	 * @param InSplats Full detail splats
+	 * @param OutSplats All levels, each starting on a chunk boundary
+	 */
+	void BuildLODLevels(const TArray<FGaussianSplatData>& InSplats, TArray<FGaussianSplatData>& OutSplats);
+
+	/** Build ShadowSplats from the LOD levels in InSplats (the output of BuildLODLevels) */
+	void BuildShadowSplats(const TArray<FGaussianSplatData>& InSplats);
+
+#if WITH_EDITOR
+	/** Derived data cache key of the streams encoded from a source with the current import settings */
+	FString GetDerivedDataKey(const FString& InSourceHash, EGaussianQualityLevel InQuality) const;
 
-	/** Calculate bounding box from splat data */
-	void CalculateBounds(const TArray<FGaussianSplatData>& InSplats);
+	/** Serialize everything InitializeFromSplatData produces, bulk payloads inline */
+	void SerializeDerivedData(FArchive& Ar);
+#endif
+
+private:
+	/** Version of the data that was loaded, older layouts are repacked in PostLoad */
+	int32 LoadedAssetVersion = GAUSSIAN_SPLAT_ASSET_VERSION;
 
-	/** Calculate chunk quantization bounds */
-	void CalculateChunkBounds(const TArray<FGaussianSplatData>& InSplats);
+	/** See GetRenderDataId */
+	uint32 RenderDataId = 0;
 };
@@ -9,6 +9,29 @@
 
 class UGaussianSplatAsset;
 class FGaussianSplatSceneProxy;
+class FRDGBuilder;
+class FRDGBuffer;
+
+/**
+ * What a deform pass (see UGaussianSplatComponent::SetDeformDelegate) works on
+ */
+struct FGaussianSplatDeformContext
+{
+	/** Full detail splats as last updated, FGaussianSplatDynamicData each */
+	FRDGBuffer* RestSplatBuffer = nullptr;
+
+	/** Splats to render this frame, holding a copy of RestSplatBuffer for the pass to deform in place */
+	FRDGBuffer* SplatBuffer = nullptr;
+
+	/** Number of splats in both buffers */
+	int32 NumSplats = 0;
+
+	/** World time of the view family being rendered */
+	float WorldTimeSeconds = 0.0f;
+};
+
+/** Adds the compute passes that deform a component's dynamic splats, called on the render thread once per frame */
+DECLARE_DELEGATE_TwoParams(FGaussianSplatDeformDelegate, FRDGBuilder& /*GraphBuilder*/, const FGaussianSplatDeformContext& /*Context*/);
 
 /**
  * Component for rendering Gaussian Splatting assets in the scene
@@ -31,7 +54,7 @@ public:
 	//~ Begin UActorComponent Interface
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void SendRenderDynamicData_Concurrent() override;
 	//~ End UActorComponent Interface
 
 	//~ Begin UPrimitiveComponent Interface
@@ -48,10 +71,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	UGaussianSplatAsset* GetSplatAsset() const { return SplatAsset; }
 
-	/** Get the number of splats being rendered */
+	/** Get the number of full detail splats of the assigned asset */
 	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
 	int32 GetSplatCount() const;
 
+	/**
+	 * Overwrite a range of full detail splats (requires bAllowDynamicUpdates)
+	 * Only the changed range is uploaded, large updates are spread over frames (gs.DynamicUploadBufferMB).
+	 * Higher SH bands keep the asset's values. Updates last until the render state is recreated,
+	 * and the bounds stay the asset's, so keep moved splats inside them or raise BoundsScale.
+	 * @param FirstSplat Index of the first splat to replace
+	 * @param Splats New splat data, clipped to the asset's splat count
+	 */
+	void UpdateSplats(int32 FirstSplat, TConstArrayView<FGaussianSplatData> Splats);
+
+	/**
+	 * Set the compute pass that deforms the splats every frame before their view data is computed (requires bAllowDynamicUpdates)
+	 * The delegate runs on the render thread, so bind it to render thread safe state only. Pass an unbound delegate to stop.
+	 */
+	void SetDeformDelegate(const FGaussianSplatDeformDelegate& InDeformDelegate);
+
+	/** Get the current deform pass */
+	const FGaussianSplatDeformDelegate& GetDeformDelegate() const { return DeformDelegate; }
+
 public:
 	/** The Gaussian Splat asset to render */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting")
@@ -73,10 +115,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Rendering", meta = (ClampMin = "0.1", ClampMax = "10.0"))
 	float SplatScale = 1.0f;
 
+	/** Maximum splats rendered per view, coarser LOD levels are used to stay within it. 0 = no budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Performance", meta = (ClampMin = "0"))
+	int32 MaxSplatsPerView = 0;
+
 	/** Enable frustum culling for better performance */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Performance")
 	bool bEnableFrustumCulling = true;
 
+	/**
+	 * Keep a writable copy of the splats for UpdateSplats and deform passes. The GPU data is then not shared
+	 * with other components of the asset, only the full detail level is rendered and chunk culling is off.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gaussian Splatting|Dynamic")
+	bool bAllowDynamicUpdates = false;
+
 protected:
 	/** Called when the asset changes */
 	void OnAssetChanged();
@@ -85,6 +138,9 @@ protected:
 	void MarkRenderStateDirty();
 
 private:
+	/** Deform pass handed to new proxies */
+	FGaussianSplatDeformDelegate DeformDelegate;
+
 	/** Cached bounds */
 	mutable FBoxSphereBounds CachedBounds;
 	mutable bool bBoundsCached = false;
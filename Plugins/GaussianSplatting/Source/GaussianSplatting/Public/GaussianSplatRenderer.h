@@ -6,13 +6,88 @@
 #include "RenderGraphResources.h"
 #include "RenderGraphBuilder.h"
 #include "SceneView.h"
+#include "RendererInterface.h"
 
 class FGaussianSplatSceneProxy;
 class FGaussianSplatGPUResources;
+class FGaussianSplatViewResources;
+
+/**
+ * One proxy's contribution to a batched sort and draw
+ */
+struct FGaussianSplatBatchItem
+{
+	FGaussianSplatGPUResources* GPUResources = nullptr;
+	FMatrix LocalToWorld = FMatrix::Identity;
+	FBoxSphereBounds Bounds = FBoxSphereBounds(ForceInit);
+	int32 SplatOffset = 0;
+	int32 SplatCount = 0;
+	int32 SHOrder = 0;
+	float OpacityScale = 1.0f;
+	float SplatScale = 1.0f;
+};
+
+/**
+ * Farthest-depth pyramid of a view's scene depth that CalcViewData culls occluded splats against (gs.OcclusionCulling)
+ * Built after the opaque passes, so the compute of the next frame tests against the previous frame's depth.
+ */
+struct FGaussianSplatOcclusionHZB
+{
+	/** R32F, mip 0 holds the farthest device Z of 4x4 pixels of the view rect */
+	TRefCountPtr<IPooledRenderTarget> Texture;
+	/** Jitter-free WorldToClip of the view the depth was rendered with */
+	FMatrix44f WorldToClip = FMatrix44f::Identity;
+	/** Projection (M[0][0], M[1][1]) */
+	FVector2f ProjectionScale = FVector2f::ZeroVector;
+	/** Projection (M[2][2], M[3][2]), device Z = X + Y / view depth */
+	FVector2f DeviceZParams = FVector2f::ZeroVector;
+	/** View rect size / 4, maps view UV to mip 0 texels */
+	FVector2f UVToTexel = FVector2f::ZeroVector;
+	FIntPoint Size = FIntPoint::ZeroValue;
+	int32 NumMips = 0;
+	/** View family frame the HZB was built in */
+	uint32 FrameNumber = 0;
+	/** GPUs the HZB was built on, the only ones holding its contents */
+	FRHIGPUMask GPUMask;
+};
+
+/**
+ * Sort buffers CalcViewData appends the splats that survive culling to
+ */
+struct FGaussianSplatSortKeyTargets
+{
+	/** Receives the depth keys */
+	FRDGBufferRef DistanceBuffer = nullptr;
+	/** Receives the ViewDataBuffer index of each appended splat */
+	FRDGBufferRef KeysBuffer = nullptr;
+	/** [0] = number of splats appended, cleared once before the first proxy */
+	FRDGBufferRef VisibleCountBuffer = nullptr;
+	/** Key width (16, 24 or 32), see gs.SortKeyBits */
+	uint32 SortKeyBits = 32;
+	/** View-space (near, 1 / (far - near)) that 16 and 24 bit keys are quantized against */
+	FVector2f DepthRange = FVector2f::ZeroVector;
+	/** Splats entirely behind this HZB are not appended, null to keep every splat in view */
+	const FGaussianSplatOcclusionHZB* OcclusionHZB = nullptr;
+};
+
+/**
+ * Per-view SH color cache CalcViewData reuses while the view direction to a chunk barely changes (gs.SHCacheAngle)
+ */
+struct FGaussianSplatSHCacheTargets
+{
+	/** Evaluated color per ViewDataBuffer element, RGB halfs */
+	FRDGBufferRef ColorBuffer = nullptr;
+	/** Local-space view direction per ViewDataBuffer chunk the cached colors were evaluated for, zero when invalid */
+	FRDGBufferRef DirectionBuffer = nullptr;
+	/** Cosine of gs.SHCacheAngle, chunks whose view direction turned further are re-evaluated */
+	float CosAngle = 1.0f;
+};
 
 /**
  * Handles the rendering of Gaussian Splats
- * Orchestrates compute passes for view calculation, sorting, and final rendering
+ * Orchestrates compute passes for view calculation, sorting, and final rendering.
+ * All work is expressed as RDG passes; view data and sort results live in per-view pooled
+ * buffers so camera-static views can skip compute entirely.
  */
 class GAUSSIANSPLATTING_API FGaussianSplatRenderer
 {
@@ -20,65 +95,299 @@ public:
 	FGaussianSplatRenderer();
 	~FGaussianSplatRenderer();
 
+	/**
+	 * Pass flags for the view data and sort passes.
+	 * AsyncCompute when gs.AsyncCompute is enabled and the RHI supports it efficiently.
+	 */
+	static ERDGPassFlags GetComputePassFlags();
+
+	/** True when gs.BatchProxies is enabled: all proxies in a view share one sort and one draw */
+	static bool IsBatchingEnabled();
+
+	/**
+	 * Primary eye whose sort a secondary stereo eye draws with (gs.StereoSharedSort)
+	 * @return The other eye of View's stereo pair if View is the secondary eye, else null
+	 */
+	static const FSceneView* GetStereoPrimaryView(const FSceneView& View);
+
+	/**
+	 * Collect the proxies renderable in a view into batch items at their selected LOD
+	 * @param View View being rendered
+	 * @param Proxies Registered proxies
+	 * @param OutItems Renderable proxies, in registration order
+	 */
+	static void GatherBatchItems(
+		const FSceneView& View,
+		TConstArrayView<FGaussianSplatSceneProxy*> Proxies,
+		TArray<FGaussianSplatBatchItem>& OutItems
+	);
+
+	/**
+	 * Add the view data and sort passes for a proxy in a view.
+	 * Called early in the frame (PreRenderView) so the work can overlap the base pass on async compute.
+	 * Does nothing beyond marking the view prepared when the cached sort is still valid.
+	 * The primary eye of a stereo pair culls and sorts for both eyes; the secondary eye then only computes its
+	 * view data, provided the primary eye was set up first this frame for the same splats.
+	 * @param ViewResources The proxy's buffers for this view (see FGaussianSplatSceneProxy::FindOrAddViewResources)
+	 * @param StereoPrimaryResources The proxy's buffers for GetStereoPrimaryView(View), null if there is none
+	 * @param SplatOffset First splat of the LOD level to render (see FGaussianSplatSceneProxy::SelectLOD)
+	 * @param SplatCount Number of splats of that level
+	 */
+	static void AddComputePasses(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FGaussianSplatGPUResources* GPUResources,
+		FGaussianSplatViewResources* ViewResources,
+		FGaussianSplatViewResources* StereoPrimaryResources,
+		const FMatrix& LocalToWorld,
+		const FBoxSphereBounds& Bounds,
+		int32 SplatOffset,
+		int32 SplatCount,
+		int32 SHOrder,
+		float OpacityScale,
+		float SplatScale,
+		ERDGPassFlags ComputePassFlags
+	);
+
 	/**
 	 * Render Gaussian splats for a scene proxy
-	 * Called from the render thread
+	 * Called from the render thread. Adds the compute passes inline on the graphics pipe if they
+	 * were not already added for this view, then adds the raster pass into RenderTargets.
+	 * A secondary stereo eye sharing the primary eye's sort draws with StereoPrimaryResources' order (see AddComputePasses).
 	 */
 	static void Render(
-		FRHICommandListImmediate& RHICmdList,
+		FRDGBuilder& GraphBuilder,
 		const FSceneView& View,
 		FGaussianSplatGPUResources* GPUResources,
+		FGaussianSplatViewResources* ViewResources,
+		FGaussianSplatViewResources* StereoPrimaryResources,
 		const FMatrix& LocalToWorld,
+		const FBoxSphereBounds& Bounds,
+		int32 SplatOffset,
 		int32 SplatCount,
 		int32 SHOrder,
 		float OpacityScale,
-		float SplatScale
+		float SplatScale,
+		const FRenderTargetBindingSlots& RenderTargets
 	);
 
 	/**
-	 * Dispatch the view data calculation compute shader
+	 * Batched variant of AddComputePasses: every item writes its view data into one shared
+	 * buffer at its own offset and appends its visible splats to shared sort buffers, then a single
+	 * radix sort orders all splats together so overlapping proxies blend correctly.
+	 * Stereo eyes share the primary eye's sort as in AddComputePasses.
+	 */
+	static void AddBatchedComputePasses(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FGaussianSplatViewResources* BatchResources,
+		FGaussianSplatViewResources* StereoPrimaryBatchResources,
+		TConstArrayView<FGaussianSplatBatchItem> Items,
+		ERDGPassFlags ComputePassFlags
+	);
+
+	/**
+	 * Batched variant of Render: one raster pass and one instanced draw for all items
+	 */
+	static void RenderBatched(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FGaussianSplatViewResources* BatchResources,
+		FGaussianSplatViewResources* StereoPrimaryBatchResources,
+		TConstArrayView<FGaussianSplatBatchItem> Items,
+		const FRenderTargetBindingSlots& RenderTargets
+	);
+
+	/**
+	 * Dispatch the view data calculation compute shader over the chunks that pass DispatchCullChunks
+	 * Applies the peripheral splat size threshold where gs.Foveation is enabled for the view.
+	 * @param StereoView Other eye of a shared stereo sort: splats visible to either eye are kept and keyed at the eyes' midpoint depth
+	 * @param ViewDataOffset First ViewDataBuffer element written by this proxy, a multiple of the chunk size
+	 * @param SortKeyTargets Sort buffers visible splats are appended to, null when only the view data is refreshed
+	 * @param SHCacheTargets SH color cache of the view, null to evaluate SH for every splat
+	 * @param bCullChunks False to compute every chunk, e.g. when a previous sort order is reused
+	 * @param SplatOffset First source splat (LOD level start, a multiple of the chunk size)
 	 */
 	static void DispatchCalcViewData(
-		FRHICommandListImmediate& RHICmdList,
+		FRDGBuilder& GraphBuilder,
 		const FSceneView& View,
+		const FSceneView* StereoView,
 		FGaussianSplatGPUResources* GPUResources,
+		FRDGBufferRef ViewDataBuffer,
+		uint32 ViewDataOffset,
+		const FGaussianSplatSortKeyTargets* SortKeyTargets,
+		const FGaussianSplatSHCacheTargets* SHCacheTargets,
+		bool bCullChunks,
 		const FMatrix& LocalToWorld,
+		int32 SplatOffset,
 		int32 SplatCount,
 		int32 SHOrder,
 		float OpacityScale,
 		float SplatScale,
-		bool bHasColorTexture = true
+		bool bHasColorTexture,
+		ERDGPassFlags ComputePassFlags
 	);
 
 	/**
-	 * Dispatch the distance calculation compute shader
+	 * Frustum-cull a proxy's chunks against their bounds (gs.ChunkCulling)
+	 * @param StereoView Other eye of a shared stereo sort, chunks visible to either eye are kept
+	 * @param bCullChunks False to mark every chunk visible
+	 * @param OutVisibleChunkList Indices of the visible chunks
+	 * @param OutChunkDispatchArgs Dispatch args with one group per visible chunk
 	 */
-	static void DispatchCalcDistances(
-		FRHICommandListImmediate& RHICmdList,
+	static void DispatchCullChunks(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		const FSceneView* StereoView,
 		FGaussianSplatGPUResources* GPUResources,
-		int32 SplatCount
+		const FMatrix& LocalToWorld,
+		int32 SplatOffset,
+		int32 SplatCount,
+		float SplatScale,
+		bool bCullChunks,
+		FRDGBufferRef& OutVisibleChunkList,
+		FRDGBufferRef& OutChunkDispatchArgs,
+		ERDGPassFlags ComputePassFlags
+	);
+
+	/**
+	 * Refine last frame's sorted order against the current view data (temporal sort reuse)
+	 * Sorts overlapping tiles of SortKeysBuffer in place; the visible count is read from DrawArgsBuffer.
+	 * Quantized keys recover the view depth from the stored device depth with the view's InvDeviceZToWorldZTransform.
+	 * @param TileOffset Start of the first tile, alternated between frames so tiles overlap
+	 */
+	static void DispatchRefineSort(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FRDGBufferRef ViewDataBuffer,
+		FRDGBufferRef SortKeysBuffer,
+		FRDGBufferRef DrawArgsBuffer,
+		int32 MaxSortCount,
+		uint32 SortKeyBits,
+		const FVector2f& DepthRange,
+		uint32 TileOffset,
+		ERDGPassFlags ComputePassFlags
+	);
+
+	/**
+	 * Write the radix sort dispatch args and the splat draw args from the visible splat count
+	 */
+	static void DispatchBuildIndirectArgs(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef VisibleCountBuffer,
+		FRDGBufferRef SortDispatchArgsBuffer,
+		FRDGBufferRef DrawArgsBuffer,
+		ERDGPassFlags ComputePassFlags
 	);
 
 	/**
-	 * Dispatch radix sort for back-to-front ordering
+	 * Dispatch radix sort for back-to-front ordering, one pass per 8 key bits
+	 * Sorts the first SortCountBuffer[0] entries of DistanceBuffer/UnsortedKeysBuffer into SortKeysBuffer, using
+	 * transient ping-pong and histogram buffers sized for MaxSortCount. UnsortedKeysBuffer must be SortKeysBuffer
+	 * for an even pass count and a separate buffer for an odd one.
 	 */
 	static void DispatchRadixSort(
-		FRHICommandListImmediate& RHICmdList,
-		FGaussianSplatGPUResources* GPUResources,
-		int32 SplatCount
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef DistanceBuffer,
+		FRDGBufferRef UnsortedKeysBuffer,
+		FRDGBufferRef SortKeysBuffer,
+		FRDGBufferRef SortCountBuffer,
+		FRDGBufferRef SortDispatchArgsBuffer,
+		int32 MaxSortCount,
+		uint32 SortKeyBits,
+		ERDGPassFlags ComputePassFlags
+	);
+
+	/**
+	 * OneSweep variant of DispatchRadixSort (gs.SortMode 1): one histogram pass for every digit,
+	 * then a single scatter dispatch per digit that resolves tile offsets with decoupled lookback
+	 */
+	static void DispatchOneSweepSort(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef DistanceBuffer,
+		FRDGBufferRef UnsortedKeysBuffer,
+		FRDGBufferRef SortKeysBuffer,
+		FRDGBufferRef SortCountBuffer,
+		FRDGBufferRef SortDispatchArgsBuffer,
+		int32 MaxSortCount,
+		uint32 NumPasses,
+		ERDGPassFlags ComputePassFlags
 	);
 
 	/**
 	 * Draw the Gaussian splats
+	 * Issues one indexed indirect draw whose instance count is the visible splat count, or runs DispatchTileRasterizer instead
+	 * With gs.FoveationVRS the draw is shaded through a foveated shading rate image where the RHI supports one.
+	 * With gs.SplatDepthWrite the splats' approximate depth is written afterwards, see DrawSplatDepth.
 	 */
 	static void DrawSplats(
-		FRHICommandListImmediate& RHICmdList,
+		FRDGBuilder& GraphBuilder,
 		const FSceneView& View,
+		FGaussianSplatViewResources& ViewResources,
 		FGaussianSplatGPUResources* GPUResources,
-		int32 SplatCount
+		FRDGBufferRef ViewDataBuffer,
+		FRDGBufferRef SortKeysBuffer,
+		FRDGBufferRef DrawArgsBuffer,
+		int32 SplatCount,
+		const FRenderTargetBindingSlots& RenderTargets
+	);
+
+	/**
+	 * Write approximate splat depth into SceneDepthTexture after the splats were drawn (gs.SplatDepthWrite)
+	 * Draws the sorted quads again depth-only, keeping the pixels whose gaussian alpha reaches gs.SplatDepthWriteAlpha.
+	 */
+	static void DrawSplatDepth(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FGaussianSplatGPUResources* GPUResources,
+		FRDGBufferRef ViewDataBuffer,
+		FRDGBufferRef SortKeysBuffer,
+		FRDGBufferRef DrawArgsBuffer,
+		int32 SplatCount,
+		FRDGTextureRef SceneDepthTexture
 	);
 
-private:
-	/** Calculate next power of 2 */
-	static uint32 NextPowerOfTwo(uint32 Value);
+	/** True when gs.OcclusionCulling is enabled and the view can keep an HZB between frames */
+	static bool UseOcclusionCulling(const FSceneView& View);
+
+	/**
+	 * Build the view's occlusion HZB from the scene depth for the next frame's culling (gs.OcclusionCulling)
+	 * Must run before any splat depth is written, so splats are never culled against themselves. MSAA depth is not supported.
+	 */
+	static void BuildOcclusionHZB(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FRDGTextureRef SceneDepthTexture,
+		FGaussianSplatOcclusionHZB& OutHZB
+	);
+
+	/**
+	 * Compute alternative to the quad draw (gs.TileRasterizer)
+	 * Bins the sorted splats into screen tiles, sorts the entries by tile and blends each tile front-to-back
+	 * into SceneColorTexture, depth tested against SceneDepthTexture. Both must be single-sample, scene color UAV-capable.
+	 * Entries beyond gs.TileRasterMaxEntriesPerSplat drop the farthest splats and are counted in ViewResources for the stats.
+	 */
+	static void DispatchTileRasterizer(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FGaussianSplatViewResources& ViewResources,
+		FRDGBufferRef ViewDataBuffer,
+		FRDGBufferRef SortKeysBuffer,
+		FRDGBufferRef DrawArgsBuffer,
+		int32 SplatCount,
+		FRDGTextureRef SceneColorTexture,
+		FRDGTextureRef SceneDepthTexture
+	);
+
+	/**
+	 * Time the splat sort on NumKeys random keys for benchmarking (see UGaussianSplatBenchmarkCommandlet)
+	 * Uses the implementation gs.SortMode selects. Render thread only, blocks until the GPU finished.
+	 * @param SortKeyBits Key width to sort, 16, 24 or 32
+	 * @param Iterations Number of timed sorts to average
+	 * @return Average GPU milliseconds per sort, or a negative value when the RHI has no timestamp queries
+	 */
+	static double BenchmarkSort(FRHICommandListImmediate& RHICmdList, int32 NumKeys, uint32 SortKeyBits, int32 Iterations);
+
+	/** Transient sort buffer bytes requested by the last frame that sorted, render thread (see STAT_GaussianSplatSortScratchMemory) */
+	static int64 GetSortScratchBytes();
 };
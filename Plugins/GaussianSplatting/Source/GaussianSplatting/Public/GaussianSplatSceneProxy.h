@@ -5,15 +5,214 @@
 #include "CoreMinimal.h"
 #include "PrimitiveSceneProxy.h"
 #include "GaussianDataTypes.h"
+#include "GaussianSplatComponent.h"
 #include "RenderResource.h"
 #include "RHI.h"
 #include "RHIResources.h"
-
-class UGaussianSplatComponent;
+#include "RenderGraphResources.h"
+#include "RHIGPUReadback.h"
+#include "LocalVertexFactory.h"
+#include "StaticMeshResources.h"
+#include "DynamicMeshBuilder.h"
+#include "Serialization/BulkData.h"
+
+class FRDGBuilder;
 class UGaussianSplatAsset;
 
 /**
- * GPU resources for Gaussian Splatting rendering
+ * Per-view GPU state: the view data and sorted splat order computed for a single view, plus
+ * what they were computed from so a camera-static view can skip compute.
+ * Owned per proxy, or per scene by the view extension when proxies are batched, each through
+ * a FGaussianSplatViewResourceCache.
+ */
+class FGaussianSplatViewResources
+{
+public:
+	/**
+	 * Register the persistent per-view buffers with the graph, allocating them on first use
+	 * @param GraphBuilder Graph the current view is rendered with
+	 * @param NumElements Number of splats the buffers must hold; larger existing buffers are reused
+	 * @param OutViewDataBuffer Per-splat view data
+	 * @param OutSortKeysBuffer Sorted splat indices
+	 * @param OutDrawArgsBuffer Indexed indirect draw args covering the visible splats
+	 */
+	void RegisterBuffers(FRDGBuilder& GraphBuilder, int32 NumElements, FRDGBufferRef& OutViewDataBuffer, FRDGBufferRef& OutSortKeysBuffer, FRDGBufferRef& OutDrawArgsBuffer);
+
+	/**
+	 * Register the persistent SH color cache (see gs.SHCacheAngle), allocating it on first use.
+	 * The cached directions are cleared when the buffers are allocated or CacheKey changed since the last call.
+	 * @param NumElements Number of splats the cache must hold, a multiple of the chunk size
+	 * @param CacheKey Hash of the splats and SH settings the cached colors are evaluated from
+	 */
+	void RegisterSHCacheBuffers(FRDGBuilder& GraphBuilder, int32 NumElements, uint32 CacheKey, ERDGPassFlags ComputePassFlags, FRDGBufferRef& OutColorBuffer, FRDGBufferRef& OutDirectionBuffer);
+
+	/** Release the per-view buffers */
+	void Release();
+
+	/** GPU bytes held by the persistent per-view buffers */
+	int64 GetGPUMemoryBytes() const;
+
+	/** True if view data and sort passes were already set up for this exact view this frame */
+	bool IsPreparedFor(const FSceneView& View) const;
+
+	/** Record that this view's compute has been set up (or skipped as camera-static) this frame */
+	void MarkPrepared(const FSceneView& View);
+
+public:
+	/** View state key this entry belongs to (see FSceneView::GetViewKey) */
+	uint32 ViewKey = 0;
+
+	/** GPUs the view renders on; the buffers hold valid contents on these GPUs only */
+	FRHIGPUMask GPUMask;
+
+	/** Family frame number of the last view that used this entry, for LRU eviction */
+	uint32 LastUsedFrameNumber = 0;
+
+	/** View data buffer (computed per-frame, persists for camera-static frames) */
+	TRefCountPtr<FRDGPooledBuffer> ViewDataBuffer;
+
+	/** Sorted splat indices for this view (radix sort result), only the first visible count entries are valid */
+	TRefCountPtr<FRDGPooledBuffer> SortKeysBuffer;
+
+	/** Indirect draw args written on the GPU from the visible splat count */
+	TRefCountPtr<FRDGPooledBuffer> DrawArgsBuffer;
+
+	/** SH color cache: evaluated color per splat, and the view direction per chunk it was evaluated for */
+	TRefCountPtr<FRDGPooledBuffer> SHColorCacheBuffer;
+	TRefCountPtr<FRDGPooledBuffer> SHCacheDirectionBuffer;
+	uint32 CachedSHCacheKey = 0;
+
+	/** Cached state for camera-static sort skipping */
+	FMatrix CachedViewProjectionMatrix = FMatrix::Identity;
+	FMatrix CachedLocalToWorld = FMatrix::Identity;
+	float CachedOpacityScale = -1.0f;
+	float CachedSplatScale = -1.0f;
+	bool CachedHasColorTexture = false;
+	int32 CachedSHOrder = -1;
+	uint32 CachedSortKeyBits = 0;
+	int32 CachedSplatOffset = -1;
+	int32 CachedSplatCount = 0;
+	uint32 CachedDynamicRevision = 0;
+	bool bHasCachedSortData = false;
+
+	/** Camera and frame of the last full sort, for temporal sort reuse (see gs.SortReuseDistance) */
+	FVector LastFullSortViewOrigin = FVector::ZeroVector;
+	FVector LastFullSortViewDirection = FVector::ForwardVector;
+	uint32 LastFullSortFrameNumber = 0;
+	/** The last full sort dropped splats behind the occlusion HZB, it expires after gs.OcclusionCullingResortFrames */
+	bool bOcclusionCulledSort = false;
+
+	/** Batched rendering: hash of the proxies and parameters the buffers were computed from */
+	uint32 CachedBatchHash = 0;
+
+	/** Batched rendering: total splats written into the buffers */
+	int32 CachedBatchSplatCount = 0;
+
+	/** Shared stereo sort: view projection of the other eye the culling and sort keys were computed with */
+	FMatrix CachedStereoViewProjectionMatrix = FMatrix::Identity;
+
+	/** Shared stereo sort: this secondary eye only holds view data and draws in the primary eye's order */
+	bool bCachedStereoSecondary = false;
+
+	/** Stats: GPU copy of the visible splat count of the last full sort, and the latest count read back from it */
+	TUniquePtr<FRHIGPUBufferReadback> VisibleCountReadback;
+	bool bVisibleCountReadbackPending = false;
+	int32 LastVisibleSplatCount = -1;
+
+	/** Stats: GPU copy of the tile rasterizer's clamped and requested entry counts, and the entries the latest one dropped */
+	TUniquePtr<FRHIGPUBufferReadback> TileEntryCountReadback;
+	bool bTileEntryCountReadbackPending = false;
+	int32 LastDroppedTileEntries = 0;
+
+private:
+	/** Bring STAT_GaussianSplatViewBufferMemory and TrackedBufferMemory up to date after the buffers changed */
+	void UpdateTrackedMemory();
+
+	/** View and frame the compute passes were last set up for */
+	const FSceneView* PreparedView = nullptr;
+	uint32 PreparedFrameNumber = 0;
+
+	/** Bytes added to STAT_GaussianSplatViewBufferMemory */
+	int64 TrackedBufferMemory = 0;
+};
+
+/**
+ * Small LRU of per-view resources keyed by view state (see FSceneView::GetViewKey) and the view's GPU mask,
+ * so with multiple GPUs (alternate frame rendering, nDisplay) a view only ever reuses what its own GPUs computed.
+ * Holds at most gs.MaxCachedViewsPerProxy entries. Render thread only.
+ */
+class FGaussianSplatViewResourceCache
+{
+public:
+	/**
+	 * Find the entry for a view, creating it (and evicting the least recently used entry
+	 * beyond gs.MaxCachedViewsPerProxy) when the view has none yet.
+	 * Buffers are allocated lazily by FGaussianSplatViewResources::RegisterBuffers.
+	 */
+	FGaussianSplatViewResources* FindOrAdd(const FSceneView& View);
+
+	/** Release every entry */
+	void Empty();
+
+	/** GPU bytes held by every entry */
+	int64 GetGPUMemoryBytes() const;
+
+private:
+	TArray<TUniquePtr<FGaussianSplatViewResources>> Entries;
+};
+
+/**
+ * One byte range of an asset bulk data array, copied to the same offset in a GPU buffer
+ */
+struct FGaussianSplatStreamingCopy
+{
+	const FByteBulkData* BulkData = nullptr;
+	FRHIBuffer* Buffer = nullptr;
+	int64 Offset = 0;
+	int64 Size = 0;
+
+	/** Async read in flight, nullptr when the bulk data is already in memory */
+	IBulkDataIORequest* Request = nullptr;
+};
+
+/**
+ * A chunk-aligned range of one LOD level's splats, streamed and uploaded as a unit
+ */
+struct FGaussianSplatStreamingPage
+{
+	int32 LODIndex = 0;
+	int32 NumSplats = 0;
+	TArray<FGaussianSplatStreamingCopy> Copies;
+
+	/** GPUs holding the page, as FRHIGPUMask::GetNative bits */
+	uint32 UploadedGPUBits = 0;
+
+	/** Reads issued and not uploaded yet */
+	bool bInFlight = false;
+};
+
+/**
+ * A partial update of dynamic splats waiting for upload (see FGaussianSplatGPUResources::EnqueueDynamicUpdate)
+ */
+struct FGaussianSplatDynamicUpdate
+{
+	int32 FirstSplat = 0;
+	TArray<FGaussianSplatDynamicData> Splats;
+
+	/** Splats already copied to the GPU, updates larger than a staging slice take several frames */
+	int32 NumUploaded = 0;
+};
+
+/**
+ * Immutable GPU resources of one asset for Gaussian Splatting rendering, shared by every proxy
+ * of that asset through FGaussianSplatGPUResourceCache. Per-view state lives on the proxies.
+ * The splat buffers are created empty and filled page by page from the asset's bulk data
+ * (see UpdateStreaming), coarsest LOD level first, so large assets never stall on upload.
+ * Resources of a component with dynamic updates are not shared: they additionally decode the full
+ * detail level into a writable buffer that partial updates and a deform pass edit (see UpdateDynamicSplats).
+ * With multiple GPUs every buffer is created on all of them, but streaming only uploads to the GPUs
+ * whose view families render the asset (see AddViewGPUs). Dynamic resources upload and update every GPU,
+ * and views only compute on their own GPUs (see FGaussianSplatViewResourceCache).
  */
 class FGaussianSplatGPUResources : public FRenderResource
 {
@@ -21,15 +220,72 @@ public:
 	FGaussianSplatGPUResources();
 	virtual ~FGaussianSplatGPUResources();
 
-	/** Initialize resources from asset data */
-	void Initialize(UGaussianSplatAsset* Asset);
+	/**
+	 * Initialize resources from asset data
+	 * @param Asset Source asset
+	 * @param MaxSHOrder Highest SH band that will be evaluated, higher bands are not uploaded
+	 * @param bInDynamic Keep a writable copy of the full detail splats, see UpdateDynamicSplats
+	 */
+	void Initialize(UGaussianSplatAsset* Asset, int32 MaxSHOrder, bool bInDynamic = false);
 
 	/** Check if resources are valid */
 	bool IsValid() const { return bInitialized && SplatCount > 0 && ColorTextureSRV.IsValid(); }
 
+	/**
+	 * Upload the pages whose reads completed and issue reads for the next ones,
+	 * keeping at most gs.StreamingMaxPagesInFlight pages in flight. Render thread, once per frame.
+	 */
+	void UpdateStreaming(FRHICommandListImmediate& RHICmdList);
+
+	/**
+	 * Add the GPUs a view family renders on, render thread, before UpdateStreaming. Pages are uploaded to these GPUs only.
+	 * Added GPUs get every page in an extra streaming pass, coarsest level first, while the others keep their residency.
+	 */
+	void AddViewGPUs(const FRHIGPUMask& InGPUMask);
+
+	/**
+	 * Dynamic resources only: decode the full detail level into the dynamic splat buffer once it is resident,
+	 * stage the pending partial updates through the upload ring (gs.DynamicUploadBufferMB) and run the deform pass.
+	 * Render thread, once per frame before any view data is computed.
+	 */
+	void UpdateDynamicSplats(FRDGBuilder& GraphBuilder, float WorldTimeSeconds);
+
+	/** Queue splats to overwrite in the dynamic splat buffer, uploaded in order by UpdateDynamicSplats */
+	void EnqueueDynamicUpdate(int32 FirstSplat, TArray<FGaussianSplatDynamicData>&& Splats);
+
+	/** Set the pass that deforms the dynamic splats every frame, unbound to stop deforming */
+	void SetDeformDelegate(const FGaussianSplatDeformDelegate& InDeformDelegate);
+
+	/** True for the unshared resources of a component with dynamic updates */
+	bool IsDynamic() const { return bDynamic; }
+
+	/** True once the dynamic splat buffer replaces the compressed streams of the full detail level */
+	bool HasDynamicSplats() const { return DynamicSplatBuffer.IsValid(); }
+
+	/** Splats CalcViewData reads while HasDynamicSplats: the deformed copy while a deform pass is bound */
+	const TRefCountPtr<FRDGPooledBuffer>& GetDynamicRenderBuffer() const { return DeformedSplatBuffer.IsValid() ? DeformedSplatBuffer : DynamicSplatBuffer; }
+
+	/** Changes whenever the dynamic splats change, so cached view data and sorts of them are recomputed */
+	uint32 GetDynamicRevision() const { return DynamicRevision; }
+
+	/** True once every page is uploaded to every GPU that renders these resources */
+	bool IsFullyResident() const { return NextPageIndex >= StreamingPages.Num() && NumPagesInFlight == 0; }
+
+	/** Number of splats at the start of a LOD level that are uploaded to every GPU in GPUMask and can be rendered there */
+	int32 GetResidentSplatCount(int32 LODIndex, const FRHIGPUMask& GPUMask) const;
+
+	/** True if any LOD level has splats to render on every GPU in GPUMask */
+	bool HasResidentSplats(const FRHIGPUMask& GPUMask) const;
+
 	/** Get number of splats */
 	int32 GetSplatCount() const { return SplatCount; }
 
+	/** Get number of chunks with bounds in ChunkBuffer */
+	int32 GetNumChunks() const { return NumChunks; }
+
+	/** GPU bytes held by the splat, chunk and index buffers. The color texture belongs to the asset and is counted by the texture stats. */
+	int64 GetGPUMemoryBytes() const;
+
 	//~ Begin FRenderResource Interface
 	virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
 	virtual void ReleaseRHI() override;
@@ -52,37 +308,6 @@ public:
 	FBufferRHIRef ChunkBuffer;
 	FShaderResourceViewRHIRef ChunkBufferSRV;
 
-	/** View data buffer (computed per-frame) */
-	FBufferRHIRef ViewDataBuffer;
-	FUnorderedAccessViewRHIRef ViewDataBufferUAV;
-	FShaderResourceViewRHIRef ViewDataBufferSRV;
-
-	/** Sort distance buffer */
-	FBufferRHIRef SortDistanceBuffer;
-	FUnorderedAccessViewRHIRef SortDistanceBufferUAV;
-	FShaderResourceViewRHIRef SortDistanceBufferSRV;
-
-	/** Sort keys buffer (double buffered) */
-	FBufferRHIRef SortKeysBuffer;
-	FUnorderedAccessViewRHIRef SortKeysBufferUAV;
-	FShaderResourceViewRHIRef SortKeysBufferSRV;
-
-	FBufferRHIRef SortKeysBufferAlt;
-	FUnorderedAccessViewRHIRef SortKeysBufferAltUAV;
-	FShaderResourceViewRHIRef SortKeysBufferAltSRV;
-
-	/** Sort distance buffer alt (for radix sort ping-pong) */
-	FBufferRHIRef SortDistanceBufferAlt;
-	FUnorderedAccessViewRHIRef SortDistanceBufferAltUAV;
-
-	/** Radix sort histogram buffer */
-	FBufferRHIRef RadixHistogramBuffer;
-	FUnorderedAccessViewRHIRef RadixHistogramBufferUAV;
-
-	/** Radix sort digit offset buffer */
-	FBufferRHIRef RadixDigitOffsetBuffer;
-	FUnorderedAccessViewRHIRef RadixDigitOffsetBufferUAV;
-
 	/** Index buffer for quad rendering */
 	FBufferRHIRef IndexBuffer;
 
@@ -106,37 +331,183 @@ public:
 	/** Get position format as uint for shader */
 	uint32 GetPositionFormatUint() const { return static_cast<uint32>(PositionFormat); }
 
+	/** Scale format used by this asset (same encodings as PositionFormat) */
+	EGaussianPositionFormat ScaleFormat = EGaussianPositionFormat::Float32;
+
+	/** Get scale format as uint for shader */
+	uint32 GetScaleFormatUint() const { return static_cast<uint32>(ScaleFormat); }
+
+	/** True when the other data holds precomputed 3D covariances instead of rotation and scale */
+	bool bPrecomputedCovariance = false;
+
+	/** SH format used by this asset */
+	EGaussianSHFormat SHFormat = EGaussianSHFormat::Float16;
+
+	/** Get SH format as uint for shader */
+	uint32 GetSHFormatUint() const { return static_cast<uint32>(SHFormat); }
+
+	/** Byte offsets of the SH band blocks in SHBuffer (see UGaussianSplatAsset::GetSHBandOffsets) */
+	FUintVector4 SHBandOffsets = FUintVector4(0, 0, 0, 0);
+
+	/** Number of SH bands present in SHBuffer (0-3) */
+	int32 UploadedSHBands = 0;
+
 private:
 	/** Create static buffers from asset data */
 	void CreateStaticBuffers(FRHICommandListBase& RHICmdList);
 
-	/** Create dynamic buffers for per-frame data */
-	void CreateDynamicBuffers(FRHICommandListBase& RHICmdList);
-
 	/** Create index buffer for quad rendering */
 	void CreateIndexBuffer(FRHICommandListBase& RHICmdList);
 
 	/** Create dummy white texture for fallback */
 	void CreateDummyWhiteTexture(FRHICommandListBase& RHICmdList);
 
+	/** Split the asset's LOD levels into streaming pages, coarsest level first */
+	void BuildStreamingPages();
+
+	/** Start the reads of a page, or upload it right away when its bulk data is in memory */
+	void IssuePage(FRHICommandListImmediate& RHICmdList, FGaussianSplatStreamingPage& Page);
+
+	/** Copy one completed range into its GPU buffer on the GPUs in GPUMask */
+	static void UploadCopy(FRHICommandListImmediate& RHICmdList, FGaussianSplatStreamingCopy& Copy, const FRHIGPUMask& GPUMask);
+
+	/** Recount the uploaded prefix of every LOD level on every GPU */
+	void UpdateResidentSplatCounts();
+
+	/** GPUs that render these resources but do not hold Page yet, as FRHIGPUMask::GetNative bits */
+	uint32 GetMissingGPUBits(const FGaussianSplatStreamingPage& Page) const;
+
+	/** Cancel the reads in flight and drop all pages */
+	void CancelStreaming();
+
+	/** Decode the resident full detail level into a new dynamic splat buffer */
+	void AddInitDynamicSplatsPass(FRDGBuilder& GraphBuilder, FRDGBufferRef SplatBuffer);
+
+	/** Copy as many pending updates as this frame's upload ring slice holds into the dynamic splat buffer */
+	void AddDynamicUploadPass(FRDGBuilder& GraphBuilder, FRDGBufferRef SplatBuffer);
+
+	/** Add buffer bytes to STAT_GaussianSplatStaticBufferMemory and TrackedBufferMemory */
+	void TrackBufferMemory(int64 Bytes);
+
 private:
-	/** Cached asset data for initialization */
-	TArray<uint8> CachedPositionData;
-	TArray<uint8> CachedOtherData;
-	TArray<uint8> CachedSHData;
+	/** Asset the splat buffers are streamed from, only dereferenced through its bulk data */
+	UGaussianSplatAsset* SourceAsset = nullptr;
+
+	/** Bulk data sizes the GPU buffers are created with */
+	int64 PositionDataSize = 0;
+	int64 OtherDataSize = 0;
+	int64 SHDataSize = 0;
+
+	/** Chunk bounds, uploaded with the buffers since every page's culling depends on them */
 	TArray<FGaussianChunkInfo> CachedChunkData;
 
+	/** Splat range of each LOD level, finest first */
+	TArray<FGaussianSplatLODLevel> LODLevels;
+
+	/** Pages in upload order */
+	TArray<FGaussianSplatStreamingPage> StreamingPages;
+	int32 NextPageIndex = 0;
+	int32 NumPagesInFlight = 0;
+
+	/** Uploaded prefix of each LOD level per GPU index, see GetResidentSplatCount */
+	TStaticArray<TArray<int32>, MAX_NUM_GPUS> ResidentSplatCounts;
+
+	/** GPUs whose view families render these resources, every page is uploaded to all of them */
+	TOptional<FRHIGPUMask> ViewGPUMask;
+
 	int32 SplatCount = 0;
+	int32 NumChunks = 0;
 	bool bInitialized = false;
 
+	/** Bytes added to STAT_GaussianSplatStaticBufferMemory */
+	int64 TrackedBufferMemory = 0;
+
+	/** Render thread frame UpdateStreaming last ran in, so shared resources stream once per frame */
+	uint64 LastStreamingFrame = MAX_uint64;
+
+	/** Dynamic splats: full detail splats as last updated, and their deformed copy while a deform pass is bound */
+	bool bDynamic = false;
+	TRefCountPtr<FRDGPooledBuffer> DynamicSplatBuffer;
+	TRefCountPtr<FRDGPooledBuffer> DeformedSplatBuffer;
+	FGaussianSplatDeformDelegate DeformDelegate;
+	TArray<FGaussianSplatDynamicUpdate> PendingDynamicUpdates;
+	uint32 DynamicRevision = 0;
+	uint64 LastDynamicUpdateFrame = MAX_uint64;
+
+	/**
+	 * Upload ring for the partial updates: every frame stages into its own slice, which is written again only
+	 * when the ring wraps around frames after its copy completed, so it is locked without synchronization
+	 */
+	FBufferRHIRef DynamicUploadBuffer;
+	uint32 DynamicUploadSliceSize = 0;
+};
+
+/**
+ * Render-thread cache of FGaussianSplatGPUResources keyed by asset data and uploaded SH bands.
+ * Entries are ref-counted: proxies of the same asset share one upload, and the resources are
+ * released with the last proxy that uses them.
+ */
+class FGaussianSplatGPUResourceCache
+{
 public:
-	/** Cached state for camera-static sort skipping */
-	FMatrix CachedViewProjectionMatrix = FMatrix::Identity;
-	FMatrix CachedLocalToWorld = FMatrix::Identity;
-	float CachedOpacityScale = -1.0f;
-	float CachedSplatScale = -1.0f;
-	bool CachedHasColorTexture = false;
-	bool bHasCachedSortData = false;
+	/**
+	 * Get the resources for an asset, creating and initializing them on first use
+	 * @param MaxSHOrder Highest SH band the caller evaluates (see FGaussianSplatGPUResources::Initialize)
+	 * @param bDynamic Create resources for the caller alone that dynamic updates can edit
+	 * @return Resources to hand back to Release, or nullptr if the asset has no data
+	 */
+	static FGaussianSplatGPUResources* Acquire(UGaussianSplatAsset* Asset, int32 MaxSHOrder, bool bDynamic = false);
+
+	/** Drop a reference returned by Acquire */
+	static void Release(FGaussianSplatGPUResources* Resources);
+
+	/** The shared resources Acquire would return for an asset without creating them, or nullptr if none exist */
+	static const FGaussianSplatGPUResources* Find(const UGaussianSplatAsset* Asset, int32 MaxSHOrder);
+
+	/** Describe every entry's buffer memory and references, one line each (see gs.ListResources) */
+	static void DescribeEntries(TArray<FString>& OutLines);
+
+private:
+	struct FEntry
+	{
+		uint32 RenderDataId = 0;
+		int32 SHBands = 0;
+		bool bDynamic = false;
+		int32 RefCount = 0;
+		FGaussianSplatGPUResources* Resources = nullptr;
+		FString AssetPath;
+	};
+
+	/** Shared (not dynamic) entry of an upload, or nullptr */
+	static FEntry* FindShared(uint32 RenderDataId, int32 SHBands);
+
+	static TArray<FEntry> Entries;
+};
+
+/**
+ * Depth-only stand-in of a proxy's splats for shadow casting (see UGaussianSplatAsset::ShadowSplats)
+ * One octahedron per shadow splat, in the component's local space. The splats are not sorted or blended,
+ * coverage below the alpha threshold was cut off at import, so the mesh renders opaque into any shadow depth.
+ */
+class FGaussianSplatShadowMesh
+{
+public:
+	FGaussianSplatShadowMesh(ERHIFeatureLevel::Type FeatureLevel);
+
+	/** Build the vertex and index data and queue their initialization, game thread */
+	void Init(TConstArrayView<FGaussianSplatShadowSplat> ShadowSplats);
+
+	/** Release the render resources, render thread */
+	void Release();
+
+	int32 GetNumSplats() const { return NumSplats; }
+
+	FStaticMeshVertexBuffers VertexBuffers;
+	FDynamicMeshIndexBuffer32 IndexBuffer;
+	FLocalVertexFactory VertexFactory;
+
+private:
+	int32 NumSplats = 0;
 };
 
 /**
@@ -166,10 +537,71 @@ public:
 	/** Get GPU resources */
 	FGaussianSplatGPUResources* GetGPUResources() const { return GPUResources; }
 
-	/** Try to initialize color texture SRV if not already done */
-	void TryInitializeColorTexture(FRHICommandListBase& RHICmdList);
+	/**
+	 * Find this proxy's per-view resources for a view (see FGaussianSplatViewResourceCache::FindOrAdd)
+	 * @return Per-view resources, or nullptr if the GPU resources are not initialized
+	 */
+	FGaussianSplatViewResources* FindOrAddViewResources(const FSceneView& View);
+
+	/** GPU bytes of this proxy's per-view buffers */
+	int64 GetViewGPUMemoryBytes() const { return ViewResourceCache.GetGPUMemoryBytes(); }
 
-	/** Get splat count */
+	/**
+	 * GPU memory budget (gs.GPUMemoryBudgetMB), render thread: a downgraded proxy renders its coarsest
+	 * LOD level, and its cached views are dropped so they are allocated again at that size
+	 */
+	void SetBudgetDowngraded_RenderThread(bool bInDowngraded);
+	bool IsBudgetDowngraded() const { return bBudgetDowngraded; }
+
+	/** View buffer bytes at full detail: while downgraded, what they held before, so the proxy is upgraded only once they fit */
+	int64 GetFullDetailViewGPUMemoryBytes() const { return bBudgetDowngraded ? FMath::Max(FullDetailViewGPUMemoryBytes, GetViewGPUMemoryBytes()) : GetViewGPUMemoryBytes(); }
+
+	/**
+	 * GPU memory budget, render thread: release the reference to the GPU resources, so the upload is freed
+	 * once no other proxy renders it, and render nothing until restored. Proxies with dynamic updates keep theirs.
+	 */
+	void EvictGPUResources_RenderThread();
+
+	/** Acquire the GPU resources again after EvictGPUResources_RenderThread, streaming starts over if they were freed */
+	void RestoreGPUResources_RenderThread(FRHICommandListBase& RHICmdList);
+	bool IsEvicted() const { return bEvicted; }
+
+	/** Bytes the GPU resources held when they were evicted, what restoring them costs if no other proxy holds them */
+	int64 GetEvictedGPUMemoryBytes() const { return EvictedGPUMemoryBytes; }
+
+	/** Get the asset the proxy renders */
+	const UGaussianSplatAsset* GetAsset() const { return CachedAsset; }
+
+	/**
+	 * Apply edited component parameters without recreating the proxy (render thread).
+	 * Only a higher SH order than the shared resources hold acquires new resources.
+	 */
+	void SetRenderParameters_RenderThread(int32 InSHOrder, float InOpacityScale, float InSplatScale, int32 InMaxSplatsPerView, bool bInEnableFrustumCulling);
+
+	/** Queue a partial update of the dynamic splats (see UGaussianSplatComponent::UpdateSplats), render thread */
+	void UpdateSplats_RenderThread(int32 FirstSplat, TArray<FGaussianSplatDynamicData>&& Splats);
+
+	/** Replace the deform pass (see UGaussianSplatComponent::SetDeformDelegate), render thread */
+	void SetDeformDelegate_RenderThread(const FGaussianSplatDeformDelegate& InDeformDelegate);
+
+	/** Try to initialize color texture SRV if not already done, returns false while the texture resource is still missing */
+	bool TryInitializeColorTexture(FRHICommandListBase& RHICmdList);
+
+	/** Check visibility flags, GPU resource readiness and the view frustum for a view */
+	bool IsRenderableInView(const FSceneView& View) const;
+
+	/**
+	 * Pick the LOD level to render in a view: the finest level within the splats the proxy's screen
+	 * footprint can use (gs.LODSplatsPerPixel) and the component's MaxSplatsPerView budget
+	 * @param OutSplatOffset First splat of the level in the GPU buffers
+	 * @param OutSplatCount Number of splats of the level
+	 */
+	void SelectLOD(const FSceneView& View, int32& OutSplatOffset, int32& OutSplatCount) const;
+
+	/** True for a component with dynamic updates, whose GPU resources are its own */
+	bool AllowsDynamicUpdates() const { return bAllowDynamicUpdates; }
+
+	/** Get full detail (LOD 0) splat count */
 	int32 GetSplatCount() const { return SplatCount; }
 
 	/** Get rendering parameters */
@@ -178,16 +610,40 @@ public:
 	float GetSplatScale() const { return SplatScale; }
 
 private:
-	/** GPU resources */
+	/** Acquire the GPU resources for the current SH order, shared unless the component has dynamic updates */
+	void AcquireGPUResources();
+
+	/** GPU resources, shared with other proxies of the asset (see FGaussianSplatGPUResourceCache) */
 	FGaussianSplatGPUResources* GPUResources = nullptr;
 
+	/** Per-view view data and sort results, one entry per recently rendered view */
+	FGaussianSplatViewResourceCache ViewResourceCache;
+
 	/** Cached asset for initialization */
 	UGaussianSplatAsset* CachedAsset = nullptr;
 
+	/** Splat range of each LOD level, finest first */
+	TArray<FGaussianSplatLODLevel> LODLevels;
+
 	/** Rendering parameters */
 	int32 SplatCount = 0;
+	int32 MaxSplatsPerView = 0;
 	int32 SHOrder = 3;
 	float OpacityScale = 1.0f;
 	float SplatScale = 1.0f;
 	bool bEnableFrustumCulling = true;
+
+	/** Dynamic updates: unshared GPU resources, and the deform pass they run */
+	bool bAllowDynamicUpdates = false;
+	FGaussianSplatDeformDelegate DeformDelegate;
+
+	/** GPU memory budget state, see SetBudgetDowngraded_RenderThread and EvictGPUResources_RenderThread */
+	bool bBudgetDowngraded = false;
+	bool bEvicted = false;
+	int64 FullDetailViewGPUMemoryBytes = 0;
+	int64 EvictedGPUMemoryBytes = 0;
+
+	/** Shadow casting stand-in, null when the asset has no shadow splats or the splats are dynamic */
+	TUniquePtr<FGaussianSplatShadowMesh> ShadowMesh;
+	const FMaterialRenderProxy* ShadowMaterial = nullptr;
 };
@@ -12,6 +12,7 @@
 /**
  * Compute shader for calculating view-dependent data for each Gaussian splat
  * This runs per-frame to transform splats to screen space and evaluate spherical harmonics
+ * With EmitSortKeys, splats that survive culling are also appended to the sort buffers, VisibleCountBuffer receives their count
  */
 class FGaussianSplatCalcViewDataCS : public FGlobalShader
 {
@@ -25,7 +26,15 @@ class FGaussianSplatCalcViewDataCS : public FGlobalShader
 		SHADER_PARAMETER_SRV(StructuredBuffer<FGaussianChunkInfo>, ChunkBuffer)
 		SHADER_PARAMETER_SRV(Texture2D, ColorTexture)
 		SHADER_PARAMETER_SAMPLER(SamplerState, ColorSampler)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DistanceBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, KeyBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, VisibleCountBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FUintVector2>, SHColorCache)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FVector4f>, SHCacheDirections)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, VisibleChunkList)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGaussianSplatDynamicData>, DynamicSplatBuffer)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
 		SHADER_PARAMETER(FMatrix44f, LocalToWorld)
 		SHADER_PARAMETER(FMatrix44f, WorldToClip)
 		SHADER_PARAMETER(FMatrix44f, WorldToView)
@@ -33,12 +42,37 @@ class FGaussianSplatCalcViewDataCS : public FGlobalShader
 		SHADER_PARAMETER(FVector2f, ScreenSize)
 		SHADER_PARAMETER(FVector2f, FocalLength)
 		SHADER_PARAMETER(uint32, SplatCount)
+		SHADER_PARAMETER(uint32, SplatOffset)
+		SHADER_PARAMETER(uint32, ViewDataOffset)
 		SHADER_PARAMETER(uint32, SHOrder)
 		SHADER_PARAMETER(float, OpacityScale)
 		SHADER_PARAMETER(float, SplatScale)
 		SHADER_PARAMETER(FIntPoint, ColorTextureSize)
 		SHADER_PARAMETER(uint32, PositionFormat)
+		SHADER_PARAMETER(uint32, ScaleFormat)
+		SHADER_PARAMETER(uint32, PrecomputedCovariance)
+		SHADER_PARAMETER(uint32, UseDynamicSplats)
+		SHADER_PARAMETER(uint32, SHFormat)
+		SHADER_PARAMETER(FUintVector4, SHBandOffsets)
 		SHADER_PARAMETER(uint32, UseDefaultColor)  // 1 = use default color (no texture), 0 = use texture
+		SHADER_PARAMETER(uint32, UseSHCache)
+		SHADER_PARAMETER(float, SHCacheCosAngle)
+		SHADER_PARAMETER(uint32, EmitSortKeys)
+		SHADER_PARAMETER(uint32, SortKeyBits)
+		SHADER_PARAMETER(float, DepthRangeNear)
+		SHADER_PARAMETER(float, DepthRangeInvLength)
+		SHADER_PARAMETER(uint32, StereoCull)
+		SHADER_PARAMETER(FMatrix44f, StereoWorldToClip)
+		SHADER_PARAMETER(float, FoveationInnerRadius)
+		SHADER_PARAMETER(float, FoveationMinPixelSize)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, HZBTexture)
+		SHADER_PARAMETER(uint32, UseOcclusionCulling)
+		SHADER_PARAMETER(FMatrix44f, HZBWorldToClip)
+		SHADER_PARAMETER(FVector2f, HZBProjectionScale)
+		SHADER_PARAMETER(FVector2f, HZBDeviceZParams)
+		SHADER_PARAMETER(FVector2f, HZBUVToTexel)
+		SHADER_PARAMETER(FUintVector2, HZBSize)
+		SHADER_PARAMETER(uint32, HZBNumMips)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -54,18 +88,349 @@ class FGaussianSplatCalcViewDataCS : public FGlobalShader
 };
 
 /**
- * Compute shader for calculating sort distances (depth) for each splat
+ * Frustum-culls splat chunks against their bounds, one thread per chunk
+ * With StereoCull, a chunk is visible if either eye of a shared stereo sort sees it
+ * Writes the list of visible chunks and the indirect args CalcViewData is dispatched with (one group per chunk)
  */
-class FGaussianSplatCalcDistancesCS : public FGlobalShader
+class FGaussianSplatCullChunksCS : public FGlobalShader
 {
-	DECLARE_GLOBAL_SHADER(FGaussianSplatCalcDistancesCS);
-	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatCalcDistancesCS, FGlobalShader);
+	DECLARE_GLOBAL_SHADER(FGaussianSplatCullChunksCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatCullChunksCS, FGlobalShader);
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, DistanceBuffer)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, KeyBuffer)
+		SHADER_PARAMETER_SRV(StructuredBuffer<FGaussianChunkInfo>, ChunkBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, VisibleChunkList)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, ChunkDispatchArgs)
+		SHADER_PARAMETER(FMatrix44f, LocalToClip)
+		SHADER_PARAMETER(FMatrix44f, StereoLocalToClip)
+		SHADER_PARAMETER(uint32, StereoCull)
+		SHADER_PARAMETER(uint32, NumChunks)
+		SHADER_PARAMETER(uint32, ChunkOffset)
+		SHADER_PARAMETER(float, SplatScale)
+		SHADER_PARAMETER(uint32, CullingEnabled)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), 64);
+	}
+};
+
+/**
+ * Refines last frame's sorted order against the current view data with a bitonic sort per tile
+ * Used instead of a full sort while the camera stays within gs.SortReuseDistance / gs.SortReuseAngle
+ */
+class FGaussianSplatRefineSortCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatRefineSortCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatRefineSortCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SortKeysBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, DrawArgs)
+		SHADER_PARAMETER(uint32, SortKeyBits)
+		SHADER_PARAMETER(float, DepthRangeNear)
+		SHADER_PARAMETER(float, DepthRangeInvLength)
+		SHADER_PARAMETER(uint32, TileOffset)
+		SHADER_PARAMETER(FVector4f, InvDeviceZToViewDepth)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("REFINE_SORT_CS"), 1);
+	}
+};
+
+/**
+ * Turns the visible splat count into dispatch args for the radix sort and draw args for the splat draw
+ */
+class FGaussianSplatBuildIndirectArgsCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatBuildIndirectArgsCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatBuildIndirectArgsCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, VisibleCountBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, SortDispatchArgs)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, DrawArgs)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("BUILD_INDIRECT_ARGS_CS"), 1);
+	}
+};
+
+/**
+ * Tile rasterizer: counts the screen tiles each sorted splat overlaps and scans the counts within a group
+ */
+class FGaussianSplatTileCountCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatTileCountCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatTileCountCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortKeysBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, DrawArgs)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, EntryOffsets)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, GroupTotals)
+		SHADER_PARAMETER(FUintVector2, ViewSize)
+		SHADER_PARAMETER(FUintVector2, NumTiles)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("TILE_SIZE"), GaussianSplattingConstants::MortonTileSize);
+		OutEnvironment.SetDefine(TEXT("TILE_COUNT_CS"), 1);
+	}
+};
+
+/**
+ * Tile rasterizer: prefix sum of the per-group tile counts, writes the entry count and the sort dispatch args
+ */
+class FGaussianSplatTileScanCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatTileScanCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatTileScanCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, GroupTotals)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, EntryCountBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, SortDispatchArgs)
+		SHADER_PARAMETER(uint32, NumGroups)
+		SHADER_PARAMETER(uint32, MaxEntries)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("TILE_SIZE"), GaussianSplattingConstants::MortonTileSize);
+		OutEnvironment.SetDefine(TEXT("TILE_SCAN_CS"), 1);
+	}
+};
+
+/**
+ * Tile rasterizer: writes one (tile, splat) entry per overlapped tile in sorted splat order
+ */
+class FGaussianSplatTileEmitCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatTileEmitCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatTileEmitCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortKeysBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, DrawArgs)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, EntryOffsets)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, GroupTotals)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, TileKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, TileValues)
+		SHADER_PARAMETER(FUintVector2, ViewSize)
+		SHADER_PARAMETER(FUintVector2, NumTiles)
+		SHADER_PARAMETER(uint32, MaxEntries)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("TILE_SIZE"), GaussianSplattingConstants::MortonTileSize);
+		OutEnvironment.SetDefine(TEXT("TILE_EMIT_CS"), 1);
+	}
+};
+
+/**
+ * Tile rasterizer: finds each tile's range in the entries sorted by tile
+ */
+class FGaussianSplatTileRangesCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatTileRangesCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatTileRangesCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, TileKeys)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, EntryCountBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, TileRanges)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("TILE_SIZE"), GaussianSplattingConstants::MortonTileSize);
+		OutEnvironment.SetDefine(TEXT("TILE_RANGES_CS"), 1);
+	}
+};
+
+/**
+ * Tile rasterizer: one group per tile blends the tile's splats front-to-back into scene color,
+ * stopping once every pixel of the tile is opaque
+ */
+class FGaussianSplatTileRasterizeCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatTileRasterizeCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatTileRasterizeCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, TileValues)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, TileRanges)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneDepthTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, SceneColor)
+		SHADER_PARAMETER(FUintVector2, ViewMin)
+		SHADER_PARAMETER(FUintVector2, ViewSize)
+		SHADER_PARAMETER(FUintVector2, NumTiles)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("TILE_SIZE"), GaussianSplattingConstants::MortonTileSize);
+		OutEnvironment.SetDefine(TEXT("TILE_RASTERIZE_CS"), 1);
+	}
+};
+
+/**
+ * Writes the foveated shading rate image of the splat draw (gs.FoveationVRS), one texel per shading rate tile
+ */
+class FGaussianSplatFoveationRateCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatFoveationRateCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatFoveationRateCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, RWShadingRateImage)
+		SHADER_PARAMETER(FUintVector2, ImageSize)
+		SHADER_PARAMETER(FUintVector2, TileSize)
+		SHADER_PARAMETER(FVector2f, ViewMin)
+		SHADER_PARAMETER(FVector2f, ViewSize)
+		SHADER_PARAMETER(float, InnerRadius)
+		SHADER_PARAMETER(float, OuterRadius)
+		SHADER_PARAMETER(uint32, CoarseRate)
+		SHADER_PARAMETER(uint32, CoarsestRate)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/**
+ * Builds mip 0 of the occlusion HZB (gs.OcclusionCulling) from the scene depth, one texel per 4x4 pixels of the view
+ * Each texel holds the farthest device Z of its pixels
+ */
+class FGaussianSplatHZBFromDepthCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatHZBFromDepthCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatHZBFromDepthCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneDepthTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWHZB)
+		SHADER_PARAMETER(FUintVector2, ViewMin)
+		SHADER_PARAMETER(FUintVector2, ViewSize)
+		SHADER_PARAMETER(FUintVector2, OutputSize)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("HZB_FROM_DEPTH_CS"), 1);
+	}
+};
+
+/**
+ * Reduces one occlusion HZB mip into the next, each texel the farthest of the 2x2 parent texels it covers
+ */
+class FGaussianSplatHZBDownsampleCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatHZBDownsampleCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatHZBDownsampleCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D<float>, ParentMip)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, RWHZB)
+		SHADER_PARAMETER(FUintVector2, ParentSize)
+		SHADER_PARAMETER(FUintVector2, OutputSize)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/**
+ * Decodes an asset's full detail level into the writable splat buffer of a dynamic component, one thread per splat
+ * See FGaussianSplatGPUResources::UpdateDynamicSplats
+ */
+class FGaussianSplatInitDynamicSplatsCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatInitDynamicSplatsCS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatInitDynamicSplatsCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_SRV(ByteAddressBuffer, PositionBuffer)
+		SHADER_PARAMETER_SRV(ByteAddressBuffer, OtherDataBuffer)
+		SHADER_PARAMETER_SRV(StructuredBuffer<FGaussianChunkInfo>, ChunkBuffer)
+		SHADER_PARAMETER_SRV(Texture2D, ColorTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, ColorSampler)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FGaussianSplatDynamicData>, DynamicSplatBuffer)
 		SHADER_PARAMETER(uint32, SplatCount)
+		SHADER_PARAMETER(FIntPoint, ColorTextureSize)
+		SHADER_PARAMETER(uint32, PositionFormat)
+		SHADER_PARAMETER(uint32, ScaleFormat)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -76,7 +441,7 @@ class FGaussianSplatCalcDistancesCS : public FGlobalShader
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
 	{
 		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
-		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), 256);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), 64);
 	}
 };
 
@@ -89,8 +454,8 @@ class FGaussianSplatVS : public FGlobalShader
 	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatVS, FGlobalShader);
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
-		SHADER_PARAMETER_SRV(StructuredBuffer<uint>, SortKeysBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FGaussianSplatViewData>, ViewDataBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortKeysBuffer)
 		SHADER_PARAMETER(uint32, SplatCount)
 	END_SHADER_PARAMETER_STRUCT()
 
@@ -118,8 +483,28 @@ class FGaussianSplatPS : public FGlobalShader
 	}
 };
 
+/**
+ * Depth-only pixel shader of the splat depth write (gs.SplatDepthWrite)
+ * Keeps the pixels of a quad whose gaussian alpha reaches DepthWriteAlphaThreshold, at the splat center's depth
+ */
+class FGaussianSplatDepthPS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FGaussianSplatDepthPS);
+	SHADER_USE_PARAMETER_STRUCT(FGaussianSplatDepthPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(float, DepthWriteAlphaThreshold)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
 /**
  * Radix sort - CountCS: per-tile histogram of 256 digit bins
+ * Dispatched indirectly over the tiles of the visible splat count (see FGaussianSplatBuildIndirectArgsCS)
  */
 class FRadixSortCountCS : public FGlobalShader
 {
@@ -127,11 +512,11 @@ class FRadixSortCountCS : public FGlobalShader
 	SHADER_USE_PARAMETER_STRUCT(FRadixSortCountCS, FGlobalShader);
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, HistogramBuffer)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, SrcKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, HistogramBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SrcKeys)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCountBuffer)
 		SHADER_PARAMETER(uint32, RadixShift)
-		SHADER_PARAMETER(uint32, Count)
-		SHADER_PARAMETER(uint32, NumTiles)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -155,9 +540,9 @@ class FRadixSortPrefixSumCS : public FGlobalShader
 	SHADER_USE_PARAMETER_STRUCT(FRadixSortPrefixSumCS, FGlobalShader);
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, HistogramBuffer)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, DigitOffsetBuffer)
-		SHADER_PARAMETER(uint32, NumTiles)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, HistogramBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DigitOffsetBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCountBuffer)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -181,7 +566,7 @@ class FRadixSortDigitPrefixSumCS : public FGlobalShader
 	SHADER_USE_PARAMETER_STRUCT(FRadixSortDigitPrefixSumCS, FGlobalShader);
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, DigitOffsetBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DigitOffsetBuffer)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -205,15 +590,15 @@ class FRadixSortScatterCS : public FGlobalShader
 	SHADER_USE_PARAMETER_STRUCT(FRadixSortScatterCS, FGlobalShader);
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, SrcKeys)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, SrcVals)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, DstKeys)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, DstVals)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, HistogramBuffer)
-		SHADER_PARAMETER_UAV(RWStructuredBuffer<uint>, DigitOffsetBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SrcKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SrcVals)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DstKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DstVals)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, HistogramBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DigitOffsetBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCountBuffer)
 		SHADER_PARAMETER(uint32, RadixShift)
-		SHADER_PARAMETER(uint32, Count)
-		SHADER_PARAMETER(uint32, NumTiles)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -227,3 +612,93 @@ class FRadixSortScatterCS : public FGlobalShader
 		OutEnvironment.SetDefine(TEXT("SCATTER_CS"), 1);
 	}
 };
+
+/**
+ * OneSweep radix sort - HistogramCS: digit histograms of every pass in one read of the keys
+ */
+class FRadixSortOneSweepHistogramCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FRadixSortOneSweepHistogramCS);
+	SHADER_USE_PARAMETER_STRUCT(FRadixSortOneSweepHistogramCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, GlobalHistogramBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SrcKeys)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCountBuffer)
+		SHADER_PARAMETER(uint32, NumPasses)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("ONESWEEP_HISTOGRAM_CS"), 1);
+	}
+};
+
+/**
+ * OneSweep radix sort - HistogramScanCS: exclusive prefix sum of each pass' digit totals
+ */
+class FRadixSortOneSweepHistogramScanCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FRadixSortOneSweepHistogramScanCS);
+	SHADER_USE_PARAMETER_STRUCT(FRadixSortOneSweepHistogramScanCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, GlobalHistogramBuffer)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("ONESWEEP_HISTOGRAM_SCAN_CS"), 1);
+	}
+};
+
+/**
+ * OneSweep radix sort - ScatterCS: wave multi-split ranking plus decoupled lookback, one dispatch per digit
+ * Only compiled for platforms with wave operations
+ */
+class FRadixSortOneSweepScatterCS : public FGlobalShader
+{
+	DECLARE_GLOBAL_SHADER(FRadixSortOneSweepScatterCS);
+	SHADER_USE_PARAMETER_STRUCT(FRadixSortOneSweepScatterCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SrcKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, SrcVals)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DstKeys)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, DstVals)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, GlobalHistogramBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, TileStatusBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, TileCounterBuffer)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, SortCountBuffer)
+		SHADER_PARAMETER(uint32, RadixShift)
+		SHADER_PARAMETER(uint32, PassIndex)
+		SHADER_PARAMETER(uint32, MaxTiles)
+		RDG_BUFFER_ACCESS(IndirectArgs, ERHIAccess::IndirectArgs)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5) &&
+			FDataDrivenShaderPlatformInfo::GetSupportsWaveOperations(Parameters.Platform) != ERHIFeatureSupport::Unsupported;
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("ONESWEEP_SCATTER_CS"), 1);
+		OutEnvironment.CompilerFlags.Add(CFLAG_WaveOperations);
+	}
+};
@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/SoftObjectPtr.h"
+#include "GaussianDataTypes.h"
+#include "GaussianSplatTileSet.generated.h"
+
+class UGaussianSplatAsset;
+
+/**
+ * One cell of a tile set: a splat asset of its own, loaded on demand
+ */
+USTRUCT(BlueprintType)
+struct GAUSSIANSPLATTING_API FGaussianSplatTile
+{
+	GENERATED_BODY()
+
+	/** Grid cell, in tile sizes from the origin */
+	UPROPERTY(VisibleAnywhere, Category = "Tile")
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	/** Bounding box of the tile's splats, in the tile set's space */
+	UPROPERTY(VisibleAnywhere, Category = "Tile")
+	FBox Bounds = FBox(ForceInit);
+
+	/** Number of imported (full detail) splats */
+	UPROPERTY(VisibleAnywhere, Category = "Tile")
+	int32 SplatCount = 0;
+
+	/** Memory of the tile asset's splat data, what the tile costs against a streaming budget once resident */
+	UPROPERTY(VisibleAnywhere, Category = "Tile")
+	int64 MemoryBytes = 0;
+
+	/** The tile's splats, kept in their own package */
+	UPROPERTY(VisibleAnywhere, Category = "Tile")
+	TSoftObjectPtr<UGaussianSplatAsset> Asset;
+};
+
+/**
+ * Capture split at import into a grid of splat assets, for scenes too large to keep resident at once.
+ * All tiles share the source's space, so they render in place under one transform.
+ * UGaussianSplatTileSetComponent streams them in and out by camera distance.
+ */
+UCLASS(BlueprintType, hidecategories = Object)
+class GAUSSIANSPLATTING_API UGaussianSplatTileSet : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the number of imported splats over all tiles */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int64 GetSplatCount() const { return SplatCount; }
+
+	/** Get the bounding box of all tiles */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	FBox GetBounds() const { return BoundingBox; }
+
+	/** Get the memory of every tile's splat data, all tiles resident */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int64 GetMemoryUsage() const;
+
+public:
+	/** Non-empty grid cells */
+	UPROPERTY(VisibleAnywhere, Category = "Info")
+	TArray<FGaussianSplatTile> Tiles;
+
+	/** Number of imported splats over all tiles */
+	UPROPERTY(VisibleAnywhere, Category = "Info")
+	int64 SplatCount = 0;
+
+	/** Bounding box of all tiles */
+	UPROPERTY(VisibleAnywhere, Category = "Info")
+	FBox BoundingBox = FBox(ForceInit);
+
+	/** Source file path (for reimport) */
+	UPROPERTY(VisibleAnywhere, Category = "Import")
+	FString SourceFilePath;
+
+	/** Hash of the source file contents at import */
+	UPROPERTY(VisibleAnywhere, Category = "Import")
+	FString SourceFileHash;
+
+	/** Quality level of every tile (applied on reimport) */
+	UPROPERTY(EditAnywhere, Category = "Import")
+	EGaussianQualityLevel ImportQuality = EGaussianQualityLevel::Medium;
+
+	/** Edge length of the grid cells in the XY plane (applied on reimport) */
+	UPROPERTY(EditAnywhere, Category = "Import", meta = (ClampMin = "100.0", Units = "cm"))
+	float TileSize = 10000.0f;
+};
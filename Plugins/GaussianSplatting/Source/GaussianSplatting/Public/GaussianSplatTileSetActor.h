@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "GaussianSplatTileSetActor.generated.h"
+
+class UGaussianSplatTileSetComponent;
+
+/**
+ * Actor for placing a tiled Gaussian Splat capture in the level, its tiles stream around the cameras.
+ */
+UCLASS()
+class GAUSSIANSPLATTING_API AGaussianSplatTileSetActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGaussianSplatTileSetActor();
+
+	/** The tile streaming component */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Gaussian Splatting")
+	TObjectPtr<UGaussianSplatTileSetComponent> TileSetComponent;
+};
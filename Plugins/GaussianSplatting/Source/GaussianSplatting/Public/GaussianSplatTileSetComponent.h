@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "GaussianSplatTileSetComponent.generated.h"
+
+class UGaussianSplatAsset;
+class UGaussianSplatTileSet;
+class UGaussianSplatComponent;
+
+/**
+ * Streams the tiles of a Gaussian Splat Tile Set around the cameras that rendered the world last frame.
+ * Tiles are ranked by distance to the nearest camera and kept resident nearest first, within StreamingDistance
+ * and StreamingBudgetMB. Each resident tile is an attached UGaussianSplatComponent, so with gs.BatchProxies
+ * every resident tile of a view is sorted and drawn together.
+ */
+UCLASS(ClassGroup = (Rendering), meta = (BlueprintSpawnableComponent))
+class GAUSSIANSPLATTING_API UGaussianSplatTileSetComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UGaussianSplatTileSetComponent(const FObjectInitializer& ObjectInitializer);
+
+	//~ Begin UObject Interface
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
+	//~ Begin UActorComponent Interface
+	virtual void OnUnregister() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	//~ End UActorComponent Interface
+
+	//~ Begin USceneComponent Interface
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	//~ End USceneComponent Interface
+
+	/** Set the tile set to stream, releasing every tile of the previous one */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	void SetTileSet(UGaussianSplatTileSet* NewTileSet);
+
+	/** Get the number of tiles currently rendered */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int32 GetNumResidentTiles() const;
+
+	/** Get the budgeted memory of the tiles currently rendered, in bytes */
+	UFUNCTION(BlueprintCallable, Category = "Gaussian Splatting")
+	int64 GetResidentMemoryBytes() const;
+
+public:
+	/** The tile set to stream */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gaussian Splatting")
+	TObjectPtr<UGaussianSplatTileSet> TileSet;
+
+	/** Tiles farther than this from every camera are released. 0 = no distance limit, only the budget applies. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Streaming", meta = (ClampMin = "0.0", Units = "cm"))
+	float StreamingDistance = 50000.0f;
+
+	/** Memory the resident tiles may take together, the nearest tiles that fit are kept. 0 = no budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Streaming", meta = (ClampMin = "0"))
+	int32 StreamingBudgetMB = 1024;
+
+	/** Spherical Harmonic order of every tile (0-3) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Quality", meta = (ClampMin = "0", ClampMax = "3"))
+	int32 SHOrder = 3;
+
+	/** Global opacity multiplier of every tile */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Rendering", meta = (ClampMin = "0.0", ClampMax = "2.0"))
+	float OpacityScale = 1.0f;
+
+	/** Scale multiplier for the splat sizes of every tile */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Rendering", meta = (ClampMin = "0.1", ClampMax = "10.0"))
+	float SplatScale = 1.0f;
+
+	/** Maximum splats each tile renders per view, coarser LOD levels are used to stay within it. 0 = no budget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Performance", meta = (ClampMin = "0"))
+	int32 MaxSplatsPerView = 0;
+
+	/** Cast shadows from the tiles' shadow proxies */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gaussian Splatting|Rendering")
+	bool bCastShadow = true;
+
+private:
+	/** Rank the tiles, release the ones no longer wanted and attach or start loading the wanted ones */
+	void UpdateStreaming();
+
+	/** Render a loaded tile */
+	void AddTileComponent(int32 TileIndex, UGaussianSplatAsset* Asset);
+
+	/** Stop rendering a tile, its asset is freed by garbage collection once nothing else references it */
+	void ReleaseTile(int32 TileIndex);
+
+	/** Release every tile */
+	void ReleaseAllTiles();
+
+	/** Copy the rendering settings to a tile component */
+	void ApplyTileSettings(UGaussianSplatComponent* Component) const;
+
+	/** Component rendering each tile, null while the tile is not resident */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGaussianSplatComponent>> TileComponents;
+
+	/** Tile assets whose async load completed, kept alive until the next update attaches or drops them */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGaussianSplatAsset>> LoadedTileAssets;
+
+	/** Tiles with an async package load in flight */
+	TSet<int32> PendingLoads;
+};
@@ -4,13 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "SceneViewExtension.h"
+#include "GaussianSplatRenderer.h"
+#include <atomic>
 
 class FGaussianSplatSceneProxy;
+class FGaussianSplatViewResources;
+class FGaussianSplatViewResourceCache;
 
 /**
  * Scene View Extension for Gaussian Splatting
- * Manages registration of Gaussian Splat scene proxies.
- * Actual rendering is handled by PostOpaqueRenderDelegate in FGaussianSplattingModule.
+ * Manages registration of Gaussian Splat scene proxies and queues their view data/sort
+ * passes in PreRenderView_RenderThread. Drawing is handled by PostOpaqueRenderDelegate
+ * in FGaussianSplattingModule.
+ *
+ * The proxy registry is owned by the render thread: proxies register from their render thread
+ * resource callbacks and every render hook reads the array in place, without a lock or a copy.
  */
 class GAUSSIANSPLATTING_API FGaussianSplatViewExtension : public FSceneViewExtensionBase
 {
@@ -34,27 +42,60 @@ public:
 	virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override;
 	//~ End ISceneViewExtension Interface
 
-	/** Register a scene proxy for rendering */
+	/** Register a scene proxy for rendering (render thread only) */
 	void RegisterProxy(FGaussianSplatSceneProxy* Proxy);
 
-	/** Unregister a scene proxy */
+	/** Unregister a scene proxy (render thread only) */
 	void UnregisterProxy(FGaussianSplatSceneProxy* Proxy);
 
+	/** Retry the proxy's color texture SRV at the start of each view family until its texture resource exists (render thread only) */
+	void RequestColorTextureInit(FGaussianSplatSceneProxy* Proxy);
+
 	/** Get the singleton instance */
 	static FGaussianSplatViewExtension* Get();
 
-	/** Get registered proxies for external rendering */
-	void GetRegisteredProxies(TArray<FGaussianSplatSceneProxy*>& OutProxies) const;
+	/** Registered proxies for external rendering (render thread only) */
+	TConstArrayView<FGaussianSplatSceneProxy*> GetRegisteredProxies() const;
+
+	/** Scene-level view data and sort buffers used when proxies are batched (render thread only) */
+	FGaussianSplatViewResources* FindOrAddBatchViewResources(const FSceneView& View);
+
+	/** The view's occlusion HZB to rebuild from this frame's depth (render thread only) */
+	FGaussianSplatOcclusionHZB& FindOrAddOcclusionHZB(const FSceneView& View);
 
-	/** Get proxy lock for thread-safe access */
-	FCriticalSection& GetProxyLock() const { return ProxyLock; }
+	/** The view's occlusion HZB if it was built this or the previous frame on the view's GPUs, else null (render thread only) */
+	const FGaussianSplatOcclusionHZB* FindOcclusionHZB(const FSceneView& View) const;
+
+	/** Describe the GPU memory of every upload, proxy and the batched view buffers, one line each (render thread only, see gs.ListResources) */
+	void DescribeResources(TArray<FString>& OutLines) const;
 
 private:
-	/** Registered scene proxies */
+	/** Create the SRVs of proxies whose color texture resource has become available */
+	void InitializePendingColorTextures(FRHICommandListBase& RHICmdList);
+
+	/**
+	 * Keep the splat GPU memory within gs.GPUMemoryBudgetMB, once per frame: proxies nearest to the view family's
+	 * views render in full, the ones beyond the budget are downgraded where that saves memory and evicted otherwise
+	 */
+	void EnforceMemoryBudget(FRHICommandListBase& RHICmdList, const FSceneViewFamily& ViewFamily);
+
+	/** Registered scene proxies, owned by the render thread */
 	TArray<FGaussianSplatSceneProxy*> RegisteredProxies;
 
-	/** Critical section for thread-safe proxy access */
-	mutable FCriticalSection ProxyLock;
+	/** Registered proxies still waiting for their color texture resource, owned by the render thread */
+	TArray<FGaussianSplatSceneProxy*> PendingColorTextureProxies;
+
+	/** Mirror of RegisteredProxies.Num() for IsActiveThisFrame on the game thread */
+	std::atomic<int32> NumRegisteredProxies{0};
+
+	/** Per-view buffers shared by all proxies in batched mode, owned by the render thread */
+	TUniquePtr<FGaussianSplatViewResourceCache> BatchViewResources;
+
+	/** Occlusion HZB per view key (gs.OcclusionCulling), owned by the render thread */
+	TMap<uint32, FGaussianSplatOcclusionHZB> OcclusionHZBs;
+
+	/** Render thread frame EnforceMemoryBudget last ran in */
+	uint64 LastMemoryBudgetFrame = MAX_uint64;
 
 	/** Singleton instance */
 	static FGaussianSplatViewExtension* Instance;
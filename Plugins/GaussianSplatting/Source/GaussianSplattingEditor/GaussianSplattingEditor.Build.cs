@@ -35,9 +35,12 @@ public class GaussianSplattingEditor : ModuleRules
 				"SlateCore",
 				"UnrealEd",
 				"AssetTools",
+				"AssetRegistry",
 				"EditorFramework",
 				"Projects",
-				"ToolMenus"
+				"ToolMenus",
+				"RenderCore",
+				"RHI"
 			}
 		);
 
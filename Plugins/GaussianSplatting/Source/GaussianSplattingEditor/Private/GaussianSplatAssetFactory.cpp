@@ -2,10 +2,73 @@
 
 #include "GaussianSplatAssetFactory.h"
 #include "GaussianSplatAsset.h"
+#include "GaussianSplatTileSet.h"
 #include "PLYFileReader.h"
 #include "EditorFramework/AssetImportData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/FeedbackContext.h"
+#include "Misc/PackageName.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/SecureHash.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/Package.h"
+
+static TAutoConsoleVariable<float> CVarGaussianSplatImportTileSize(
+	TEXT("gs.ImportTileSize"),
+	0.0f,
+	TEXT("Split new PLY imports into a Gaussian Splat Tile Set of XY grid cells this large (cm), one splat asset per cell.\n")
+	TEXT("0 = import a single Gaussian Splat asset (default). Reimported tile sets keep their own Tile Size."),
+	ECVF_Default);
+
+/** Most grid cells a tiled import may span, so a tile size far too small for the capture fails instead of creating millions of packages */
+static constexpr int64 MaxImportTileCells = 65536;
+
+/** Splat bytes a tiled import buffers across its tiles before spilling them to temp files */
+static constexpr int64 MaxImportBufferedBytes = 512 * 1024 * 1024;
+
+void UGaussianSplatAssetFactory::SortSplatsMorton(TArray<FGaussianSplatData>& Splats)
+{
+	const int32 NumSplats = Splats.Num();
+	if (NumSplats <= GaussianSplattingConstants::SplatsPerChunk)
+	{
+		return;
+	}
+
+	FBox3f Bounds(ForceInit);
+	for (const FGaussianSplatData& Splat : Splats)
+	{
+		Bounds += Splat.Position;
+	}
+	const FVector3f Extent = FVector3f::Max(Bounds.GetSize(), FVector3f(UE_KINDA_SMALL_NUMBER));
+	const FVector3f Scale = FVector3f(1023.0f) / Extent;
+
+	// Morton code in the high bits, original index in the low bits keeps the order stable
+	TArray<uint64> Keys;
+	Keys.SetNumUninitialized(NumSplats);
+	ParallelFor(NumSplats, [&](int32 Index)
+	{
+		const FVector3f Cell = (Splats[Index].Position - Bounds.Min) * Scale;
+		const uint32 Code = GaussianSplattingUtils::EncodeMorton3D(
+			(uint32)FMath::Clamp(Cell.X, 0.0f, 1023.0f),
+			(uint32)FMath::Clamp(Cell.Y, 0.0f, 1023.0f),
+			(uint32)FMath::Clamp(Cell.Z, 0.0f, 1023.0f));
+		Keys[Index] = ((uint64)Code << 32) | (uint32)Index;
+	});
+	Keys.Sort();
+
+	TArray<FGaussianSplatData> Sorted;
+	Sorted.SetNumUninitialized(NumSplats);
+	ParallelFor(NumSplats, [&](int32 Index)
+	{
+		Sorted[Index] = Splats[(int32)(Keys[Index] & 0xFFFFFFFF)];
+	});
+	Splats = MoveTemp(Sorted);
+}
 
 UGaussianSplatAssetFactory::UGaussianSplatAssetFactory()
 {
@@ -36,7 +99,10 @@ UObject* UGaussianSplatAssetFactory::FactoryCreateFile(
 {
 	bOutOperationCanceled = false;
 
-	UGaussianSplatAsset* NewAsset = ImportPLYFile(Filename, InParent, InName, Flags, nullptr);
+	const float TileSize = CVarGaussianSplatImportTileSize.GetValueOnGameThread();
+	UObject* NewAsset = TileSize > 0.0f
+		? static_cast<UObject*>(ImportTiledPLYFile(Filename, InParent, InName, Flags, TileSize, nullptr))
+		: ImportPLYFile(Filename, InParent, InName, Flags, nullptr);
 
 	if (!NewAsset)
 	{
@@ -62,38 +128,61 @@ bool UGaussianSplatAssetFactory::CanReimport(UObject* Obj, TArray<FString>& OutF
 		OutFilenames.Add(Asset->SourceFilePath);
 		return true;
 	}
+	UGaussianSplatTileSet* TileSet = Cast<UGaussianSplatTileSet>(Obj);
+	if (TileSet && !TileSet->SourceFilePath.IsEmpty())
+	{
+		OutFilenames.Add(TileSet->SourceFilePath);
+		return true;
+	}
 	return false;
 }
 
 void UGaussianSplatAssetFactory::SetReimportPaths(UObject* Obj, const TArray<FString>& NewReimportPaths)
 {
-	UGaussianSplatAsset* Asset = Cast<UGaussianSplatAsset>(Obj);
-	if (Asset && NewReimportPaths.Num() > 0)
+	if (NewReimportPaths.Num() == 0)
+	{
+		return;
+	}
+	if (UGaussianSplatAsset* Asset = Cast<UGaussianSplatAsset>(Obj))
 	{
 		Asset->SourceFilePath = NewReimportPaths[0];
 	}
+	else if (UGaussianSplatTileSet* TileSet = Cast<UGaussianSplatTileSet>(Obj))
+	{
+		TileSet->SourceFilePath = NewReimportPaths[0];
+	}
 }
 
 EReimportResult::Type UGaussianSplatAssetFactory::Reimport(UObject* Obj)
 {
 	UGaussianSplatAsset* Asset = Cast<UGaussianSplatAsset>(Obj);
-	if (!Asset)
+	UGaussianSplatTileSet* TileSet = Cast<UGaussianSplatTileSet>(Obj);
+	if (!Asset && !TileSet)
 	{
 		return EReimportResult::Failed;
 	}
 
-	if (Asset->SourceFilePath.IsEmpty())
+	const FString& SourceFilePath = Asset ? Asset->SourceFilePath : TileSet->SourceFilePath;
+	if (SourceFilePath.IsEmpty())
 	{
 		UE_LOG(LogTemp, Error, TEXT("Cannot reimport: source file path is empty"));
 		return EReimportResult::Failed;
 	}
 
-	if (!FPaths::FileExists(Asset->SourceFilePath))
+	if (!FPaths::FileExists(SourceFilePath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Cannot reimport: source file not found: %s"), *Asset->SourceFilePath);
+		UE_LOG(LogTemp, Error, TEXT("Cannot reimport: source file not found: %s"), *SourceFilePath);
 		return EReimportResult::Failed;
 	}
 
+	// A tile set is split again with its own tile size, updating its tile assets in place
+	if (TileSet)
+	{
+		QualityLevel = TileSet->ImportQuality;
+		return ImportTiledPLYFile(SourceFilePath, TileSet->GetOuter(), TileSet->GetFName(), TileSet->GetFlags(), TileSet->TileSize, TileSet)
+			? EReimportResult::Succeeded : EReimportResult::Failed;
+	}
+
 	// Use the original quality level
 	QualityLevel = Asset->ImportQuality;
 
@@ -123,22 +212,8 @@ UGaussianSplatAsset* UGaussianSplatAssetFactory::ImportPLYFile(
 	FScopedSlowTask SlowTask(100.0f, FText::FromString(TEXT("Importing Gaussian Splat...")));
 	SlowTask.MakeDialog(true);
 
-	// Read PLY file
-	SlowTask.EnterProgressFrame(30.0f, FText::FromString(TEXT("Reading PLY file...")));
-
-	TArray<FGaussianSplatData> SplatData;
-	FString ErrorMessage;
-
-	if (!FPLYFileReader::ReadPLYFile(FilePath, SplatData, ErrorMessage))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to read PLY file: %s"), *ErrorMessage);
-		return nullptr;
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("Read %d splats from PLY file"), SplatData.Num());
-
 	// Create or reuse asset
-	SlowTask.EnterProgressFrame(10.0f, FText::FromString(TEXT("Creating asset...")));
+	SlowTask.EnterProgressFrame(5.0f, FText::FromString(TEXT("Creating asset...")));
 
 	UGaussianSplatAsset* Asset = ExistingAsset;
 	if (!Asset)
@@ -155,10 +230,43 @@ UGaussianSplatAsset* UGaussianSplatAssetFactory::ImportPLYFile(
 	// Store source file path
 	Asset->SourceFilePath = FilePath;
 
-	// Initialize asset from splat data
-	SlowTask.EnterProgressFrame(60.0f, FText::FromString(TEXT("Compressing splat data...")));
+	// An unchanged source imported with the same settings before skips reading and encoding entirely
+	SlowTask.EnterProgressFrame(5.0f, FText::FromString(TEXT("Checking derived data cache...")));
+	const FString SourceHash = LexToString(FMD5Hash::HashFile(*FilePath));
+
+	if (!Asset->InitializeFromDerivedDataCache(SourceHash, QualityLevel))
+	{
+		// Read PLY file
+		SlowTask.EnterProgressFrame(30.0f, FText::FromString(TEXT("Reading PLY file...")));
+
+		TArray<FGaussianSplatData> SplatData;
+		FString ErrorMessage;
+
+		if (!FPLYFileReader::ReadPLYFile(FilePath, SplatData, ErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to read PLY file: %s"), *ErrorMessage);
+			if (!ExistingAsset)
+			{
+				// Don't leave an empty asset behind in the package
+				Asset->ClearFlags(RF_Public | RF_Standalone);
+				Asset->MarkAsGarbage();
+			}
+			return nullptr;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Read %d splats from PLY file"), SplatData.Num());
 
-	Asset->InitializeFromSplatData(SplatData, QualityLevel);
+		// Spatially coherent chunks give tight chunk bounds for GPU chunk culling and quantization
+		SlowTask.EnterProgressFrame(5.0f, FText::FromString(TEXT("Sorting splats...")));
+		SortSplatsMorton(SplatData);
+
+		// Initialize asset from splat data
+		SlowTask.EnterProgressFrame(55.0f, FText::FromString(TEXT("Compressing splat data...")));
+
+		Asset->SourceFileHash = SourceHash;
+		Asset->InitializeFromSplatData(SplatData, QualityLevel);
+		Asset->SaveToDerivedDataCache();
+	}
 
 	// Mark package dirty
 	Asset->MarkPackageDirty();
@@ -168,3 +276,276 @@ UGaussianSplatAsset* UGaussianSplatAssetFactory::ImportPLYFile(
 
 	return Asset;
 }
+
+UGaussianSplatTileSet* UGaussianSplatAssetFactory::ImportTiledPLYFile(
+	const FString& FilePath,
+	UObject* InParent,
+	FName InName,
+	EObjectFlags Flags,
+	float TileSize,
+	UGaussianSplatTileSet* ExistingTileSet)
+{
+	FScopedSlowTask SlowTask(100.0f, FText::FromString(TEXT("Importing tiled Gaussian Splat...")));
+	SlowTask.MakeDialog(true);
+
+	// The capture is streamed twice, once for its bounds and once to bucket every splat into its tile,
+	// so only one read block and the bucket buffers are ever resident
+	SlowTask.EnterProgressFrame(10.0f, FText::FromString(TEXT("Measuring PLY file...")));
+	const FString SourceHash = LexToString(FMD5Hash::HashFile(*FilePath));
+
+	FBox3f Bounds(ForceInit);
+	int32 TotalSplats = 0;
+	FString ErrorMessage;
+	const bool bMeasured = FPLYFileReader::ReadPLYFileInChunks(FilePath, [&Bounds, &TotalSplats](TConstArrayView<FGaussianSplatData> Chunk)
+	{
+		for (const FGaussianSplatData& Splat : Chunk)
+		{
+			Bounds += Splat.Position;
+		}
+		TotalSplats += Chunk.Num();
+	}, ErrorMessage);
+	if (!bMeasured)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to read PLY file: %s"), *ErrorMessage);
+		return nullptr;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Read %d splats from PLY file"), TotalSplats);
+
+	// Splats belong to the cell of their center, so tiles overlap by the extent of the splats on their borders
+	if (!Bounds.IsValid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to import tiled Gaussian Splat: %s holds no splats"), *FilePath);
+		return nullptr;
+	}
+
+	const FIntPoint GridMin(FMath::FloorToInt32(Bounds.Min.X / TileSize), FMath::FloorToInt32(Bounds.Min.Y / TileSize));
+	const FIntPoint GridMax(FMath::FloorToInt32(Bounds.Max.X / TileSize), FMath::FloorToInt32(Bounds.Max.Y / TileSize));
+	const FIntPoint GridSize = GridMax - GridMin + FIntPoint(1, 1);
+	if ((int64)GridSize.X * GridSize.Y > MaxImportTileCells)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to import tiled Gaussian Splat: a tile size of %.0f spans %d x %d cells, more than %lld. Raise gs.ImportTileSize or the tile set's Tile Size."),
+			TileSize, GridSize.X, GridSize.Y, MaxImportTileCells);
+		return nullptr;
+	}
+
+	// Each cell buffers its splats in file order and spills them to its own temp file once the buffers outgrow
+	// MaxImportBufferedBytes; a capture that fits in the budget never touches the disk
+	SlowTask.EnterProgressFrame(15.0f, FText::FromString(TEXT("Binning splats into tiles...")));
+	const int32 NumCells = GridSize.X * GridSize.Y;
+	TArray<TArray<FGaussianSplatData>> CellBuffers;
+	CellBuffers.SetNum(NumCells);
+	TArray<int32> CellCounts;
+	CellCounts.SetNumZeroed(NumCells);
+	TBitArray<> CellSpilled(false, NumCells);
+	int64 BufferedSplats = 0;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString SpillFolder = FPaths::ProjectIntermediateDir() / TEXT("GaussianSplatImport") / FGuid::NewGuid().ToString();
+	ON_SCOPE_EXIT
+	{
+		PlatformFile.DeleteDirectoryRecursively(*SpillFolder);
+	};
+	auto GetSpillFile = [&SpillFolder](int32 CellIndex)
+	{
+		return SpillFolder / FString::Printf(TEXT("Cell_%d.bin"), CellIndex);
+	};
+
+	bool bSpillFailed = false;
+	auto SpillCellBuffers = [&]()
+	{
+		PlatformFile.CreateDirectoryTree(*SpillFolder);
+		for (int32 CellIndex = 0; CellIndex < NumCells && !bSpillFailed; CellIndex++)
+		{
+			TArray<FGaussianSplatData>& Buffer = CellBuffers[CellIndex];
+			if (Buffer.Num() == 0)
+			{
+				continue;
+			}
+
+			TUniquePtr<IFileHandle> SpillHandle(PlatformFile.OpenWrite(*GetSpillFile(CellIndex), true));
+			if (!SpillHandle || !SpillHandle->Write(reinterpret_cast<const uint8*>(Buffer.GetData()), Buffer.NumBytes()))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed to import tiled Gaussian Splat: cannot write %s"), *GetSpillFile(CellIndex));
+				bSpillFailed = true;
+			}
+			CellSpilled[CellIndex] = true;
+			Buffer.Empty();
+		}
+		BufferedSplats = 0;
+	};
+
+	const int64 MaxBufferedSplats = FMath::Max<int64>(1, MaxImportBufferedBytes / sizeof(FGaussianSplatData));
+	const bool bBinned = FPLYFileReader::ReadPLYFileInChunks(FilePath, [&](TConstArrayView<FGaussianSplatData> Chunk)
+	{
+		if (bSpillFailed)
+		{
+			return;
+		}
+
+		for (const FGaussianSplatData& Splat : Chunk)
+		{
+			const int32 X = FMath::Clamp(FMath::FloorToInt32(Splat.Position.X / TileSize) - GridMin.X, 0, GridSize.X - 1);
+			const int32 Y = FMath::Clamp(FMath::FloorToInt32(Splat.Position.Y / TileSize) - GridMin.Y, 0, GridSize.Y - 1);
+			const int32 CellIndex = Y * GridSize.X + X;
+			CellBuffers[CellIndex].Add(Splat);
+			CellCounts[CellIndex]++;
+		}
+
+		BufferedSplats += Chunk.Num();
+		if (BufferedSplats > MaxBufferedSplats)
+		{
+			SpillCellBuffers();
+		}
+	}, ErrorMessage);
+	if (!bBinned)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to read PLY file: %s"), *ErrorMessage);
+		return nullptr;
+	}
+	if (bSpillFailed)
+	{
+		return nullptr;
+	}
+
+	UGaussianSplatTileSet* TileSet = ExistingTileSet;
+	if (!TileSet)
+	{
+		TileSet = NewObject<UGaussianSplatTileSet>(InParent, UGaussianSplatTileSet::StaticClass(), InName, Flags);
+	}
+	if (!TileSet)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create Gaussian Splat tile set"));
+		return nullptr;
+	}
+
+	const FString BaseName = InName.ToString();
+	const FString TileFolder = FPackageName::GetLongPackagePath(InParent->GetOutermost()->GetName()) / (BaseName + TEXT("_Tiles"));
+
+	TArray<FGaussianSplatTile> Tiles;
+	FBox TileSetBounds(ForceInit);
+	for (int32 CellIndex = 0; CellIndex < NumCells; CellIndex++)
+	{
+		const int32 NumTileSplats = CellCounts[CellIndex];
+		if (NumTileSplats == 0)
+		{
+			continue;
+		}
+
+		const FIntPoint Cell(GridMin.X + CellIndex % GridSize.X, GridMin.Y + CellIndex / GridSize.X);
+		SlowTask.EnterProgressFrame(75.0f * NumTileSplats / TotalSplats,
+			FText::FromString(FString::Printf(TEXT("Compressing tile %d, %d (%d splats)..."), Cell.X, Cell.Y, NumTileSplats)));
+
+		UGaussianSplatAsset* TileAsset = FindOrCreateTileAsset(TileFolder, BaseName, Cell, ExistingTileSet);
+		if (!TileAsset)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to create Gaussian Splat tile %d, %d in %s"), Cell.X, Cell.Y, *TileFolder);
+			return nullptr;
+		}
+
+		// Tiles are cached by the source, their cell and the tile size, an unchanged reimport skips every encode
+		const FString TileHash = FString::Printf(TEXT("%s_%g_%d_%d"), *SourceHash, TileSize, Cell.X, Cell.Y);
+		if (!TileAsset->InitializeFromDerivedDataCache(TileHash, QualityLevel))
+		{
+			// Spilled splats come first, they were read before the ones still buffered
+			TArray<FGaussianSplatData> TileSplats;
+			TileSplats.Reserve(NumTileSplats);
+			if (CellSpilled[CellIndex])
+			{
+				const int32 NumSpilled = NumTileSplats - CellBuffers[CellIndex].Num();
+				TileSplats.SetNumUninitialized(NumSpilled);
+				TUniquePtr<IFileHandle> SpillHandle(PlatformFile.OpenRead(*GetSpillFile(CellIndex)));
+				if (!SpillHandle || !SpillHandle->Read(reinterpret_cast<uint8*>(TileSplats.GetData()), TileSplats.NumBytes()))
+				{
+					UE_LOG(LogTemp, Error, TEXT("Failed to import tiled Gaussian Splat: cannot read %s"), *GetSpillFile(CellIndex));
+					return nullptr;
+				}
+			}
+			TileSplats.Append(CellBuffers[CellIndex]);
+			SortSplatsMorton(TileSplats);
+
+			TileAsset->SourceFileHash = TileHash;
+			TileAsset->InitializeFromSplatData(TileSplats, QualityLevel);
+			TileAsset->SaveToDerivedDataCache();
+		}
+		TileAsset->MarkPackageDirty();
+		CellBuffers[CellIndex].Empty();
+
+		FGaussianSplatTile& Tile = Tiles.AddDefaulted_GetRef();
+		Tile.Cell = Cell;
+		Tile.Bounds = TileAsset->GetBounds();
+		Tile.SplatCount = TileAsset->GetSourceSplatCount();
+		Tile.MemoryBytes = TileAsset->GetMemoryUsage();
+		Tile.Asset = TileAsset;
+		TileSetBounds += Tile.Bounds;
+	}
+
+	// Tiles of cells that are empty now stay on disk, unreferenced
+	if (ExistingTileSet)
+	{
+		for (const FGaussianSplatTile& OldTile : ExistingTileSet->Tiles)
+		{
+			if (!Tiles.ContainsByPredicate([&OldTile](const FGaussianSplatTile& Tile) { return Tile.Asset == OldTile.Asset; }))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Gaussian Splat tile %s is no longer part of %s and can be deleted"), *OldTile.Asset.ToString(), *TileSet->GetName());
+			}
+		}
+	}
+
+	TileSet->Tiles = MoveTemp(Tiles);
+	TileSet->SplatCount = TotalSplats;
+	TileSet->BoundingBox = TileSetBounds;
+	TileSet->SourceFilePath = FilePath;
+	TileSet->SourceFileHash = SourceHash;
+	TileSet->ImportQuality = QualityLevel;
+	TileSet->TileSize = TileSize;
+	TileSet->MarkPackageDirty();
+
+	UE_LOG(LogTemp, Log, TEXT("Successfully imported Gaussian Splat tile set: %d splats in %d tiles of %.0f, %lld bytes"),
+		TotalSplats, TileSet->Tiles.Num(), TileSize, TileSet->GetMemoryUsage());
+
+	return TileSet;
+}
+
+UGaussianSplatAsset* UGaussianSplatAssetFactory::FindOrCreateTileAsset(const FString& TileFolder, const FString& BaseName, const FIntPoint& Cell, UGaussianSplatTileSet* ExistingTileSet)
+{
+	if (ExistingTileSet)
+	{
+		for (const FGaussianSplatTile& Tile : ExistingTileSet->Tiles)
+		{
+			if (Tile.Cell == Cell)
+			{
+				if (UGaussianSplatAsset* Asset = Tile.Asset.LoadSynchronous())
+				{
+					return Asset;
+				}
+			}
+		}
+	}
+
+	const FString TileName = FString::Printf(TEXT("%s_%d_%d"), *BaseName, Cell.X, Cell.Y);
+	const FString PackageName = TileFolder / TileName;
+
+	// A tile left on disk by an earlier import of the same name is updated rather than shadowed
+	if (FPackageName::DoesPackageExist(PackageName))
+	{
+		if (UGaussianSplatAsset* Asset = LoadObject<UGaussianSplatAsset>(nullptr, *(PackageName + TEXT(".") + TileName), nullptr, LOAD_NoWarn | LOAD_Quiet))
+		{
+			return Asset;
+		}
+	}
+
+	UPackage* Package = CreatePackage(*PackageName);
+	if (!Package)
+	{
+		return nullptr;
+	}
+	if (UGaussianSplatAsset* Asset = FindObject<UGaussianSplatAsset>(Package, *TileName))
+	{
+		return Asset;
+	}
+
+	UGaussianSplatAsset* Asset = NewObject<UGaussianSplatAsset>(Package, UGaussianSplatAsset::StaticClass(), *TileName, RF_Public | RF_Standalone | RF_Transactional);
+	FAssetRegistryModule::AssetCreated(Asset);
+	return Asset;
+}
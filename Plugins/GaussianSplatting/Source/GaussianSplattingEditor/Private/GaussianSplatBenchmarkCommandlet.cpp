@@ -0,0 +1,223 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GaussianSplatBenchmarkCommandlet.h"
+#include "GaussianSplatAssetFactory.h"
+#include "GaussianSplatAsset.h"
+#include "GaussianSplatRenderer.h"
+#include "PLYFileReader.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderingThread.h"
+
+namespace GaussianSplatBenchmarkPrivate
+{
+	/** Scenes the importer benchmark runs when -PLY and -Synthetic are not given */
+	const TCHAR* DefaultPLYFile = TEXT("PLY/cactus_splat3_30kSteps_142k_splats.ply");
+	const TCHAR* DefaultSyntheticCounts = TEXT("1000000,5000000,10000000");
+
+	/** Sort key widths timed per sort mode, every width gs.SortKeyBits accepts */
+	constexpr uint32 BenchmarkSortKeyBits[] = { 16, 24, 32 };
+
+	/**
+	 * Splats scattered over a few hundred gaussian clusters, sized and colored like a trained scene.
+	 * Values are linear (as FPLYFileReader returns them), in centimeters.
+	 */
+	void GenerateSyntheticSplats(int32 NumSplats, TArray<FGaussianSplatData>& OutSplats)
+	{
+		FRandomStream Random(NumSplats);
+		constexpr int32 NumClusters = 256;
+		constexpr float SceneExtent = 5000.0f;
+
+		TArray<FVector3f> ClusterCenters;
+		for (int32 Cluster = 0; Cluster < NumClusters; Cluster++)
+		{
+			ClusterCenters.Add(FVector3f(Random.GetFraction(), Random.GetFraction(), Random.GetFraction()) * SceneExtent);
+		}
+
+		OutSplats.SetNum(NumSplats);
+		for (FGaussianSplatData& Splat : OutSplats)
+		{
+			const FVector3f Offset(Random.GetFraction() - 0.5f, Random.GetFraction() - 0.5f, Random.GetFraction() - 0.5f);
+			Splat.Position = ClusterCenters[Random.RandHelper(NumClusters)] + Offset * Offset.SizeSquared() * 1000.0f;
+			Splat.Rotation = FQuat4f(FVector3f(Random.GetUnitVector()), Random.GetFraction() * UE_TWO_PI);
+			Splat.Scale = FVector3f(Random.FRandRange(0.2f, 4.0f), Random.FRandRange(0.2f, 4.0f), Random.FRandRange(0.2f, 4.0f));
+			Splat.Opacity = Random.FRandRange(0.05f, 1.0f);
+			Splat.SH_DC = FVector3f(Random.FRandRange(-1.5f, 1.5f), Random.FRandRange(-1.5f, 1.5f), Random.FRandRange(-1.5f, 1.5f));
+			for (FVector3f& Coefficient : Splat.SH)
+			{
+				Coefficient = FVector3f(Random.FRandRange(-0.2f, 0.2f), Random.FRandRange(-0.2f, 0.2f), Random.FRandRange(-0.2f, 0.2f));
+			}
+		}
+	}
+}
+
+using namespace GaussianSplatBenchmarkPrivate;
+
+TArray<FGaussianSplatBenchmarkScene> UGaussianSplatBenchmarkCommandlet::GetBenchmarkScenes(const FString& Params)
+{
+	FString PLYFile;
+	FString SyntheticCounts;
+	const bool bHasPLY = FParse::Value(*Params, TEXT("PLY="), PLYFile);
+	const bool bHasSynthetic = FParse::Value(*Params, TEXT("Synthetic="), SyntheticCounts);
+	if (!bHasPLY && !bHasSynthetic)
+	{
+		PLYFile = FPaths::Combine(FPaths::ProjectDir(), DefaultPLYFile);
+		SyntheticCounts = DefaultSyntheticCounts;
+	}
+
+	TArray<FGaussianSplatBenchmarkScene> Scenes;
+	if (!PLYFile.IsEmpty())
+	{
+		FGaussianSplatBenchmarkScene& Scene = Scenes.AddDefaulted_GetRef();
+		Scene.Name = FPaths::GetBaseFilename(PLYFile);
+		Scene.PLYFile = PLYFile;
+	}
+	TArray<FString> Counts;
+	SyntheticCounts.ParseIntoArray(Counts, TEXT(","));
+	for (const FString& Count : Counts)
+	{
+		const int32 NumSplats = FCString::Atoi(*Count);
+		if (NumSplats > 0)
+		{
+			FGaussianSplatBenchmarkScene& Scene = Scenes.AddDefaulted_GetRef();
+			Scene.Name = FString::Printf(TEXT("Synthetic_%d"), NumSplats);
+			Scene.NumSplats = NumSplats;
+		}
+	}
+	return Scenes;
+}
+
+bool UGaussianSplatBenchmarkCommandlet::ReadBenchmarkSplats(const FGaussianSplatBenchmarkScene& Scene, TArray<FGaussianSplatData>& OutSplats, FString& OutError)
+{
+	if (!Scene.PLYFile.IsEmpty())
+	{
+		return FPLYFileReader::ReadPLYFile(Scene.PLYFile, OutSplats, OutError);
+	}
+	GenerateSyntheticSplats(Scene.NumSplats, OutSplats);
+	return true;
+}
+
+UGaussianSplatAsset* UGaussianSplatBenchmarkCommandlet::BuildBenchmarkAsset(TArray<FGaussianSplatData>& SplatData, EGaussianQualityLevel QualityLevel)
+{
+	UGaussianSplatAssetFactory::SortSplatsMorton(SplatData);
+
+	UGaussianSplatAsset* Asset = NewObject<UGaussianSplatAsset>(GetTransientPackage(), NAME_None, RF_Transient);
+	Asset->InitializeFromSplatData(SplatData, QualityLevel);
+	return Asset;
+}
+
+UGaussianSplatBenchmarkCommandlet::UGaussianSplatBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGaussianSplatBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 Quality = (int32)EGaussianQualityLevel::Medium;
+	int32 SortIterations = 8;
+	FParse::Value(*Params, TEXT("Quality="), Quality);
+	FParse::Value(*Params, TEXT("SortIterations="), SortIterations);
+	const EGaussianQualityLevel QualityLevel = (EGaussianQualityLevel)FMath::Clamp(Quality, 0, (int32)EGaussianQualityLevel::VeryLow);
+
+	FString OutputFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), TEXT("GaussianSplatBenchmark.csv"));
+	FParse::Value(*Params, TEXT("Output="), OutputFile);
+
+	// GPU timings need a renderer, -AllowCommandletRendering creates one
+	const bool bCanTimeGPU = FApp::CanEverRender();
+	if (!bCanTimeGPU)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("GaussianSplatBenchmark: no renderer, run with -AllowCommandletRendering to time the sort"));
+	}
+
+	const TArray<FGaussianSplatBenchmarkScene> Scenes = GetBenchmarkScenes(Params);
+
+	IConsoleVariable* SortModeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("gs.SortMode"));
+	const int32 InitialSortMode = SortModeCVar ? SortModeCVar->GetInt() : 0;
+
+	TArray<FString> Rows;
+	Rows.Add(TEXT("Scene,Splats,ReadSeconds,ImportSeconds,AssetBytes,ImportMemoryMB,SortMode,SortKeyBits,SortMs,KeysPerSecond"));
+	bool bSucceeded = true;
+
+	for (const FGaussianSplatBenchmarkScene& Scene : Scenes)
+	{
+		// The process peak never drops after the largest scene, so memory is measured per scene from here, with the
+		// source splats and the finished asset both alive like at the end of an editor import
+		const uint64 UsedPhysicalBefore = FPlatformMemory::GetStats().UsedPhysical;
+
+		// Reading the PLY (or generating synthetic splats) is timed apart from the import itself
+		const double ReadStart = FPlatformTime::Seconds();
+		TArray<FGaussianSplatData> SplatData;
+		FString Error;
+		if (!ReadBenchmarkSplats(Scene, SplatData, Error))
+		{
+			UE_LOG(LogTemp, Error, TEXT("GaussianSplatBenchmark: failed to read %s: %s"), *Scene.PLYFile, *Error);
+			bSucceeded = false;
+			continue;
+		}
+		const double ReadSeconds = FPlatformTime::Seconds() - ReadStart;
+
+		const double ImportStart = FPlatformTime::Seconds();
+		UGaussianSplatAsset* Asset = BuildBenchmarkAsset(SplatData, QualityLevel);
+		const double ImportSeconds = FPlatformTime::Seconds() - ImportStart;
+
+		const uint64 UsedPhysicalAfter = FPlatformMemory::GetStats().UsedPhysical;
+		const double ImportMemoryMB = (UsedPhysicalAfter > UsedPhysicalBefore ? UsedPhysicalAfter - UsedPhysicalBefore : 0) / (1024.0 * 1024.0);
+		SplatData.Empty();
+
+		const int32 NumSplats = Asset->GetSplatCount();
+		const FString ImportColumns = FString::Printf(TEXT("%s,%d,%.3f,%.3f,%lld,%.1f"),
+			*Scene.Name, NumSplats, ReadSeconds, ImportSeconds, Asset->GetMemoryUsage(), ImportMemoryMB);
+		UE_LOG(LogTemp, Display, TEXT("GaussianSplatBenchmark: %s, %d splats read in %.3f s and imported in %.3f s, %lld asset bytes, %.1f MB import memory"),
+			*Scene.Name, NumSplats, ReadSeconds, ImportSeconds, Asset->GetMemoryUsage(), ImportMemoryMB);
+
+		if (!bCanTimeGPU || !SortModeCVar)
+		{
+			Rows.Add(ImportColumns + TEXT(",,,,"));
+			continue;
+		}
+
+		// Sort throughput per sort mode and key width, at the scene's splat count
+		for (int32 SortMode = 0; SortMode <= 1; SortMode++)
+		{
+			SortModeCVar->Set(SortMode, ECVF_SetByCommandline);
+			for (const uint32 SortKeyBits : BenchmarkSortKeyBits)
+			{
+				double SortMs = -1.0;
+				ENQUEUE_RENDER_COMMAND(GaussianSplatBenchmarkSort)(
+					[NumSplats, SortKeyBits, SortIterations, &SortMs](FRHICommandListImmediate& RHICmdList)
+					{
+						SortMs = FGaussianSplatRenderer::BenchmarkSort(RHICmdList, NumSplats, SortKeyBits, SortIterations);
+					});
+				FlushRenderingCommands();
+
+				const double KeysPerSecond = SortMs > 0.0 ? NumSplats / (SortMs / 1000.0) : 0.0;
+				Rows.Add(FString::Printf(TEXT("%s,%d,%u,%.4f,%.0f"), *ImportColumns, SortMode, SortKeyBits, SortMs, KeysPerSecond));
+				UE_LOG(LogTemp, Display, TEXT("GaussianSplatBenchmark: %s, sort mode %d, %u bit keys: %.4f ms (%.1f Mkeys/s)"),
+					*Scene.Name, SortMode, SortKeyBits, SortMs, KeysPerSecond / 1.0e6);
+			}
+		}
+	}
+
+	if (SortModeCVar)
+	{
+		SortModeCVar->Set(InitialSortMode, ECVF_SetByCommandline);
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputFile), true);
+	if (!FFileHelper::SaveStringArrayToFile(Rows, *OutputFile))
+	{
+		UE_LOG(LogTemp, Error, TEXT("GaussianSplatBenchmark: failed to write %s"), *OutputFile);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("GaussianSplatBenchmark: results written to %s"), *OutputFile);
+
+	return bSucceeded ? 0 : 1;
+}
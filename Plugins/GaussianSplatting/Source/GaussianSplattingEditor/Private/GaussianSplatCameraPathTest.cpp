@@ -0,0 +1,393 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GaussianSplatBenchmarkCommandlet.h"
+#include "GaussianSplatActor.h"
+#include "GaussianSplatAsset.h"
+#include "GaussianSplatComponent.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/SceneCapture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && CSV_PROFILER
+
+namespace GaussianSplatCameraPathPrivate
+{
+	/** Frames rendered before each capture so streaming and the sort caches settle after a sort mode change */
+	constexpr int32 WarmupFrames = 30;
+	constexpr int32 DefaultPathFrames = 300;
+	constexpr int32 CaptureWidth = 1920;
+	constexpr int32 CaptureHeight = 1080;
+
+	/** GPU stats of the splat stages, as named in the GPU CSV category (stat token or display name) */
+	constexpr int32 NumStages = 4;
+	const TCHAR* StageStatNames[NumStages][2] =
+	{
+		{ TEXT("GaussianSplatViewData"), TEXT("Gaussian Splat View Data") },
+		{ TEXT("GaussianSplatSort"), TEXT("Gaussian Splat Sort") },
+		{ TEXT("GaussianSplatTileSort"), TEXT("Gaussian Splat Tile Sort") },
+		{ TEXT("GaussianSplatDraw"), TEXT("Gaussian Splat Draw") },
+	};
+
+	/** Stages every view runs, the tile sort only runs with gs.TileRasterizer */
+	constexpr bool bStageRequired[NumStages] = { true, true, false, true };
+
+	/**
+	 * Fixed path around the scene bounds: one orbit that dollies from outside the bounds to inside them and back,
+	 * rising and falling, so culling, LOD selection and sort reuse all change along the way.
+	 */
+	FTransform GetCameraPathTransform(const FBox& Bounds, float Alpha)
+	{
+		const FVector Center = Bounds.GetCenter();
+		const double Radius = FMath::Max(Bounds.GetExtent().GetMax(), 100.0);
+		const double Angle = Alpha * UE_TWO_PI;
+		const double Distance = Radius * FMath::Lerp(1.6, 0.6, 0.5 - 0.5 * FMath::Cos(Angle));
+		const FVector Location = Center + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, Radius * 0.4 * FMath::Sin(2.0 * Angle));
+		return FTransform((Center - Location).Rotation(), Location);
+	}
+
+	/** Average per-frame GPU ms of every splat stage over the frames of a CSV profiler capture */
+	bool ReadStageTimes(const FString& CsvFile, double (&OutStageMs)[NumStages], int32& OutFrames, FString& OutError)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *CsvFile) || Lines.Num() < 2)
+		{
+			OutError = FString::Printf(TEXT("Could not read CSV capture %s"), *CsvFile);
+			return false;
+		}
+
+		TArray<FString> Header;
+		Lines[0].ParseIntoArray(Header, TEXT(","), false);
+		int32 StageColumns[NumStages] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+		for (int32 Column = 0; Column < Header.Num(); Column++)
+		{
+			FString StatName = Header[Column].TrimStartAndEnd();
+			int32 SlashIndex;
+			if (StatName.FindLastChar(TEXT('/'), SlashIndex))
+			{
+				StatName.RightChopInline(SlashIndex + 1);
+			}
+			for (int32 Stage = 0; Stage < NumStages; Stage++)
+			{
+				if (StatName == StageStatNames[Stage][0] || StatName == StageStatNames[Stage][1])
+				{
+					StageColumns[Stage] = Column;
+				}
+			}
+		}
+		for (int32 Stage = 0; Stage < NumStages; Stage++)
+		{
+			if (StageColumns[Stage] == INDEX_NONE && bStageRequired[Stage])
+			{
+				OutError = FString::Printf(TEXT("No %s GPU stat in %s, the RHI records no GPU timings"), StageStatNames[Stage][0], *CsvFile);
+				return false;
+			}
+		}
+
+		// Frame rows run until the repeated header and the metadata row at the end of the file
+		double StageSums[NumStages] = { 0.0, 0.0, 0.0, 0.0 };
+		OutFrames = 0;
+		for (int32 LineIndex = 1; LineIndex < Lines.Num(); LineIndex++)
+		{
+			if (Lines[LineIndex] == Lines[0] || Lines[LineIndex].StartsWith(TEXT("[")))
+			{
+				break;
+			}
+			TArray<FString> Values;
+			Lines[LineIndex].ParseIntoArray(Values, TEXT(","), false);
+			if (Values.Num() < Header.Num())
+			{
+				continue;
+			}
+			for (int32 Stage = 0; Stage < NumStages; Stage++)
+			{
+				if (StageColumns[Stage] != INDEX_NONE)
+				{
+					StageSums[Stage] += FCString::Atod(*Values[StageColumns[Stage]]);
+				}
+			}
+			OutFrames++;
+		}
+		if (OutFrames == 0)
+		{
+			OutError = FString::Printf(TEXT("CSV capture %s has no frames"), *CsvFile);
+			return false;
+		}
+
+		for (int32 Stage = 0; Stage < NumStages; Stage++)
+		{
+			OutStageMs[Stage] = StageSums[Stage] / OutFrames;
+		}
+		return true;
+	}
+
+	/**
+	 * Renders one scene along the camera path through a scene capture, once per sort mode, with a CSV profiler capture
+	 * around each flight. Appends a row per sort mode to Saved/Benchmarks/GaussianSplatCameraPath.csv.
+	 */
+	class FCameraPathCommand : public IAutomationLatentCommand
+	{
+	public:
+		FCameraPathCommand(FAutomationTestBase* InTest, const FGaussianSplatBenchmarkScene& InScene)
+			: Test(InTest)
+			, Scene(InScene)
+		{
+		}
+
+		virtual ~FCameraPathCommand()
+		{
+			Cleanup();
+		}
+
+		virtual bool Update() override
+		{
+			switch (Step)
+			{
+			case EStep::Setup:
+				if (!Setup())
+				{
+					return Finish();
+				}
+				Step = EStep::Warmup;
+				return false;
+
+			case EStep::Warmup:
+				Capture(0.0f);
+				if (++Frame >= WarmupFrames)
+				{
+					FCsvProfiler::Get()->BeginCapture(-1, FPaths::ProjectSavedDir() / TEXT("Benchmarks"),
+						FString::Printf(TEXT("GaussianSplatCameraPath_%s_SortMode%d.csv"), *Scene.Name, SortMode));
+					Frame = 0;
+					Step = EStep::Fly;
+				}
+				return false;
+
+			case EStep::Fly:
+				Capture((float)Frame / PathFrames);
+				if (++Frame >= PathFrames)
+				{
+					CsvFile = FCsvProfiler::Get()->EndCapture();
+					Step = EStep::WaitForCsv;
+				}
+				return false;
+
+			case EStep::WaitForCsv:
+				if (!CsvFile.IsValid() || !CsvFile.IsReady())
+				{
+					return false;
+				}
+				if (!WriteResults(CsvFile.Get()))
+				{
+					return Finish();
+				}
+				if (++SortMode > 1)
+				{
+					return Finish();
+				}
+				SortModeCVar->Set(SortMode, ECVF_SetByCode);
+				Frame = 0;
+				Step = EStep::Warmup;
+				return false;
+			}
+			return true;
+		}
+
+	private:
+		enum class EStep : uint8
+		{
+			Setup,
+			Warmup,
+			Fly,
+			WaitForCsv,
+		};
+
+		bool Setup()
+		{
+			SortModeCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("gs.SortMode"));
+			GPUCsvStatsCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.GPUCsvStatsEnabled"));
+			if (!SortModeCVar)
+			{
+				Test->AddError(TEXT("gs.SortMode is not registered"));
+				return false;
+			}
+			if (FCsvProfiler::Get()->IsCapturing())
+			{
+				Test->AddError(TEXT("A CSV profiler capture is already running"));
+				return false;
+			}
+
+			int32 Quality = (int32)EGaussianQualityLevel::Medium;
+			FParse::Value(FCommandLine::Get(), TEXT("Quality="), Quality);
+			FParse::Value(FCommandLine::Get(), TEXT("CameraPathFrames="), PathFrames);
+			PathFrames = FMath::Max(PathFrames, 1);
+
+			TArray<FGaussianSplatData> SplatData;
+			FString Error;
+			if (!UGaussianSplatBenchmarkCommandlet::ReadBenchmarkSplats(Scene, SplatData, Error))
+			{
+				Test->AddError(FString::Printf(TEXT("Failed to read %s: %s"), *Scene.PLYFile, *Error));
+				return false;
+			}
+			UGaussianSplatAsset* Asset = UGaussianSplatBenchmarkCommandlet::BuildBenchmarkAsset(
+				SplatData, (EGaussianQualityLevel)FMath::Clamp(Quality, 0, (int32)EGaussianQualityLevel::VeryLow));
+			NumSplats = Asset->GetSplatCount();
+			Bounds = Asset->GetBounds();
+
+			World = UWorld::CreateWorld(EWorldType::Game, false, MakeUniqueObjectName(GetTransientPackage(), UWorld::StaticClass(), TEXT("GaussianSplatCameraPath")));
+			AGaussianSplatActor* SplatActor = World->SpawnActor<AGaussianSplatActor>();
+			SplatActor->GaussianSplatComponent->SetSplatAsset(Asset);
+
+			UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>(World);
+			RenderTarget->InitAutoFormat(CaptureWidth, CaptureHeight);
+			RenderTarget->UpdateResourceImmediate(true);
+
+			// A persistent view state keeps the capture one view across frames, like a player camera
+			CaptureActor = World->SpawnActor<ASceneCapture2D>();
+			USceneCaptureComponent2D* CaptureComponent = CaptureActor->GetCaptureComponent2D();
+			CaptureComponent->bCaptureEveryFrame = false;
+			CaptureComponent->bCaptureOnMovement = false;
+			CaptureComponent->bAlwaysPersistRenderingState = true;
+			CaptureComponent->CaptureSource = SCS_FinalColorLDR;
+			CaptureComponent->TextureTarget = RenderTarget;
+
+			if (GPUCsvStatsCVar)
+			{
+				InitialGPUCsvStats = GPUCsvStatsCVar->GetInt();
+				GPUCsvStatsCVar->Set(1, ECVF_SetByCode);
+			}
+			InitialSortMode = SortModeCVar->GetInt();
+			SortModeCVar->Set(SortMode, ECVF_SetByCode);
+			return true;
+		}
+
+		void Capture(float Alpha)
+		{
+			const FTransform CameraTransform = GetCameraPathTransform(Bounds, Alpha);
+			CaptureActor->SetActorLocationAndRotation(CameraTransform.GetLocation(), CameraTransform.GetRotation());
+			CaptureActor->GetCaptureComponent2D()->CaptureScene();
+		}
+
+		bool WriteResults(const FString& CapturedFile)
+		{
+			double StageMs[NumStages];
+			int32 NumFrames = 0;
+			FString Error;
+			if (!ReadStageTimes(FPaths::ConvertRelativePathToFull(CapturedFile), StageMs, NumFrames, Error))
+			{
+				Test->AddError(FString::Printf(TEXT("%s, sort mode %d: %s"), *Scene.Name, SortMode, *Error));
+				return false;
+			}
+
+			const FString OutputFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), TEXT("GaussianSplatCameraPath.csv"));
+			FString Rows;
+			if (!IFileManager::Get().FileExists(*OutputFile))
+			{
+				Rows = TEXT("Scene,Splats,SortMode,Frames,ViewDataMs,SortMs,TileSortMs,DrawMs,TotalMs\n");
+			}
+			const double TotalMs = StageMs[0] + StageMs[1] + StageMs[2] + StageMs[3];
+			Rows += FString::Printf(TEXT("%s,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+				*Scene.Name, NumSplats, SortMode, NumFrames, StageMs[0], StageMs[1], StageMs[2], StageMs[3], TotalMs);
+			if (!FFileHelper::SaveStringToFile(Rows, *OutputFile, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+			{
+				Test->AddError(FString::Printf(TEXT("Failed to write %s"), *OutputFile));
+				return false;
+			}
+
+			Test->AddInfo(FString::Printf(TEXT("%s, sort mode %d: view data %.4f ms, sort %.4f ms, tile sort %.4f ms, draw %.4f ms per frame over %d frames"),
+				*Scene.Name, SortMode, StageMs[0], StageMs[1], StageMs[2], StageMs[3], NumFrames));
+			return true;
+		}
+
+		bool Finish()
+		{
+			Cleanup();
+			return true;
+		}
+
+		void Cleanup()
+		{
+			if (Step == EStep::Fly && FCsvProfiler::Get()->IsCapturing())
+			{
+				FCsvProfiler::Get()->EndCapture();
+			}
+			if (SortModeCVar && InitialSortMode != INDEX_NONE)
+			{
+				SortModeCVar->Set(InitialSortMode, ECVF_SetByCode);
+				InitialSortMode = INDEX_NONE;
+			}
+			if (GPUCsvStatsCVar && InitialGPUCsvStats != INDEX_NONE)
+			{
+				GPUCsvStatsCVar->Set(InitialGPUCsvStats, ECVF_SetByCode);
+				InitialGPUCsvStats = INDEX_NONE;
+			}
+			if (World)
+			{
+				World->DestroyWorld(false);
+				World->RemoveFromRoot();
+				World = nullptr;
+				CaptureActor = nullptr;
+			}
+		}
+
+		FAutomationTestBase* Test;
+		FGaussianSplatBenchmarkScene Scene;
+		EStep Step = EStep::Setup;
+		int32 SortMode = 0;
+		int32 Frame = 0;
+		int32 PathFrames = DefaultPathFrames;
+		int32 NumSplats = 0;
+		FBox Bounds = FBox(ForceInit);
+
+		UWorld* World = nullptr;
+		ASceneCapture2D* CaptureActor = nullptr;
+		TSharedFuture<FString> CsvFile;
+
+		IConsoleVariable* SortModeCVar = nullptr;
+		IConsoleVariable* GPUCsvStatsCVar = nullptr;
+		int32 InitialSortMode = INDEX_NONE;
+		int32 InitialGPUCsvStats = INDEX_NONE;
+	};
+}
+
+using namespace GaussianSplatCameraPathPrivate;
+
+/**
+ * Flies a fixed camera path through each benchmark scene (see UGaussianSplatBenchmarkCommandlet::GetBenchmarkScenes)
+ * and reports the per-frame GPU ms of the view data, sort, tile sort and draw stages for every gs.SortMode.
+ * Fails when a scene cannot be built or the GPU stats are not recorded, so CI can gate on it.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGaussianSplatCameraPathBenchmark, "GaussianSplatting.Benchmark.CameraPath",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FGaussianSplatCameraPathBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FGaussianSplatBenchmarkScene& Scene : UGaussianSplatBenchmarkCommandlet::GetBenchmarkScenes(FCommandLine::Get()))
+	{
+		OutBeautifiedNames.Add(Scene.Name);
+		OutTestCommands.Add(Scene.Name);
+	}
+}
+
+bool FGaussianSplatCameraPathBenchmark::RunTest(const FString& Parameters)
+{
+	for (const FGaussianSplatBenchmarkScene& Scene : UGaussianSplatBenchmarkCommandlet::GetBenchmarkScenes(FCommandLine::Get()))
+	{
+		if (Scene.Name == Parameters)
+		{
+			ADD_LATENT_AUTOMATION_COMMAND(FCameraPathCommand(this, Scene));
+			return true;
+		}
+	}
+
+	AddError(FString::Printf(TEXT("Unknown benchmark scene %s"), *Parameters));
+	return false;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && CSV_PROFILER
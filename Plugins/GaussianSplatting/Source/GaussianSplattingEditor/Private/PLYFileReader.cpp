@@ -3,45 +3,229 @@
 #include "PLYFileReader.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+
+namespace PLYFileReaderPrivate
+{
+	/** Vertices decoded per ParallelFor task */
+	constexpr int32 VerticesPerTask = 16 * 1024;
+
+	/** Vertex payload read per block when the file cannot be memory-mapped */
+	constexpr int64 StreamBlockBytes = 64 * 1024 * 1024;
+
+	/** Upper bound for the ASCII header */
+	constexpr int64 MaxHeaderBytes = 1024 * 1024;
+
+	/** Read a float property, or return the default when the layout doesn't contain it */
+	FORCEINLINE float ReadFloat(const uint8* VertexData, int32 Offset, float DefaultValue = 0.0f)
+	{
+		if (Offset == INDEX_NONE)
+		{
+			return DefaultValue;
+		}
+
+		// Vertex strides are not necessarily 4-byte aligned, so copy instead of dereferencing
+		float Value;
+		FMemory::Memcpy(&Value, VertexData + Offset, sizeof(float));
+		return Value;
+	}
+}
 
 bool FPLYFileReader::ReadPLYFile(const FString& FilePath, TArray<FGaussianSplatData>& OutSplats, FString& OutError)
 {
+	using namespace PLYFileReaderPrivate;
+
 	OutSplats.Empty();
 
-	// Load file into memory
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	TUniquePtr<IFileHandle> FileHandle;
+	FPLYHeader Header;
+	FPLYVertexLayout Layout;
+	if (!OpenVertexData(FilePath, FileHandle, Header, Layout, OutError))
+	{
+		return false;
+	}
+
+	const int64 DataSize = static_cast<int64>(Header.VertexCount) * Header.VertexStride;
+	OutSplats.SetNumUninitialized(Header.VertexCount);
+
+	// Preferred path: map the vertex payload and decode it in place, no copy of the file is made
+	TUniquePtr<IMappedFileHandle> MappedHandle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle ? MappedHandle->MapRegion(Header.DataOffset, DataSize) : nullptr);
+
+	if (MappedRegion)
+	{
+		DecodeVertexRange(MappedRegion->GetMappedPtr(), 0, Header.VertexCount, Header, Layout, OutSplats);
+	}
+	else
+	{
+		// Fallback: stream the payload in fixed-size blocks so peak memory stays bounded
+		const int64 VerticesPerBlock = FMath::Max<int64>(1, StreamBlockBytes / Header.VertexStride);
+		TArray<uint8> BlockBuffer;
+		BlockBuffer.SetNumUninitialized(VerticesPerBlock * Header.VertexStride);
+
+		if (!FileHandle->Seek(Header.DataOffset))
+		{
+			OutError = TEXT("Failed to seek to PLY vertex data");
+			OutSplats.Empty();
+			return false;
+		}
+
+		for (int64 FirstVertex = 0; FirstVertex < Header.VertexCount; FirstVertex += VerticesPerBlock)
+		{
+			const int32 NumVertices = static_cast<int32>(FMath::Min<int64>(VerticesPerBlock, Header.VertexCount - FirstVertex));
+			if (!FileHandle->Read(BlockBuffer.GetData(), static_cast<int64>(NumVertices) * Header.VertexStride))
+			{
+				OutError = FString::Printf(TEXT("Failed to read PLY vertex data at vertex %lld"), FirstVertex);
+				OutSplats.Empty();
+				return false;
+			}
+
+			DecodeVertexRange(BlockBuffer.GetData(), static_cast<int32>(FirstVertex), NumVertices, Header, Layout, OutSplats);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Successfully read %d splats from PLY file (%s)"),
+		OutSplats.Num(), MappedRegion ? TEXT("memory-mapped") : TEXT("streamed"));
+	return true;
+}
+
+bool FPLYFileReader::ReadPLYFileInChunks(const FString& FilePath, TFunctionRef<void(TConstArrayView<FGaussianSplatData>)> ChunkCallback, FString& OutError)
+{
+	using namespace PLYFileReaderPrivate;
+
+	TUniquePtr<IFileHandle> FileHandle;
+	FPLYHeader Header;
+	FPLYVertexLayout Layout;
+	if (!OpenVertexData(FilePath, FileHandle, Header, Layout, OutError))
+	{
+		return false;
+	}
+
+	if (!FileHandle->Seek(Header.DataOffset))
+	{
+		OutError = TEXT("Failed to seek to PLY vertex data");
+		return false;
+	}
+
+	// Only one block of raw vertices and its decoded splats are ever held, whatever the file size
+	const int64 VerticesPerBlock = FMath::Max<int64>(1, StreamBlockBytes / Header.VertexStride);
+	TArray<uint8> BlockBuffer;
+	BlockBuffer.SetNumUninitialized(FMath::Min<int64>(VerticesPerBlock, Header.VertexCount) * Header.VertexStride);
+	TArray<FGaussianSplatData> ChunkSplats;
+
+	for (int64 FirstVertex = 0; FirstVertex < Header.VertexCount; FirstVertex += VerticesPerBlock)
+	{
+		const int32 NumVertices = static_cast<int32>(FMath::Min<int64>(VerticesPerBlock, Header.VertexCount - FirstVertex));
+		if (!FileHandle->Read(BlockBuffer.GetData(), static_cast<int64>(NumVertices) * Header.VertexStride))
+		{
+			OutError = FString::Printf(TEXT("Failed to read PLY vertex data at vertex %lld"), FirstVertex);
+			return false;
+		}
+
+		ChunkSplats.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+		DecodeVertexRange(BlockBuffer.GetData(), 0, NumVertices, Header, Layout, ChunkSplats);
+		ChunkCallback(ChunkSplats);
+	}
+
+	return true;
+}
+
+bool FPLYFileReader::OpenVertexData(const FString& FilePath, TUniquePtr<IFileHandle>& OutFileHandle, FPLYHeader& OutHeader, FPLYVertexLayout& OutLayout, FString& OutError)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	OutFileHandle.Reset(PlatformFile.OpenRead(*FilePath));
+	if (!OutFileHandle)
 	{
 		OutError = FString::Printf(TEXT("Failed to load file: %s"), *FilePath);
 		return false;
 	}
 
-	if (FileData.Num() < 4)
+	const int64 FileSize = OutFileHandle->Size();
+	if (FileSize < 4)
 	{
 		OutError = TEXT("File too small to be a valid PLY file");
 		return false;
 	}
 
-	// Parse header
-	FPLYHeader Header;
-	if (!ParseHeader(FileData, Header, OutError))
+	// Parse header (only the header is read into memory, the payload is mapped or streamed)
+	TArray<uint8> HeaderBytes;
+	if (!ReadHeaderBytes(*OutFileHandle, HeaderBytes, OutError))
+	{
+		return false;
+	}
+
+	if (!ParseHeader(HeaderBytes.GetData(), HeaderBytes.Num(), OutHeader, OutError))
 	{
 		return false;
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("PLY Header parsed: %d vertices, %d bytes per vertex, data at offset %lld"),
-		Header.VertexCount, Header.VertexStride, Header.DataOffset);
+		OutHeader.VertexCount, OutHeader.VertexStride, OutHeader.DataOffset);
 
-	// Read vertex data
-	if (!ReadVertexData(FileData, Header, OutSplats, OutError))
+	if (!ResolveVertexLayout(OutHeader, OutLayout, OutError))
 	{
 		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Successfully read %d splats from PLY file"), OutSplats.Num());
+	const int64 ExpectedEnd = OutHeader.DataOffset + static_cast<int64>(OutHeader.VertexCount) * OutHeader.VertexStride;
+	if (ExpectedEnd > FileSize)
+	{
+		OutError = FString::Printf(TEXT("File truncated: expected %lld bytes, got %lld"), ExpectedEnd, FileSize);
+		return false;
+	}
+
 	return true;
 }
 
+bool FPLYFileReader::ReadHeaderBytes(IFileHandle& FileHandle, TArray<uint8>& OutHeaderBytes, FString& OutError)
+{
+	using namespace PLYFileReaderPrivate;
+
+	const char* EndHeaderMarker = "end_header";
+	const int32 MarkerLen = FCStringAnsi::Strlen(EndHeaderMarker);
+	const int64 FileSize = FileHandle.Size();
+
+	// Headers are a few KB; grow the read window until the marker and its newline are inside it
+	int64 ReadSize = FMath::Min<int64>(4096, FileSize);
+	int64 SearchStart = 0;
+
+	while (true)
+	{
+		OutHeaderBytes.SetNumUninitialized(static_cast<int32>(ReadSize));
+		if (!FileHandle.Seek(0) || !FileHandle.Read(OutHeaderBytes.GetData(), ReadSize))
+		{
+			OutError = TEXT("Failed to read PLY header");
+			return false;
+		}
+
+		for (int64 i = SearchStart; i <= ReadSize - MarkerLen; i++)
+		{
+			if (FMemory::Memcmp(&OutHeaderBytes[i], EndHeaderMarker, MarkerLen) == 0)
+			{
+				for (int64 j = i + MarkerLen; j < ReadSize; j++)
+				{
+					if (OutHeaderBytes[j] == '\n')
+					{
+						OutHeaderBytes.SetNum(static_cast<int32>(j + 1));
+						return true;
+					}
+				}
+				break;
+			}
+		}
+
+		if (ReadSize >= FileSize || ReadSize >= MaxHeaderBytes)
+		{
+			OutError = TEXT("Could not find 'end_header' in PLY file");
+			return false;
+		}
+
+		SearchStart = FMath::Max<int64>(0, ReadSize - MarkerLen - 2);
+		ReadSize = FMath::Min(ReadSize * 4, FMath::Min(FileSize, MaxHeaderBytes));
+	}
+}
+
 bool FPLYFileReader::IsValidPLYFile(const FString& FilePath)
 {
 	// Quick check: read first few bytes and look for "ply" magic
@@ -64,7 +248,7 @@ bool FPLYFileReader::IsValidPLYFile(const FString& FilePath)
 	return HeaderBytes[0] == 'p' && HeaderBytes[1] == 'l' && HeaderBytes[2] == 'y';
 }
 
-bool FPLYFileReader::ParseHeader(const TArray<uint8>& FileData, FPLYHeader& OutHeader, FString& OutError)
+bool FPLYFileReader::ParseHeader(const uint8* HeaderData, int64 HeaderSize, FPLYHeader& OutHeader, FString& OutError)
 {
 	// Convert header portion to string (headers are ASCII)
 	FString HeaderString;
@@ -74,16 +258,16 @@ bool FPLYFileReader::ParseHeader(const TArray<uint8>& FileData, FPLYHeader& OutH
 	const char* EndHeaderMarker = "end_header";
 	const int32 MarkerLen = FCStringAnsi::Strlen(EndHeaderMarker);
 
-	for (int32 i = 0; i < FileData.Num() - MarkerLen; i++)
+	for (int64 i = 0; i <= HeaderSize - MarkerLen; i++)
 	{
-		if (FMemory::Memcmp(&FileData[i], EndHeaderMarker, MarkerLen) == 0)
+		if (FMemory::Memcmp(HeaderData + i, EndHeaderMarker, MarkerLen) == 0)
 		{
 			// Find the newline after end_header
-			for (int32 j = i + MarkerLen; j < FileData.Num(); j++)
+			for (int64 j = i + MarkerLen; j < HeaderSize; j++)
 			{
-				if (FileData[j] == '\n')
+				if (HeaderData[j] == '\n')
 				{
-					HeaderEnd = j + 1;
+					HeaderEnd = static_cast<int32>(j + 1);
 					break;
 				}
 			}
@@ -98,7 +282,7 @@ bool FPLYFileReader::ParseHeader(const TArray<uint8>& FileData, FPLYHeader& OutH
 	}
 
 	// Convert header to string
-	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(FileData.GetData()), HeaderEnd);
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(HeaderData), HeaderEnd);
 	HeaderString = FString(Converter.Length(), Converter.Get());
 
 	OutHeader.DataOffset = HeaderEnd;
@@ -192,6 +376,7 @@ bool FPLYFileReader::ParseHeader(const TArray<uint8>& FileData, FPLYHeader& OutH
 				}
 
 				OutHeader.PropertyNames.Add(Name);
+				OutHeader.PropertyTypes.Add(Type);
 				OutHeader.PropertyOffsets.Add(Name, CurrentOffset);
 				CurrentOffset += TypeSize;
 			}
@@ -230,89 +415,146 @@ bool FPLYFileReader::ParseHeader(const TArray<uint8>& FileData, FPLYHeader& OutH
 	return true;
 }
 
-bool FPLYFileReader::ReadVertexData(const TArray<uint8>& FileData, const FPLYHeader& Header, TArray<FGaussianSplatData>& OutSplats, FString& OutError)
+bool FPLYFileReader::ResolveVertexLayout(const FPLYHeader& Header, FPLYVertexLayout& OutLayout, FString& OutError)
 {
-	const int64 DataSize = static_cast<int64>(Header.VertexCount) * Header.VertexStride;
-	const int64 ExpectedEnd = Header.DataOffset + DataSize;
-
-	if (ExpectedEnd > FileData.Num())
+	// Returns the offset of a float property, INDEX_NONE if absent, or fails on a non-float type
+	bool bTypeError = false;
+	auto FindFloat = [&Header, &OutError, &bTypeError](const FString& Name) -> int32
 	{
-		OutError = FString::Printf(TEXT("File truncated: expected %lld bytes, got %d"),
-			ExpectedEnd, FileData.Num());
-		return false;
-	}
+		const int32 PropertyIndex = Header.PropertyNames.IndexOfByKey(Name);
+		if (PropertyIndex == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
 
-	OutSplats.SetNum(Header.VertexCount);
+		const FString& Type = Header.PropertyTypes[PropertyIndex];
+		if (Type != TEXT("float") && Type != TEXT("float32"))
+		{
+			OutError = FString::Printf(TEXT("Property %s has unsupported type %s (expected float)"), *Name, *Type);
+			bTypeError = true;
+			return INDEX_NONE;
+		}
 
-	const uint8* DataPtr = FileData.GetData() + Header.DataOffset;
+		return Header.PropertyOffsets.FindChecked(Name);
+	};
 
-	for (int32 i = 0; i < Header.VertexCount; i++)
+	// Every splat needs these, decoding would otherwise silently default them
+	bool bMissing = false;
+	auto FindRequiredFloat = [&Header, &OutError, &bTypeError, &bMissing, &FindFloat](const FString& Name) -> int32
 	{
-		const uint8* VertexData = DataPtr + static_cast<int64>(i) * Header.VertexStride;
-		FGaussianSplatData& Splat = OutSplats[i];
-
-		// Position - Convert from Y-up (OpenGL/3DGS) to Z-up (Unreal) with handedness fix
-		// PLY: X-right, Y-up, Z-forward (right-handed) -> UE: X-forward, Y-right, Z-up (left-handed)
-		// Negate Y to convert from right-handed to left-handed (fixes left-right mirror)
-		// Multiply by 100 to convert from meters (PLY) to centimeters (UE)
-		constexpr float MetersToUE = 100.0f;
-		float PlyX = GetPropertyFloat(VertexData, Header, TEXT("x"));
-		float PlyY = GetPropertyFloat(VertexData, Header, TEXT("y"));
-		float PlyZ = GetPropertyFloat(VertexData, Header, TEXT("z"));
-		Splat.Position.X = PlyZ * MetersToUE;    // PLY Z -> UE X (forward)
-		Splat.Position.Y = -PlyX * MetersToUE;   // PLY X -> UE -Y (right, negated for handedness)
-		Splat.Position.Z = PlyY * MetersToUE;    // PLY Y -> UE Z (up)
-
-		// Rotation (quaternion) - Convert coordinate system with handedness fix
-		// PLY uses (w, x, y, z) format with Y-up right-handed coordinate system
-		// When negating one axis (Y), negate quaternion components perpendicular to it (X and Z)
-		float QW = GetPropertyFloat(VertexData, Header, TEXT("rot_0"));
-		float QX = GetPropertyFloat(VertexData, Header, TEXT("rot_1"));
-		float QY = GetPropertyFloat(VertexData, Header, TEXT("rot_2"));
-		float QZ = GetPropertyFloat(VertexData, Header, TEXT("rot_3"));
-		Splat.Rotation.W = QW;
-		Splat.Rotation.X = -QZ;   // PLY Z -> UE X, negated for handedness
-		Splat.Rotation.Y = QX;    // PLY X -> UE Y (flipped axis, not negated)
-		Splat.Rotation.Z = -QY;   // PLY Y -> UE Z, negated for handedness
-
-		// Scale - Reorder to match coordinate system conversion
-		// Scale is always positive magnitude, no negation needed
-		float ScaleX = GetPropertyFloat(VertexData, Header, TEXT("scale_0"));
-		float ScaleY = GetPropertyFloat(VertexData, Header, TEXT("scale_1"));
-		float ScaleZ = GetPropertyFloat(VertexData, Header, TEXT("scale_2"));
-		Splat.Scale.X = ScaleZ;  // PLY Z -> UE X
-		Splat.Scale.Y = ScaleX;  // PLY X -> UE Y
-		Splat.Scale.Z = ScaleY;  // PLY Y -> UE Z
-
-		// Opacity
-		Splat.Opacity = GetPropertyFloat(VertexData, Header, TEXT("opacity"));
-
-		// SH DC (base color)
-		Splat.SH_DC.X = GetPropertyFloat(VertexData, Header, TEXT("f_dc_0"));
-		Splat.SH_DC.Y = GetPropertyFloat(VertexData, Header, TEXT("f_dc_1"));
-		Splat.SH_DC.Z = GetPropertyFloat(VertexData, Header, TEXT("f_dc_2"));
-
-		// SH rest coefficients (bands 1-3)
-		for (int32 c = 0; c < GaussianSplattingConstants::NumSHCoefficients; c++)
+		if (!bTypeError && !bMissing && !Header.PropertyNames.Contains(Name))
 		{
-			// PLY stores SH in planar format (from save_ply: transpose(1,2).flatten())
-			// f_rest_0..14  = 15 coefficients for R channel
-			// f_rest_15..29 = 15 coefficients for G channel
-			// f_rest_30..44 = 15 coefficients for B channel
-			FString PropNameR = FString::Printf(TEXT("f_rest_%d"), c);
-			FString PropNameG = FString::Printf(TEXT("f_rest_%d"), c + GaussianSplattingConstants::NumSHCoefficients);
-			FString PropNameB = FString::Printf(TEXT("f_rest_%d"), c + GaussianSplattingConstants::NumSHCoefficients * 2);
-
-			Splat.SH[c].X = GetPropertyFloat(VertexData, Header, PropNameR);
-			Splat.SH[c].Y = GetPropertyFloat(VertexData, Header, PropNameG);
-			Splat.SH[c].Z = GetPropertyFloat(VertexData, Header, PropNameB);
+			OutError = FString::Printf(TEXT("Missing required property %s"), *Name);
+			bMissing = true;
 		}
+		return FindFloat(Name);
+	};
 
-		// Linearize the data
-		LinearizeSplatData(Splat);
+	OutLayout.Position[0] = FindRequiredFloat(TEXT("x"));
+	OutLayout.Position[1] = FindRequiredFloat(TEXT("y"));
+	OutLayout.Position[2] = FindRequiredFloat(TEXT("z"));
+	for (int32 i = 0; i < 4; i++)
+	{
+		OutLayout.Rotation[i] = FindRequiredFloat(FString::Printf(TEXT("rot_%d"), i));
+	}
+	for (int32 i = 0; i < 3; i++)
+	{
+		OutLayout.Scale[i] = FindRequiredFloat(FString::Printf(TEXT("scale_%d"), i));
+		OutLayout.SHDC[i] = FindRequiredFloat(FString::Printf(TEXT("f_dc_%d"), i));
+	}
+	OutLayout.Opacity = FindRequiredFloat(TEXT("opacity"));
+	if (bMissing)
+	{
+		return false;
 	}
 
-	return true;
+	// PLY stores SH in planar format (from save_ply: transpose(1,2).flatten()):
+	// all coefficients of R, then G, then B. The per-channel count depends on the
+	// SH degree the capture was trained with (0, 3, 8 or 15 coefficients).
+	int32 NumRest = 0;
+	while (Header.PropertyOffsets.Contains(FString::Printf(TEXT("f_rest_%d"), NumRest)))
+	{
+		NumRest++;
+	}
+	const int32 CoeffsPerChannel = FMath::Min(NumRest / 3, GaussianSplattingConstants::NumSHCoefficients);
+	for (int32 c = 0; c < CoeffsPerChannel; c++)
+	{
+		for (int32 Channel = 0; Channel < 3; Channel++)
+		{
+			OutLayout.SHRest[c][Channel] = FindFloat(FString::Printf(TEXT("f_rest_%d"), c + Channel * (NumRest / 3)));
+		}
+	}
+
+	return !bTypeError;
+}
+
+void FPLYFileReader::DecodeVertexRange(const uint8* VertexData, int32 FirstVertex, int32 NumVertices, const FPLYHeader& Header, const FPLYVertexLayout& Layout, TArray<FGaussianSplatData>& OutSplats)
+{
+	using namespace PLYFileReaderPrivate;
+
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumVertices, VerticesPerTask);
+	const int32 Stride = Header.VertexStride;
+
+	ParallelFor(NumTasks, [&](int32 TaskIndex)
+	{
+		const int32 TaskStart = TaskIndex * VerticesPerTask;
+		const int32 TaskEnd = FMath::Min(TaskStart + VerticesPerTask, NumVertices);
+
+		for (int32 i = TaskStart; i < TaskEnd; i++)
+		{
+			const uint8* Vertex = VertexData + static_cast<int64>(i) * Stride;
+			FGaussianSplatData& Splat = OutSplats[FirstVertex + i];
+
+			// Position - Convert from Y-up (OpenGL/3DGS) to Z-up (Unreal) with handedness fix
+			// PLY: X-right, Y-up, Z-forward (right-handed) -> UE: X-forward, Y-right, Z-up (left-handed)
+			// Negate Y to convert from right-handed to left-handed (fixes left-right mirror)
+			// Multiply by 100 to convert from meters (PLY) to centimeters (UE)
+			constexpr float MetersToUE = 100.0f;
+			const float PlyX = ReadFloat(Vertex, Layout.Position[0]);
+			const float PlyY = ReadFloat(Vertex, Layout.Position[1]);
+			const float PlyZ = ReadFloat(Vertex, Layout.Position[2]);
+			Splat.Position.X = PlyZ * MetersToUE;    // PLY Z -> UE X (forward)
+			Splat.Position.Y = -PlyX * MetersToUE;   // PLY X -> UE -Y (right, negated for handedness)
+			Splat.Position.Z = PlyY * MetersToUE;    // PLY Y -> UE Z (up)
+
+			// Rotation (quaternion) - Convert coordinate system with handedness fix
+			// PLY uses (w, x, y, z) format with Y-up right-handed coordinate system
+			// When negating one axis (Y), negate quaternion components perpendicular to it (X and Z)
+			const float QW = ReadFloat(Vertex, Layout.Rotation[0]);
+			const float QX = ReadFloat(Vertex, Layout.Rotation[1]);
+			const float QY = ReadFloat(Vertex, Layout.Rotation[2]);
+			const float QZ = ReadFloat(Vertex, Layout.Rotation[3]);
+			Splat.Rotation.W = QW;
+			Splat.Rotation.X = -QZ;   // PLY Z -> UE X, negated for handedness
+			Splat.Rotation.Y = QX;    // PLY X -> UE Y (flipped axis, not negated)
+			Splat.Rotation.Z = -QY;   // PLY Y -> UE Z, negated for handedness
+
+			// Scale - Reorder to match coordinate system conversion
+			// Scale is always positive magnitude, no negation needed
+			Splat.Scale.X = ReadFloat(Vertex, Layout.Scale[2]);  // PLY Z -> UE X
+			Splat.Scale.Y = ReadFloat(Vertex, Layout.Scale[0]);  // PLY X -> UE Y
+			Splat.Scale.Z = ReadFloat(Vertex, Layout.Scale[1]);  // PLY Y -> UE Z
+
+			// Opacity
+			Splat.Opacity = ReadFloat(Vertex, Layout.Opacity);
+
+			// SH DC (base color)
+			Splat.SH_DC.X = ReadFloat(Vertex, Layout.SHDC[0]);
+			Splat.SH_DC.Y = ReadFloat(Vertex, Layout.SHDC[1]);
+			Splat.SH_DC.Z = ReadFloat(Vertex, Layout.SHDC[2]);
+
+			// SH rest coefficients (bands 1-3), missing coefficients decode as zero
+			for (int32 c = 0; c < GaussianSplattingConstants::NumSHCoefficients; c++)
+			{
+				Splat.SH[c].X = ReadFloat(Vertex, Layout.SHRest[c][0]);
+				Splat.SH[c].Y = ReadFloat(Vertex, Layout.SHRest[c][1]);
+				Splat.SH[c].Z = ReadFloat(Vertex, Layout.SHRest[c][2]);
+			}
+
+			// Linearize the data
+			LinearizeSplatData(Splat);
+		}
+	});
 }
 
 void FPLYFileReader::LinearizeSplatData(FGaussianSplatData& Splat)
@@ -330,16 +572,3 @@ void FPLYFileReader::LinearizeSplatData(FGaussianSplatData& Splat)
 	// Apply sigmoid to opacity
 	Splat.Opacity = GaussianSplattingUtils::Sigmoid(Splat.Opacity);
 }
-
-float FPLYFileReader::GetPropertyFloat(const uint8* VertexData, const FPLYHeader& Header, const FString& PropertyName, float DefaultValue)
-{
-	const int32* OffsetPtr = Header.PropertyOffsets.Find(PropertyName);
-	if (!OffsetPtr)
-	{
-		return DefaultValue;
-	}
-
-	// Assuming all properties are float (which is standard for 3DGS PLY files)
-	const float* ValuePtr = reinterpret_cast<const float*>(VertexData + *OffsetPtr);
-	return *ValuePtr;
-}
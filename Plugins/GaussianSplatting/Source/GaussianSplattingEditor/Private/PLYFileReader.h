@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "GaussianDataTypes.h"
+#include "Templates/Function.h"
+
+class IFileHandle;
 
 /**
  * PLY file header information
@@ -19,6 +22,9 @@ struct FPLYHeader
 	/** Property names in order */
 	TArray<FString> PropertyNames;
 
+	/** Property type names in order (parallel to PropertyNames) */
+	TArray<FString> PropertyTypes;
+
 	/** Property name to byte offset mapping */
 	TMap<FString, int32> PropertyOffsets;
 
@@ -29,6 +35,30 @@ struct FPLYHeader
 	int64 DataOffset = 0;
 };
 
+/**
+ * Byte offsets of every splat property inside one PLY vertex, resolved once from the header
+ * so the per-vertex decode never performs name lookups. INDEX_NONE marks a missing property.
+ */
+struct FPLYVertexLayout
+{
+	int32 Position[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	int32 Rotation[4] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	int32 Scale[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	int32 Opacity = INDEX_NONE;
+	int32 SHDC[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+
+	/** f_rest offsets as [coefficient][channel], coefficients beyond the file's SH degree stay INDEX_NONE */
+	int32 SHRest[GaussianSplattingConstants::NumSHCoefficients][3];
+
+	FPLYVertexLayout()
+	{
+		for (int32 c = 0; c < GaussianSplattingConstants::NumSHCoefficients; c++)
+		{
+			SHRest[c][0] = SHRest[c][1] = SHRest[c][2] = INDEX_NONE;
+		}
+	}
+};
+
 /**
  * Utility class for reading PLY files containing Gaussian Splatting data
  * Supports the standard PLY format from 3D Gaussian Splatting training
@@ -38,6 +68,8 @@ class FPLYFileReader
 public:
 	/**
 	 * Read PLY file and extract Gaussian splat data
+	 * The vertex payload is memory-mapped (or streamed in blocks when mapping is unavailable)
+	 * and decoded in parallel directly into OutSplats.
 	 * @param FilePath Path to the .ply file
 	 * @param OutSplats Output array of splat data
 	 * @param OutError Error message if reading failed
@@ -45,6 +77,16 @@ public:
 	 */
 	static bool ReadPLYFile(const FString& FilePath, TArray<FGaussianSplatData>& OutSplats, FString& OutError);
 
+	/**
+	 * Read PLY file block by block, handing each decoded block to a callback
+	 * Only one block is held at a time, so memory stays bounded for captures too large to keep resident.
+	 * @param FilePath Path to the .ply file
+	 * @param ChunkCallback Called once per block, in file order; the view is only valid during the call
+	 * @param OutError Error message if reading failed
+	 * @return True if successful
+	 */
+	static bool ReadPLYFileInChunks(const FString& FilePath, TFunctionRef<void(TConstArrayView<FGaussianSplatData>)> ChunkCallback, FString& OutError);
+
 	/**
 	 * Check if a file is a valid PLY file
 	 * @param FilePath Path to the file
@@ -53,24 +95,55 @@ public:
 	static bool IsValidPLYFile(const FString& FilePath);
 
 private:
+	/**
+	 * Open the file, parse its header and check the vertex payload is complete
+	 * @param FilePath Path to the .ply file
+	 * @param OutFileHandle Open handle to the file
+	 * @param OutHeader Parsed header information
+	 * @param OutLayout Resolved property offsets
+	 * @param OutError Error message if reading failed
+	 * @return True if successful
+	 */
+	static bool OpenVertexData(const FString& FilePath, TUniquePtr<IFileHandle>& OutFileHandle, FPLYHeader& OutHeader, FPLYVertexLayout& OutLayout, FString& OutError);
+
+	/**
+	 * Read the ASCII header from the start of the file
+	 * @param FileHandle Open handle positioned at the start of the file
+	 * @param OutHeaderBytes Raw header bytes, up to and including the line after "end_header"
+	 * @param OutError Error message if reading failed
+	 * @return True if successful
+	 */
+	static bool ReadHeaderBytes(IFileHandle& FileHandle, TArray<uint8>& OutHeaderBytes, FString& OutError);
+
 	/**
 	 * Parse the PLY header to extract format information
-	 * @param FileData Raw file data
+	 * @param HeaderData Raw header bytes
+	 * @param HeaderSize Number of valid bytes in HeaderData
 	 * @param OutHeader Parsed header information
 	 * @param OutError Error message if parsing failed
 	 * @return True if successful
 	 */
-	static bool ParseHeader(const TArray<uint8>& FileData, FPLYHeader& OutHeader, FString& OutError);
+	static bool ParseHeader(const uint8* HeaderData, int64 HeaderSize, FPLYHeader& OutHeader, FString& OutError);
 
 	/**
-	 * Read vertex data from the PLY file
-	 * @param FileData Raw file data
+	 * Resolve the byte offset of every splat property once
 	 * @param Header Parsed header information
-	 * @param OutSplats Output array of splat data
-	 * @param OutError Error message if reading failed
+	 * @param OutLayout Resolved property offsets
+	 * @param OutError Error message if a required property is missing or not a float
 	 * @return True if successful
 	 */
-	static bool ReadVertexData(const TArray<uint8>& FileData, const FPLYHeader& Header, TArray<FGaussianSplatData>& OutSplats, FString& OutError);
+	static bool ResolveVertexLayout(const FPLYHeader& Header, FPLYVertexLayout& OutLayout, FString& OutError);
+
+	/**
+	 * Decode a contiguous range of vertices in parallel
+	 * @param VertexData Pointer to the first vertex of the range
+	 * @param FirstVertex Index of the first vertex in OutSplats
+	 * @param NumVertices Number of vertices in the range
+	 * @param Header Parsed header information
+	 * @param Layout Resolved property offsets
+	 * @param OutSplats Output array, already sized to the full vertex count
+	 */
+	static void DecodeVertexRange(const uint8* VertexData, int32 FirstVertex, int32 NumVertices, const FPLYHeader& Header, const FPLYVertexLayout& Layout, TArray<FGaussianSplatData>& OutSplats);
 
 	/**
 	 * Linearize splat data from raw PLY values
@@ -80,14 +153,4 @@ private:
 	 * @param Splat Splat data to linearize (modified in place)
 	 */
 	static void LinearizeSplatData(FGaussianSplatData& Splat);
-
-	/**
-	 * Get property value from vertex data
-	 * @param VertexData Pointer to vertex data
-	 * @param Header Header with property offsets
-	 * @param PropertyName Name of the property to read
-	 * @param DefaultValue Default value if property not found
-	 * @return Property value as float
-	 */
-	static float GetPropertyFloat(const uint8* VertexData, const FPLYHeader& Header, const FString& PropertyName, float DefaultValue = 0.0f);
 };
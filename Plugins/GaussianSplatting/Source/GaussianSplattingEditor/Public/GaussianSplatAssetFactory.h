@@ -9,9 +9,11 @@
 #include "GaussianSplatAssetFactory.generated.h"
 
 class UGaussianSplatAsset;
+class UGaussianSplatTileSet;
 
 /**
- * Factory for importing PLY files as Gaussian Splat assets
+ * Factory for importing PLY files as Gaussian Splat assets,
+ * or as a Gaussian Splat Tile Set of one asset per grid cell when gs.ImportTileSize is set
  */
 UCLASS(hidecategories = Object)
 class GAUSSIANSPLATTINGEDITOR_API UGaussianSplatAssetFactory : public UFactory, public FReimportHandler
@@ -43,9 +45,15 @@ public:
 	virtual EReimportResult::Type Reimport(UObject* Obj) override;
 	//~ End FReimportHandler Interface
 
+	/**
+	 * Reorder splats along a 3D Morton curve over their bounds, so each chunk of
+	 * SplatsPerChunk consecutive splats covers a compact region with tight bounds
+	 */
+	static void SortSplatsMorton(TArray<FGaussianSplatData>& Splats);
+
 public:
-	/** Import quality level (currently unused - always uses Float32 positions for maximum accuracy) */
-	EGaussianQualityLevel QualityLevel = EGaussianQualityLevel::VeryHigh;
+	/** Import quality level (selects position/scale quantization, VeryHigh keeps Float32) */
+	EGaussianQualityLevel QualityLevel = EGaussianQualityLevel::Medium;
 
 private:
 	/**
@@ -64,4 +72,26 @@ private:
 		EObjectFlags Flags,
 		UGaussianSplatAsset* ExistingAsset = nullptr
 	);
+
+	/**
+	 * Import a PLY file split into a grid of tile assets, each in its own package under <InName>_Tiles
+	 * The file is streamed and bucketed block by block, so the whole capture is never resident at once
+	 * @param TileSize Edge length of the grid cells in the XY plane
+	 * @param ExistingTileSet Existing tile set to update (for reimport), its tile assets are updated in place
+	 * @return The created or updated tile set, or nullptr on failure
+	 */
+	UGaussianSplatTileSet* ImportTiledPLYFile(
+		const FString& FilePath,
+		UObject* InParent,
+		FName InName,
+		EObjectFlags Flags,
+		float TileSize,
+		UGaussianSplatTileSet* ExistingTileSet = nullptr
+	);
+
+	/**
+	 * Find the tile asset of a grid cell, or create it in a new package
+	 * @param ExistingTileSet Tile set being reimported, whose tiles are reused by cell
+	 */
+	static UGaussianSplatAsset* FindOrCreateTileAsset(const FString& TileFolder, const FString& BaseName, const FIntPoint& Cell, UGaussianSplatTileSet* ExistingTileSet);
 };
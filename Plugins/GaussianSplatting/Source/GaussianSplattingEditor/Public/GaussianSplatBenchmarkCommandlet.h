@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GaussianDataTypes.h"
+#include "GaussianSplatBenchmarkCommandlet.generated.h"
+
+class UGaussianSplatAsset;
+
+/** A benchmark scene: a PLY file, or a synthetic scene when PLYFile is empty */
+struct FGaussianSplatBenchmarkScene
+{
+	FString Name;
+	FString PLYFile;
+	int32 NumSplats = 0;
+};
+
+/**
+ * Headless import and sort benchmark: builds assets from a PLY file and synthetic scenes the way the importer does,
+ * then times the GPU sort for every sort mode at each scene's splat count.
+ *
+ * UnrealEditor-Cmd <Project> -run=GaussianSplatBenchmark [-PLY=<file>] [-Synthetic=1000000,5000000,10000000]
+ *     [-Quality=0-4] [-SortIterations=8] [-Output=<file.csv>] -AllowCommandletRendering
+ *
+ * Without -AllowCommandletRendering (or on RHIs without timestamp queries) only the import numbers are reported.
+ * Rendering costs of the same scenes along a camera path are measured by the GaussianSplatting.Benchmark.CameraPath
+ * automation test, which takes the same -PLY and -Synthetic switches.
+ */
+UCLASS()
+class UGaussianSplatBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGaussianSplatBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+	/** Scenes selected by -PLY= and -Synthetic= in Params, the 142k splat PLY and 1M/5M/10M synthetic splats without either */
+	static TArray<FGaussianSplatBenchmarkScene> GetBenchmarkScenes(const FString& Params);
+
+	/** Read a scene's PLY file, or generate its synthetic splats */
+	static bool ReadBenchmarkSplats(const FGaussianSplatBenchmarkScene& Scene, TArray<FGaussianSplatData>& OutSplats, FString& OutError);
+
+	/** Morton-sort and compress splats exactly like UGaussianSplatAssetFactory, into a transient asset */
+	static UGaussianSplatAsset* BuildBenchmarkAsset(TArray<FGaussianSplatData>& SplatData, EGaussianQualityLevel QualityLevel);
+};